@@ -40,3 +40,15 @@ tight-tag       ; Argument completes shortest legal expression (not longest)
 ;; !!! See notes on FUNCTION-META in %sysobj.r
 
 function-meta
+
+;; Compiled code of functions JIT-compiled by TCC (see %c-jit.c)
+
+jit-functions
+
+;; Functions measured by PROFILE and their names (see %d-profile.c)
+
+profile-functions
+
+;; Arrays and names of sites where series were made, for PROFILE/SERIES
+
+profile-sites
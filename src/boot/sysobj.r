@@ -348,6 +348,7 @@ standard: construct [] [
     port-spec-net: construct port-spec-head [
         host: _
         port-id: 80
+        buffer-size: _  ; OS socket buffer size, also caps each transfer
     ]
 
     port-spec-serial: construct port-spec-head [
@@ -362,6 +363,11 @@ standard: construct [] [
         mask: [all]
     ]
 
+    port-spec-process: construct port-spec-head [
+        command: _      ; shell STRING!, or BLOCK! of program and arguments
+        merge-error: false ; child's stderr is read along with its stdout
+    ]
+
     file-info: construct [] [
         name:
         size:
@@ -378,6 +384,12 @@ standard: construct [] [
             _
     ]
 
+    process-info: construct [] [
+        pid:
+        exit-code:  ; blank until the process has exited
+            _
+    ]
+
     extension: construct [] [
         lib-base:   ; handle to DLL
         lib-file:   ; file name loaded
@@ -401,6 +413,8 @@ standard: construct [] [
         made-blocks:
         made-objects:
         recycles:
+        frames-reified:  ; stack frame contexts needing a new node
+        frames-recycled: ; ...and those reusing the node of an expired frame
             _
     ]
 
@@ -184,11 +184,22 @@ shift
 
 ; Checksum
 sha1
+sha256
+sha384
+sha512
+blake2b
+blake2s
 md4
 md5
 crc32
 adler32
 
+; Compression strategies (DEFAULT is defined with the FFI words)
+filtered
+huffman-only
+rle
+fixed
+
 ; Codec actions
 identify
 decode
@@ -206,6 +217,7 @@ udp
 clipboard
 serial
 signal
+process
 
 ; Serial parameters
 ; Parity
@@ -336,6 +348,9 @@ pid
 id
 exit-code
 
+;process port (MODIFY field)
+input
+
 ; used when a function is executed but not looked up through a word binding
 ; (product of literal or evaluation) so no name is known for it
 --anonymous--
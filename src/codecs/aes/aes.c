@@ -162,6 +162,430 @@ static const unsigned char Rcon[30]=
     0xb3,0x7d,0xfa,0xef,0xc5,0x91,
 };
 
+#define GET_U32_BE(b,i) \
+    (((uint32_t)(b)[(i)] << 24) | ((uint32_t)(b)[(i)+1] << 16) \
+    | ((uint32_t)(b)[(i)+2] << 8) | ((uint32_t)(b)[(i)+3]))
+
+#define PUT_U32_BE(n,b,i) \
+    do { \
+        (b)[(i)] = (uint8_t)((n) >> 24); (b)[(i)+1] = (uint8_t)((n) >> 16); \
+        (b)[(i)+2] = (uint8_t)((n) >> 8); (b)[(i)+3] = (uint8_t)(n); \
+    } while (0)
+
+/**
+ * Increment the last `width` bytes of a counter block as a big-endian
+ * number (4 for GCM's inc32, 16 for CTR mode).
+ */
+static void ctr_increment(uint8_t *counter, int width)
+{
+    int i;
+    for (i = AES_BLOCKSIZE; i > AES_BLOCKSIZE - width; i--)
+        if (++counter[i - 1] != 0)
+            break;
+}
+
+/**************************************************************************
+ * AES-NI and PCLMULQDQ
+ *
+ * Used when the CPU has them (checked once at run time), in place of the
+ * table code above: faster, and with no key or data dependent memory
+ * accesses.  The round keys are the ones AES_set_key() computes, just
+ * stored as bytes.  Several blocks are kept in flight wherever the mode
+ * allows it (CBC decryption, CTR, GHASH), since each instruction has a
+ * latency of several cycles but a new one can start every cycle.
+ *
+ * Define AES_NO_HW to build without it.
+ **************************************************************************/
+
+#if !defined(AES_NO_HW) && defined(__GNUC__) \
+    && (defined(__x86_64__) || defined(__i386__))
+#define AES_HW
+#endif
+
+#ifdef AES_HW
+
+#include <cpuid.h>
+#include <immintrin.h>
+
+#define AES_TARGET __attribute__((target("sse2,ssse3,aes,pclmul")))
+
+#define LOAD(p) _mm_loadu_si128((const __m128i *)(p))
+#define STORE(p,x) _mm_storeu_si128((__m128i *)(p), (x))
+
+/* the blocks in flight must stay in registers, so unroll even at -O2 */
+#define PRAGMA_UNROLL _Pragma("GCC unroll 8")
+
+static int aes_hw = -1; /* not checked yet */
+
+static int aesni_available(void)
+{
+    if (aes_hw < 0)
+    {
+        unsigned int a, b, c, d;
+        aes_hw = __get_cpuid(1, &a, &b, &c, &d)
+            && (c & bit_AES) && (c & bit_PCLMUL) && (c & bit_SSSE3);
+    }
+    return aes_hw;
+}
+
+static void aesni_load_keys(AES_CTX *ctx)
+{
+    int i;
+    for (i = 0; i < 4 * (ctx->rounds + 1); i++)
+        PUT_U32_BE(ctx->ks[i], ctx->rk, 4 * i);
+}
+
+/**
+ * Reverse the round keys and apply InvMixColumns to the inner ones, as
+ * AESDEC wants (the "equivalent inverse cipher").
+ */
+AES_TARGET static void aesni_convert_keys(AES_CTX *ctx)
+{
+    int i;
+    int rounds = ctx->rounds;
+    __m128i k[AES_MAXROUNDS + 1];
+
+    for (i = 0; i <= rounds; i++)
+        k[i] = LOAD(ctx->rk + AES_BLOCKSIZE * i);
+
+    STORE(ctx->rk, k[rounds]);
+    for (i = 1; i < rounds; i++)
+        STORE(ctx->rk + AES_BLOCKSIZE * i, _mm_aesimc_si128(k[rounds - i]));
+    STORE(ctx->rk + AES_BLOCKSIZE * rounds, k[0]);
+}
+
+AES_TARGET static __m128i aesni_encrypt1(
+    const __m128i *k, int rounds, __m128i b
+){
+    int r;
+    b = _mm_xor_si128(b, k[0]);
+    for (r = 1; r < rounds; r++)
+        b = _mm_aesenc_si128(b, k[r]);
+    return _mm_aesenclast_si128(b, k[rounds]);
+}
+
+AES_TARGET static __m128i aesni_decrypt1(
+    const __m128i *k, int rounds, __m128i b
+){
+    int r;
+    b = _mm_xor_si128(b, k[0]);
+    for (r = 1; r < rounds; r++)
+        b = _mm_aesdec_si128(b, k[r]);
+    return _mm_aesdeclast_si128(b, k[rounds]);
+}
+
+AES_TARGET static void aesni_encrypt_block(
+    const AES_CTX *ctx, const uint8_t *in, uint8_t *out
+){
+    int i;
+    __m128i k[AES_MAXROUNDS + 1];
+
+    for (i = 0; i <= ctx->rounds; i++)
+        k[i] = LOAD(ctx->rk + AES_BLOCKSIZE * i);
+    STORE(out, aesni_encrypt1(k, ctx->rounds, LOAD(in)));
+}
+
+AES_TARGET static void aesni_cbc_encrypt(
+    AES_CTX *ctx, const uint8_t *in, uint8_t *out, int length
+){
+    int i;
+    __m128i k[AES_MAXROUNDS + 1];
+    __m128i iv = LOAD(ctx->iv);
+
+    for (i = 0; i <= ctx->rounds; i++)
+        k[i] = LOAD(ctx->rk + AES_BLOCKSIZE * i);
+
+    for (; length >= AES_BLOCKSIZE; length -= AES_BLOCKSIZE)
+    {
+        iv = aesni_encrypt1(k, ctx->rounds, _mm_xor_si128(LOAD(in), iv));
+        STORE(out, iv);
+        in += AES_BLOCKSIZE;
+        out += AES_BLOCKSIZE;
+    }
+
+    STORE(ctx->iv, iv);
+}
+
+AES_TARGET static void aesni_cbc_decrypt(
+    AES_CTX *ctx, const uint8_t *in, uint8_t *out, int length
+){
+    int i, r;
+    int rounds = ctx->rounds;
+    __m128i k[AES_MAXROUNDS + 1];
+    __m128i iv = LOAD(ctx->iv);
+
+    for (i = 0; i <= rounds; i++)
+        k[i] = LOAD(ctx->rk + AES_BLOCKSIZE * i);
+
+    /* unlike encryption, the blocks can be deciphered independently */
+    for (; length >= 4 * AES_BLOCKSIZE; length -= 4 * AES_BLOCKSIZE)
+    {
+        __m128i c[4], b[4];
+
+        PRAGMA_UNROLL
+        for (i = 0; i < 4; i++)
+        {
+            c[i] = LOAD(in + AES_BLOCKSIZE * i);
+            b[i] = _mm_xor_si128(c[i], k[0]);
+        }
+        for (r = 1; r < rounds; r++)
+        {
+            PRAGMA_UNROLL
+            for (i = 0; i < 4; i++)
+                b[i] = _mm_aesdec_si128(b[i], k[r]);
+        }
+        PRAGMA_UNROLL
+        for (i = 0; i < 4; i++)
+            b[i] = _mm_aesdeclast_si128(b[i], k[rounds]);
+
+        STORE(out, _mm_xor_si128(b[0], iv));
+        for (i = 1; i < 4; i++)
+            STORE(out + AES_BLOCKSIZE * i, _mm_xor_si128(b[i], c[i - 1]));
+        iv = c[3];
+
+        in += 4 * AES_BLOCKSIZE;
+        out += 4 * AES_BLOCKSIZE;
+    }
+
+    for (; length >= AES_BLOCKSIZE; length -= AES_BLOCKSIZE)
+    {
+        __m128i c = LOAD(in);
+        STORE(out, _mm_xor_si128(aesni_decrypt1(k, rounds, c), iv));
+        iv = c;
+        in += AES_BLOCKSIZE;
+        out += AES_BLOCKSIZE;
+    }
+
+    STORE(ctx->iv, iv);
+}
+
+AES_TARGET static __m128i bswap128(__m128i x)
+{
+    return _mm_shuffle_epi8(
+        x, _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15)
+    );
+}
+
+/**
+ * XOR whole blocks with the encrypted counter, 8 blocks at a time.
+ *
+ * The counter is kept byte reversed in a register and stepped with a
+ * vector add (writing it out as bytes and reading it back for every block
+ * would stall on store forwarding).  A 32-bit add is GCM's inc32; the full
+ * 128-bit add of CTR mode only needs the carry out of the low 64 bits
+ * handled, which the rare batches that would wrap do one block at a time.
+ */
+AES_TARGET static void aesni_ctr_blocks(
+    const AES_CTX *ctx, uint8_t *counter, int width,
+    const uint8_t *in, uint8_t *out, size_t blocks
+){
+    int i, r;
+    int rounds = ctx->rounds;
+    __m128i k[AES_MAXROUNDS + 1];
+    __m128i one = (width == 4)
+        ? _mm_set_epi32(0, 0, 0, 1)
+        : _mm_set_epi64x(0, 1);
+
+    for (i = 0; i <= rounds; i++)
+        k[i] = LOAD(ctx->rk + AES_BLOCKSIZE * i);
+
+    while (blocks > 0)
+    {
+        __m128i b[8];
+        __m128i ctr;
+        int n = blocks < 8 ? (int)blocks : 8;
+
+        if (n < 8 || (width != 4
+            && GET_U32_BE(counter, 8) == 0xffffffff
+            && GET_U32_BE(counter, 12) > 0xffffffff - 8
+        )){
+            for (i = 0; i < n; i++)
+            {
+                __m128i x = aesni_encrypt1(k, rounds, LOAD(counter));
+                ctr_increment(counter, width);
+                STORE(out, _mm_xor_si128(x, LOAD(in)));
+                in += AES_BLOCKSIZE;
+                out += AES_BLOCKSIZE;
+            }
+            blocks -= n;
+            continue;
+        }
+
+        ctr = bswap128(LOAD(counter));
+        PRAGMA_UNROLL
+        for (i = 0; i < 8; i++)
+        {
+            b[i] = _mm_xor_si128(bswap128(ctr), k[0]);
+            ctr = (width == 4)
+                ? _mm_add_epi32(ctr, one)
+                : _mm_add_epi64(ctr, one);
+        }
+        STORE(counter, bswap128(ctr));
+
+        for (r = 1; r < rounds; r++)
+        {
+            PRAGMA_UNROLL
+            for (i = 0; i < 8; i++)
+                b[i] = _mm_aesenc_si128(b[i], k[r]);
+        }
+        PRAGMA_UNROLL
+        for (i = 0; i < 8; i++)
+        {
+            b[i] = _mm_aesenclast_si128(b[i], k[rounds]);
+            STORE(
+                out + AES_BLOCKSIZE * i,
+                _mm_xor_si128(b[i], LOAD(in + AES_BLOCKSIZE * i))
+            );
+        }
+
+        in += 8 * AES_BLOCKSIZE;
+        out += 8 * AES_BLOCKSIZE;
+        blocks -= 8;
+    }
+}
+
+/*
+ * GHASH with carry-less multiplication, following Gueron and Kounavis,
+ * "Intel Carry-Less Multiplication Instruction and its Usage for Computing
+ * the GCM Mode" (2010).  Blocks are byte reversed on loading so the bit
+ * order suits PCLMULQDQ; the 256-bit product is then shifted left by one
+ * and reduced.  Both steps are linear, so four products can be summed and
+ * reduced once ("aggregated reduction", with H^4..H precomputed).
+ */
+
+AES_TARGET static void ghash_clmul(
+    __m128i a, __m128i b, __m128i *lo, __m128i *hi
+){
+    __m128i t0 = _mm_clmulepi64_si128(a, b, 0x00);
+    __m128i t1 = _mm_clmulepi64_si128(a, b, 0x10);
+    __m128i t2 = _mm_clmulepi64_si128(a, b, 0x01);
+    __m128i t3 = _mm_clmulepi64_si128(a, b, 0x11);
+
+    t1 = _mm_xor_si128(t1, t2);
+    *lo = _mm_xor_si128(*lo, _mm_xor_si128(t0, _mm_slli_si128(t1, 8)));
+    *hi = _mm_xor_si128(*hi, _mm_xor_si128(t3, _mm_srli_si128(t1, 8)));
+}
+
+AES_TARGET static __m128i ghash_reduce(__m128i lo, __m128i hi)
+{
+    __m128i t7, t8, t9, t2, t4, t5;
+
+    /* shift the 256-bit product left by one */
+    t7 = _mm_srli_epi32(lo, 31);
+    t8 = _mm_srli_epi32(hi, 31);
+    lo = _mm_slli_epi32(lo, 1);
+    hi = _mm_slli_epi32(hi, 1);
+    t9 = _mm_srli_si128(t7, 12);
+    t8 = _mm_slli_si128(t8, 4);
+    t7 = _mm_slli_si128(t7, 4);
+    lo = _mm_or_si128(lo, t7);
+    hi = _mm_or_si128(hi, t8);
+    hi = _mm_or_si128(hi, t9);
+
+    /* reduce modulo x^128 + x^7 + x^2 + x + 1 */
+    t7 = _mm_slli_epi32(lo, 31);
+    t8 = _mm_slli_epi32(lo, 30);
+    t9 = _mm_slli_epi32(lo, 25);
+    t7 = _mm_xor_si128(t7, t8);
+    t7 = _mm_xor_si128(t7, t9);
+    t8 = _mm_srli_si128(t7, 4);
+    t7 = _mm_slli_si128(t7, 12);
+    lo = _mm_xor_si128(lo, t7);
+
+    t2 = _mm_srli_epi32(lo, 1);
+    t4 = _mm_srli_epi32(lo, 2);
+    t5 = _mm_srli_epi32(lo, 7);
+    t2 = _mm_xor_si128(t2, t4);
+    t2 = _mm_xor_si128(t2, t5);
+    t2 = _mm_xor_si128(t2, t8);
+    lo = _mm_xor_si128(lo, t2);
+    return _mm_xor_si128(hi, lo);
+}
+
+AES_TARGET static __m128i ghash_mul(__m128i a, __m128i b)
+{
+    __m128i lo = _mm_setzero_si128();
+    __m128i hi = _mm_setzero_si128();
+    ghash_clmul(a, b, &lo, &hi);
+    return ghash_reduce(lo, hi);
+}
+
+/**
+ * Store H, H^2, H^3 and H^4 (byte reversed) for aesni_ghash().
+ */
+AES_TARGET static void aesni_gcm_init(uint8_t H[4][AES_BLOCKSIZE],
+        const uint8_t *h)
+{
+    int i;
+    __m128i h1 = bswap128(LOAD(h));
+    __m128i hn = h1;
+
+    STORE(H[0], h1);
+    for (i = 1; i < 4; i++)
+    {
+        hn = ghash_mul(hn, h1);
+        STORE(H[i], hn);
+    }
+}
+
+AES_TARGET static void aesni_ghash(
+    const uint8_t H[4][AES_BLOCKSIZE], uint8_t *y,
+    const uint8_t *data, size_t len
+){
+    __m128i h1 = LOAD(H[0]);
+    __m128i h2 = LOAD(H[1]);
+    __m128i h3 = LOAD(H[2]);
+    __m128i h4 = LOAD(H[3]);
+    __m128i x = bswap128(LOAD(y));
+
+    /* Y = (Y + X1) * H^4 + X2 * H^3 + X3 * H^2 + X4 * H */
+    for (; len >= 4 * AES_BLOCKSIZE; len -= 4 * AES_BLOCKSIZE)
+    {
+        __m128i lo = _mm_setzero_si128();
+        __m128i hi = _mm_setzero_si128();
+
+        ghash_clmul(_mm_xor_si128(x, bswap128(LOAD(data))), h4, &lo, &hi);
+        ghash_clmul(bswap128(LOAD(data + 16)), h3, &lo, &hi);
+        ghash_clmul(bswap128(LOAD(data + 32)), h2, &lo, &hi);
+        ghash_clmul(bswap128(LOAD(data + 48)), h1, &lo, &hi);
+        x = ghash_reduce(lo, hi);
+        data += 4 * AES_BLOCKSIZE;
+    }
+
+    while (len > 0)
+    {
+        uint8_t last[AES_BLOCKSIZE];
+        const uint8_t *block = data;
+        size_t n = len < AES_BLOCKSIZE ? len : AES_BLOCKSIZE;
+
+        if (n < AES_BLOCKSIZE)
+        {
+            memset(last, 0, AES_BLOCKSIZE);
+            memcpy(last, data, n);
+            block = last;
+        }
+        x = ghash_mul(_mm_xor_si128(x, bswap128(LOAD(block))), h1);
+        data += n;
+        len -= n;
+    }
+
+    STORE(y, bswap128(x));
+}
+
+#endif /* AES_HW */
+
+/**
+ * Whether AES-NI is in use (on this CPU, in this build).
+ */
+int AES_hw_available(void)
+{
+#ifdef AES_HW
+    return aesni_available();
+#else
+    return 0;
+#endif
+}
+
 /* ----- static functions ----- */
 static void AES_encrypt(const AES_CTX *ctx, uint32_t *data);
 static void AES_decrypt(const AES_CTX *ctx, uint32_t *data);
@@ -247,6 +671,16 @@ void AES_set_key(AES_CTX *ctx, const uint8_t *key,
 
     /* copy the iv across */
     memcpy(ctx->iv, iv, 16);
+    ctx->ctr_used = AES_BLOCKSIZE;
+
+    ctx->hw = 0;
+#ifdef AES_HW
+    if (aesni_available())
+    {
+        aesni_load_keys(ctx);
+        ctx->hw = 1;
+    }
+#endif
 }
 
 /**
@@ -259,6 +693,11 @@ void AES_convert_key(AES_CTX *ctx)
 
     ctx->key_mode = AES_MODE_DECRYPT; //change mode
 
+#ifdef AES_HW
+    if (ctx->hw)
+        aesni_convert_keys(ctx);
+#endif
+
     k = ctx->ks;
     k += 4;
 
@@ -278,6 +717,14 @@ void AES_cbc_encrypt(AES_CTX *ctx, const uint8_t *msg, uint8_t *out, int length)
     int i;
     uint32_t tin[4], tout[4], iv[4];
 
+#ifdef AES_HW
+    if (ctx->hw)
+    {
+        aesni_cbc_encrypt(ctx, msg, out, length);
+        return;
+    }
+#endif
+
     memcpy(iv, ctx->iv, AES_IV_SIZE);
     for (i = 0; i < 4; i++)
         tout[i] = ntohl(iv[i]);
@@ -317,6 +764,14 @@ void AES_cbc_decrypt(AES_CTX *ctx, const uint8_t *msg, uint8_t *out, int length)
     int i;
     uint32_t tin[4], xxor[4], tout[4], data[4], iv[4];
 
+#ifdef AES_HW
+    if (ctx->hw)
+    {
+        aesni_cbc_decrypt(ctx, msg, out, length);
+        return;
+    }
+#endif
+
     memcpy(iv, ctx->iv, AES_IV_SIZE);
     for (i = 0; i < 4; i++)
         xxor[i] = ntohl(iv[i]);
@@ -458,3 +913,317 @@ static void AES_decrypt(const AES_CTX *ctx, uint32_t *data)
     }
 }
 
+
+/**
+ * Encrypt a single block given as bytes, for modes built on the raw cipher
+ * (CTR, GCM).  The context must hold an encryption key schedule.
+ */
+void AES_encrypt_block(const AES_CTX *ctx, const uint8_t *in, uint8_t *out)
+{
+    int i;
+    uint32_t data[4];
+
+#ifdef AES_HW
+    if (ctx->hw)
+    {
+        aesni_encrypt_block(ctx, in, out);
+        return;
+    }
+#endif
+
+    memcpy(data, in, AES_BLOCKSIZE);
+    for (i = 0; i < 4; i++)
+        data[i] = ntohl(data[i]);
+
+    AES_encrypt(ctx, data);
+
+    for (i = 0; i < 4; i++)
+        data[i] = htonl(data[i]);
+    memcpy(out, data, AES_BLOCKSIZE);
+}
+
+/**
+ * XOR whole blocks with the encrypted counter, incrementing it after each.
+ */
+static void ctr_blocks(const AES_CTX *ctx, uint8_t *counter, int width,
+        const uint8_t *in, uint8_t *out, size_t blocks)
+{
+    size_t i;
+    uint8_t stream[AES_BLOCKSIZE];
+
+#ifdef AES_HW
+    if (ctx->hw)
+    {
+        aesni_ctr_blocks(ctx, counter, width, in, out, blocks);
+        return;
+    }
+#endif
+
+    for (; blocks > 0; blocks--)
+    {
+        AES_encrypt_block(ctx, counter, stream);
+        ctr_increment(counter, width);
+        for (i = 0; i < AES_BLOCKSIZE; i++)
+            out[i] = in[i] ^ stream[i];
+        in += AES_BLOCKSIZE;
+        out += AES_BLOCKSIZE;
+    }
+}
+
+/**
+ * CTR mode (NIST SP 800-38A), with ctx->iv as the initial counter block
+ * and the whole block incremented as a 128-bit big-endian number.  This
+ * is its own inverse.  The length need not be a multiple of the block
+ * size: keystream left over from one call is used by the next, so a
+ * message may be processed in pieces of any size.  The input and output
+ * may be the same buffer.
+ */
+void AES_ctr_crypt(AES_CTX *ctx, const uint8_t *in, uint8_t *out, size_t len)
+{
+    size_t i, blocks;
+
+    for (; len > 0 && ctx->ctr_used < AES_BLOCKSIZE; len--)
+        *out++ = *in++ ^ ctx->ctr_stream[ctx->ctr_used++];
+
+    blocks = len / AES_BLOCKSIZE;
+    ctr_blocks(ctx, ctx->iv, AES_BLOCKSIZE, in, out, blocks);
+    in += blocks * AES_BLOCKSIZE;
+    out += blocks * AES_BLOCKSIZE;
+    len -= blocks * AES_BLOCKSIZE;
+
+    if (len > 0)
+    {
+        AES_encrypt_block(ctx, ctx->iv, ctx->ctr_stream);
+        ctr_increment(ctx->iv, AES_BLOCKSIZE);
+        for (i = 0; i < len; i++)
+            out[i] = in[i] ^ ctx->ctr_stream[i];
+        ctx->ctr_used = (int)len;
+    }
+}
+
+/**************************************************************************
+ * AES-GCM (NIST SP 800-38D), 96-bit IVs only as used by TLS.
+ *
+ * GHASH uses the 4-bit table method (Shoup): 256 bytes of precomputed
+ * multiples of H per key, and no data-dependent branches.  With AES-NI,
+ * aesni_ghash() is used instead.
+ **************************************************************************/
+
+static const uint64_t gcm_last4[16] =
+{
+    0x0000, 0x1c20, 0x3840, 0x2460, 0x7080, 0x6ca0, 0x48c0, 0x54e0,
+    0xe100, 0xfd20, 0xd940, 0xc560, 0x9180, 0x8da0, 0xa9c0, 0xb5e0
+};
+
+/**
+ * Set up the key schedule and the GHASH multiplication table.  Key length
+ * is in bytes (16 or 32).
+ */
+void AES_gcm_init(AES_GCM_CTX *ctx, const uint8_t *key, int key_len)
+{
+    int i, j;
+    uint8_t h[AES_BLOCKSIZE];
+    uint8_t zero_iv[AES_IV_SIZE];
+    uint64_t vh, vl;
+
+    memset(zero_iv, 0, AES_IV_SIZE);
+    AES_set_key(
+        &ctx->aes, key, zero_iv, key_len == 16 ? AES_MODE_128 : AES_MODE_256
+    );
+
+    memset(h, 0, AES_BLOCKSIZE);
+    AES_encrypt_block(&ctx->aes, h, h);
+
+    vh = ((uint64_t)GET_U32_BE(h, 0) << 32) | GET_U32_BE(h, 4);
+    vl = ((uint64_t)GET_U32_BE(h, 8) << 32) | GET_U32_BE(h, 12);
+
+    ctx->HL[8] = vl;
+    ctx->HH[8] = vh;
+    ctx->HL[0] = 0;
+    ctx->HH[0] = 0;
+
+    for (i = 4; i > 0; i >>= 1)
+    {
+        uint32_t t = (uint32_t)(vl & 1) * 0xe1000000U;
+        vl = (vh << 63) | (vl >> 1);
+        vh = (vh >> 1) ^ ((uint64_t)t << 32);
+        ctx->HL[i] = vl;
+        ctx->HH[i] = vh;
+    }
+
+    for (i = 2; i <= 8; i *= 2)
+    {
+        vh = ctx->HH[i];
+        vl = ctx->HL[i];
+        for (j = 1; j < i; j++)
+        {
+            ctx->HH[i + j] = vh ^ ctx->HH[j];
+            ctx->HL[i + j] = vl ^ ctx->HL[j];
+        }
+    }
+
+#ifdef AES_HW
+    if (ctx->aes.hw)
+        aesni_gcm_init(ctx->H, h);
+#endif
+}
+
+/**
+ * x = x * H in GF(2^128)
+ */
+static void gcm_mult(const AES_GCM_CTX *ctx, uint8_t *x)
+{
+    int i;
+    uint8_t lo, hi, rem;
+    uint64_t zh, zl;
+
+    lo = x[15] & 0xf;
+    zh = ctx->HH[lo];
+    zl = ctx->HL[lo];
+
+    for (i = 15; i >= 0; i--)
+    {
+        lo = x[i] & 0xf;
+        hi = (x[i] >> 4) & 0xf;
+
+        if (i != 15)
+        {
+            rem = (uint8_t)zl & 0xf;
+            zl = (zh << 60) | (zl >> 4);
+            zh = (zh >> 4) ^ (gcm_last4[rem] << 48);
+            zh ^= ctx->HH[lo];
+            zl ^= ctx->HL[lo];
+        }
+
+        rem = (uint8_t)zl & 0xf;
+        zl = (zh << 60) | (zl >> 4);
+        zh = (zh >> 4) ^ (gcm_last4[rem] << 48);
+        zh ^= ctx->HH[hi];
+        zl ^= ctx->HL[hi];
+    }
+
+    PUT_U32_BE((uint32_t)(zh >> 32), x, 0);
+    PUT_U32_BE((uint32_t)zh, x, 4);
+    PUT_U32_BE((uint32_t)(zl >> 32), x, 8);
+    PUT_U32_BE((uint32_t)zl, x, 12);
+}
+
+static void gcm_ghash(
+    const AES_GCM_CTX *ctx, uint8_t *y, const uint8_t *data, size_t len
+){
+    size_t i;
+
+#ifdef AES_HW
+    if (ctx->aes.hw)
+    {
+        aesni_ghash(ctx->H, y, data, len);
+        return;
+    }
+#endif
+
+    while (len > 0)
+    {
+        size_t n = len < AES_BLOCKSIZE ? len : AES_BLOCKSIZE;
+        for (i = 0; i < n; i++)
+            y[i] ^= data[i];
+        gcm_mult(ctx, y);
+        data += n;
+        len -= n;
+    }
+}
+
+static void gcm_ctr(
+    const AES_GCM_CTX *ctx, uint8_t *counter,
+    const uint8_t *in, uint8_t *out, size_t len
+){
+    size_t i;
+    size_t blocks = len / AES_BLOCKSIZE;
+    uint8_t stream[AES_BLOCKSIZE];
+
+    ctr_increment(counter, 4); /* the first block uses J0 + 1 */
+    ctr_blocks(&ctx->aes, counter, 4, in, out, blocks);
+    in += blocks * AES_BLOCKSIZE;
+    out += blocks * AES_BLOCKSIZE;
+    len -= blocks * AES_BLOCKSIZE;
+
+    if (len > 0)
+    {
+        AES_encrypt_block(&ctx->aes, counter, stream);
+        for (i = 0; i < len; i++)
+            out[i] = in[i] ^ stream[i];
+    }
+}
+
+static void gcm_tag(
+    const AES_GCM_CTX *ctx, const uint8_t *j0,
+    const uint8_t *aad, size_t aad_len,
+    const uint8_t *cipher, size_t len,
+    uint8_t *tag
+){
+    int i;
+    uint8_t y[AES_BLOCKSIZE];
+    uint8_t lens[AES_BLOCKSIZE];
+    uint64_t aad_bits = (uint64_t)aad_len * 8;
+    uint64_t len_bits = (uint64_t)len * 8;
+
+    memset(y, 0, AES_BLOCKSIZE);
+    gcm_ghash(ctx, y, aad, aad_len);
+    gcm_ghash(ctx, y, cipher, len);
+
+    PUT_U32_BE((uint32_t)(aad_bits >> 32), lens, 0);
+    PUT_U32_BE((uint32_t)aad_bits, lens, 4);
+    PUT_U32_BE((uint32_t)(len_bits >> 32), lens, 8);
+    PUT_U32_BE((uint32_t)len_bits, lens, 12);
+    gcm_ghash(ctx, y, lens, AES_BLOCKSIZE);
+
+    AES_encrypt_block(&ctx->aes, j0, tag);
+    for (i = 0; i < AES_BLOCKSIZE; i++)
+        tag[i] ^= y[i];
+}
+
+/**
+ * Encrypt len bytes and produce the 16 byte authentication tag.  The input
+ * and output may be the same buffer.
+ */
+void AES_gcm_seal(const AES_GCM_CTX *ctx, const uint8_t *iv,
+        const uint8_t *aad, size_t aad_len,
+        const uint8_t *in, uint8_t *out, size_t len, uint8_t *tag)
+{
+    uint8_t j0[AES_BLOCKSIZE];
+    uint8_t counter[AES_BLOCKSIZE];
+
+    memcpy(j0, iv, AES_GCM_IV_SIZE);
+    PUT_U32_BE(1, j0, 12);
+    memcpy(counter, j0, AES_BLOCKSIZE);
+
+    gcm_ctr(ctx, counter, in, out, len);
+    gcm_tag(ctx, j0, aad, aad_len, out, len, tag);
+}
+
+/**
+ * Check the tag and decrypt.  Returns 0 (and writes nothing) if the tag
+ * does not match.
+ */
+int AES_gcm_open(const AES_GCM_CTX *ctx, const uint8_t *iv,
+        const uint8_t *aad, size_t aad_len,
+        const uint8_t *in, uint8_t *out, size_t len, const uint8_t *tag)
+{
+    int i;
+    uint8_t diff = 0;
+    uint8_t j0[AES_BLOCKSIZE];
+    uint8_t counter[AES_BLOCKSIZE];
+    uint8_t check[AES_GCM_TAG_SIZE];
+
+    memcpy(j0, iv, AES_GCM_IV_SIZE);
+    PUT_U32_BE(1, j0, 12);
+    memcpy(counter, j0, AES_BLOCKSIZE);
+
+    gcm_tag(ctx, j0, aad, aad_len, in, len, check);
+    for (i = 0; i < AES_GCM_TAG_SIZE; i++)
+        diff |= check[i] ^ tag[i];
+    if (diff != 0)
+        return 0;
+
+    gcm_ctr(ctx, counter, in, out, len);
+    return 1;
+}
@@ -29,6 +29,7 @@
  */
 
 #include <stdint.h>  // uint{8,16,32}_t
+#include <stddef.h>  // size_t
 
 /**************************************************************************
  * AES declarations
@@ -51,8 +52,12 @@ typedef struct aes_key_st
     uint16_t rounds;
     uint16_t key_size;
     uint32_t ks[(AES_MAXROUNDS+1)*8];
-    uint8_t iv[AES_IV_SIZE];
+    uint8_t iv[AES_IV_SIZE];    /* CBC chaining value, or CTR counter */
     AES_MODE key_mode;
+    int hw;                     /* use AES-NI with the round keys in rk */
+    uint8_t rk[(AES_MAXROUNDS+1)*AES_BLOCKSIZE];
+    uint8_t ctr_stream[AES_BLOCKSIZE]; /* CTR keystream not yet used */
+    int ctr_used;
 } AES_CTX;
 
 void AES_set_key(AES_CTX *ctx, const uint8_t *key,
@@ -61,3 +66,25 @@ void AES_cbc_encrypt(AES_CTX *ctx, const uint8_t *msg,
         uint8_t *out, int length);
 void AES_cbc_decrypt(AES_CTX *ks, const uint8_t *in, uint8_t *out, int length);
 void AES_convert_key(AES_CTX *ctx);
+void AES_encrypt_block(const AES_CTX *ctx, const uint8_t *in, uint8_t *out);
+void AES_ctr_crypt(AES_CTX *ctx, const uint8_t *in, uint8_t *out, size_t len);
+int AES_hw_available(void);
+
+#define AES_GCM_IV_SIZE     12
+#define AES_GCM_TAG_SIZE    16
+
+typedef struct aes_gcm_st
+{
+    AES_CTX aes;
+    uint64_t HL[16];
+    uint64_t HH[16];
+    uint8_t H[4][AES_BLOCKSIZE];    /* H to H^4, byte reversed, for PCLMUL */
+} AES_GCM_CTX;
+
+void AES_gcm_init(AES_GCM_CTX *ctx, const uint8_t *key, int key_len);
+void AES_gcm_seal(const AES_GCM_CTX *ctx, const uint8_t *iv,
+        const uint8_t *aad, size_t aad_len,
+        const uint8_t *in, uint8_t *out, size_t len, uint8_t *tag);
+int AES_gcm_open(const AES_GCM_CTX *ctx, const uint8_t *iv,
+        const uint8_t *aad, size_t aad_len,
+        const uint8_t *in, uint8_t *out, size_t len, const uint8_t *tag);
@@ -0,0 +1,350 @@
+/*
+ * ChaCha20 and Poly1305 for IETF protocols (RFC 7539)
+ *
+ * Written for the Rebol codecs directory; placed in the public domain.
+ * The Poly1305 arithmetic follows Andrew Moon's 32-bit "donna" layout
+ * (five 26-bit limbs), which needs no 128-bit integer support.
+ */
+
+#include <string.h>
+#include "chacha20poly1305.h"
+
+#define ROTL32(v, n) (((v) << (n)) | ((v) >> (32 - (n))))
+
+#define U8TO32_LE(p) \
+    (((uint32_t)(p)[0]) | ((uint32_t)(p)[1] << 8) \
+    | ((uint32_t)(p)[2] << 16) | ((uint32_t)(p)[3] << 24))
+
+#define U32TO8_LE(p, v) \
+    do { \
+        (p)[0] = (uint8_t)(v); (p)[1] = (uint8_t)((v) >> 8); \
+        (p)[2] = (uint8_t)((v) >> 16); (p)[3] = (uint8_t)((v) >> 24); \
+    } while (0)
+
+#define QUARTERROUND(x, a, b, c, d) \
+    x[a] += x[b]; x[d] = ROTL32(x[d] ^ x[a], 16); \
+    x[c] += x[d]; x[b] = ROTL32(x[b] ^ x[c], 12); \
+    x[a] += x[b]; x[d] = ROTL32(x[d] ^ x[a], 8); \
+    x[c] += x[d]; x[b] = ROTL32(x[b] ^ x[c], 7);
+
+
+/**************************************************************************
+ * ChaCha20
+ **************************************************************************/
+
+void chacha20_init(CHACHA20_CTX *ctx, const uint8_t *key,
+        const uint8_t *nonce, uint32_t counter)
+{
+    int i;
+
+    ctx->state[0] = 0x61707865; /* "expand 32-byte k" */
+    ctx->state[1] = 0x3320646e;
+    ctx->state[2] = 0x79622d32;
+    ctx->state[3] = 0x6b206574;
+    for (i = 0; i < 8; i++)
+        ctx->state[4 + i] = U8TO32_LE(key + 4 * i);
+    ctx->state[12] = counter;
+    for (i = 0; i < 3; i++)
+        ctx->state[13 + i] = U8TO32_LE(nonce + 4 * i);
+
+    ctx->available = 0;
+}
+
+static void chacha20_block(CHACHA20_CTX *ctx)
+{
+    int i;
+    uint32_t x[16];
+
+    memcpy(x, ctx->state, sizeof(x));
+    for (i = 0; i < 10; i++)
+    {
+        QUARTERROUND(x, 0, 4, 8, 12)
+        QUARTERROUND(x, 1, 5, 9, 13)
+        QUARTERROUND(x, 2, 6, 10, 14)
+        QUARTERROUND(x, 3, 7, 11, 15)
+        QUARTERROUND(x, 0, 5, 10, 15)
+        QUARTERROUND(x, 1, 6, 11, 12)
+        QUARTERROUND(x, 2, 7, 8, 13)
+        QUARTERROUND(x, 3, 4, 9, 14)
+    }
+
+    for (i = 0; i < 16; i++)
+    {
+        uint32_t v = x[i] + ctx->state[i];
+        U32TO8_LE(ctx->stream + 4 * i, v);
+    }
+
+    ctx->state[12]++;
+    ctx->available = 64;
+}
+
+/**
+ * XOR the key stream into len bytes.  Encryption and decryption are the
+ * same operation; in and out may be the same buffer.
+ */
+void chacha20_crypt(CHACHA20_CTX *ctx, const uint8_t *in,
+        uint8_t *out, size_t len)
+{
+    size_t i;
+
+    while (len > 0)
+    {
+        const uint8_t *ks;
+        size_t n;
+
+        if (ctx->available == 0)
+            chacha20_block(ctx);
+
+        ks = ctx->stream + (64 - ctx->available);
+        n = len < ctx->available ? len : ctx->available;
+        for (i = 0; i < n; i++)
+            out[i] = in[i] ^ ks[i];
+
+        ctx->available -= n;
+        in += n;
+        out += n;
+        len -= n;
+    }
+}
+
+
+/**************************************************************************
+ * Poly1305
+ **************************************************************************/
+
+void poly1305_init(POLY1305_CTX *ctx, const uint8_t *key)
+{
+    /* r &= 0xffffffc0ffffffc0ffffffc0fffffff */
+    ctx->r[0] = (U8TO32_LE(key + 0)) & 0x3ffffff;
+    ctx->r[1] = (U8TO32_LE(key + 3) >> 2) & 0x3ffff03;
+    ctx->r[2] = (U8TO32_LE(key + 6) >> 4) & 0x3ffc0ff;
+    ctx->r[3] = (U8TO32_LE(key + 9) >> 6) & 0x3f03fff;
+    ctx->r[4] = (U8TO32_LE(key + 12) >> 8) & 0x00fffff;
+
+    memset(ctx->h, 0, sizeof(ctx->h));
+
+    ctx->pad[0] = U8TO32_LE(key + 16);
+    ctx->pad[1] = U8TO32_LE(key + 20);
+    ctx->pad[2] = U8TO32_LE(key + 24);
+    ctx->pad[3] = U8TO32_LE(key + 28);
+
+    ctx->leftover = 0;
+}
+
+static void poly1305_blocks(POLY1305_CTX *ctx, const uint8_t *m,
+        size_t len, uint32_t hibit)
+{
+    uint32_t r0 = ctx->r[0], r1 = ctx->r[1], r2 = ctx->r[2];
+    uint32_t r3 = ctx->r[3], r4 = ctx->r[4];
+    uint32_t s1 = r1 * 5, s2 = r2 * 5, s3 = r3 * 5, s4 = r4 * 5;
+    uint32_t h0 = ctx->h[0], h1 = ctx->h[1], h2 = ctx->h[2];
+    uint32_t h3 = ctx->h[3], h4 = ctx->h[4];
+
+    while (len >= 16)
+    {
+        uint64_t d0, d1, d2, d3, d4;
+        uint32_t c;
+
+        h0 += (U8TO32_LE(m + 0)) & 0x3ffffff;
+        h1 += (U8TO32_LE(m + 3) >> 2) & 0x3ffffff;
+        h2 += (U8TO32_LE(m + 6) >> 4) & 0x3ffffff;
+        h3 += (U8TO32_LE(m + 9) >> 6) & 0x3ffffff;
+        h4 += (U8TO32_LE(m + 12) >> 8) | hibit;
+
+        d0 = (uint64_t)h0 * r0 + (uint64_t)h1 * s4 + (uint64_t)h2 * s3
+            + (uint64_t)h3 * s2 + (uint64_t)h4 * s1;
+        d1 = (uint64_t)h0 * r1 + (uint64_t)h1 * r0 + (uint64_t)h2 * s4
+            + (uint64_t)h3 * s3 + (uint64_t)h4 * s2;
+        d2 = (uint64_t)h0 * r2 + (uint64_t)h1 * r1 + (uint64_t)h2 * r0
+            + (uint64_t)h3 * s4 + (uint64_t)h4 * s3;
+        d3 = (uint64_t)h0 * r3 + (uint64_t)h1 * r2 + (uint64_t)h2 * r1
+            + (uint64_t)h3 * r0 + (uint64_t)h4 * s4;
+        d4 = (uint64_t)h0 * r4 + (uint64_t)h1 * r3 + (uint64_t)h2 * r2
+            + (uint64_t)h3 * r1 + (uint64_t)h4 * r0;
+
+        c = (uint32_t)(d0 >> 26); h0 = (uint32_t)d0 & 0x3ffffff;
+        d1 += c; c = (uint32_t)(d1 >> 26); h1 = (uint32_t)d1 & 0x3ffffff;
+        d2 += c; c = (uint32_t)(d2 >> 26); h2 = (uint32_t)d2 & 0x3ffffff;
+        d3 += c; c = (uint32_t)(d3 >> 26); h3 = (uint32_t)d3 & 0x3ffffff;
+        d4 += c; c = (uint32_t)(d4 >> 26); h4 = (uint32_t)d4 & 0x3ffffff;
+        h0 += c * 5; c = h0 >> 26; h0 &= 0x3ffffff;
+        h1 += c;
+
+        m += 16;
+        len -= 16;
+    }
+
+    ctx->h[0] = h0;
+    ctx->h[1] = h1;
+    ctx->h[2] = h2;
+    ctx->h[3] = h3;
+    ctx->h[4] = h4;
+}
+
+void poly1305_update(POLY1305_CTX *ctx, const uint8_t *data, size_t len)
+{
+    size_t i;
+
+    if (ctx->leftover)
+    {
+        size_t want = 16 - ctx->leftover;
+        if (want > len)
+            want = len;
+        for (i = 0; i < want; i++)
+            ctx->buffer[ctx->leftover + i] = data[i];
+        len -= want;
+        data += want;
+        ctx->leftover += want;
+        if (ctx->leftover < 16)
+            return;
+        poly1305_blocks(ctx, ctx->buffer, 16, 1 << 24);
+        ctx->leftover = 0;
+    }
+
+    if (len >= 16)
+    {
+        size_t want = len & ~(size_t)15;
+        poly1305_blocks(ctx, data, want, 1 << 24);
+        data += want;
+        len -= want;
+    }
+
+    for (i = 0; i < len; i++)
+        ctx->buffer[ctx->leftover + i] = data[i];
+    ctx->leftover += len;
+}
+
+void poly1305_finish(POLY1305_CTX *ctx, uint8_t *mac)
+{
+    uint32_t h0, h1, h2, h3, h4, c;
+    uint32_t g0, g1, g2, g3, g4;
+    uint64_t f;
+    uint32_t mask;
+
+    if (ctx->leftover)
+    {
+        size_t i = ctx->leftover;
+        ctx->buffer[i++] = 1;
+        for (; i < 16; i++)
+            ctx->buffer[i] = 0;
+        poly1305_blocks(ctx, ctx->buffer, 16, 0);
+    }
+
+    h0 = ctx->h[0]; h1 = ctx->h[1]; h2 = ctx->h[2];
+    h3 = ctx->h[3]; h4 = ctx->h[4];
+
+    /* fully carry h */
+    c = h1 >> 26; h1 &= 0x3ffffff;
+    h2 += c; c = h2 >> 26; h2 &= 0x3ffffff;
+    h3 += c; c = h3 >> 26; h3 &= 0x3ffffff;
+    h4 += c; c = h4 >> 26; h4 &= 0x3ffffff;
+    h0 += c * 5; c = h0 >> 26; h0 &= 0x3ffffff;
+    h1 += c;
+
+    /* compute h + -p */
+    g0 = h0 + 5; c = g0 >> 26; g0 &= 0x3ffffff;
+    g1 = h1 + c; c = g1 >> 26; g1 &= 0x3ffffff;
+    g2 = h2 + c; c = g2 >> 26; g2 &= 0x3ffffff;
+    g3 = h3 + c; c = g3 >> 26; g3 &= 0x3ffffff;
+    g4 = h4 + c - (1UL << 26);
+
+    /* select h if h < p, or h + -p if h >= p */
+    mask = (g4 >> 31) - 1;
+    g0 &= mask; g1 &= mask; g2 &= mask; g3 &= mask; g4 &= mask;
+    mask = ~mask;
+    h0 = (h0 & mask) | g0;
+    h1 = (h1 & mask) | g1;
+    h2 = (h2 & mask) | g2;
+    h3 = (h3 & mask) | g3;
+    h4 = (h4 & mask) | g4;
+
+    /* h = h % (2^128) */
+    h0 = (h0 | (h1 << 26)) & 0xffffffff;
+    h1 = ((h1 >> 6) | (h2 << 20)) & 0xffffffff;
+    h2 = ((h2 >> 12) | (h3 << 14)) & 0xffffffff;
+    h3 = ((h3 >> 18) | (h4 << 8)) & 0xffffffff;
+
+    /* mac = (h + pad) % (2^128) */
+    f = (uint64_t)h0 + ctx->pad[0]; h0 = (uint32_t)f;
+    f = (uint64_t)h1 + ctx->pad[1] + (f >> 32); h1 = (uint32_t)f;
+    f = (uint64_t)h2 + ctx->pad[2] + (f >> 32); h2 = (uint32_t)f;
+    f = (uint64_t)h3 + ctx->pad[3] + (f >> 32); h3 = (uint32_t)f;
+
+    U32TO8_LE(mac + 0, h0);
+    U32TO8_LE(mac + 4, h1);
+    U32TO8_LE(mac + 8, h2);
+    U32TO8_LE(mac + 12, h3);
+
+    memset(ctx, 0, sizeof(*ctx));
+}
+
+
+/**************************************************************************
+ * AEAD construction
+ **************************************************************************/
+
+static void aead_tag(const uint8_t *key, const uint8_t *nonce,
+        const uint8_t *aad, size_t aad_len,
+        const uint8_t *cipher, size_t len, uint8_t *tag)
+{
+    static const uint8_t zeros[16] = {0};
+    uint8_t otk[64];
+    uint8_t lens[16];
+    CHACHA20_CTX chacha;
+    POLY1305_CTX poly;
+
+    /* one-time Poly1305 key is the first half of block 0 */
+    memset(otk, 0, sizeof(otk));
+    chacha20_init(&chacha, key, nonce, 0);
+    chacha20_crypt(&chacha, otk, otk, sizeof(otk));
+
+    poly1305_init(&poly, otk);
+    poly1305_update(&poly, aad, aad_len);
+    poly1305_update(&poly, zeros, (16 - aad_len % 16) % 16);
+    poly1305_update(&poly, cipher, len);
+    poly1305_update(&poly, zeros, (16 - len % 16) % 16);
+
+    U32TO8_LE(lens + 0, (uint32_t)aad_len);
+    U32TO8_LE(lens + 4, (uint32_t)((uint64_t)aad_len >> 32));
+    U32TO8_LE(lens + 8, (uint32_t)len);
+    U32TO8_LE(lens + 12, (uint32_t)((uint64_t)len >> 32));
+    poly1305_update(&poly, lens, 16);
+    poly1305_finish(&poly, tag);
+
+    memset(otk, 0, sizeof(otk));
+    memset(&chacha, 0, sizeof(chacha));
+}
+
+void chacha20poly1305_seal(const uint8_t *key, const uint8_t *nonce,
+        const uint8_t *aad, size_t aad_len,
+        const uint8_t *in, uint8_t *out, size_t len, uint8_t *tag)
+{
+    CHACHA20_CTX chacha;
+
+    chacha20_init(&chacha, key, nonce, 1);
+    chacha20_crypt(&chacha, in, out, len);
+    memset(&chacha, 0, sizeof(chacha));
+
+    aead_tag(key, nonce, aad, aad_len, out, len, tag);
+}
+
+int chacha20poly1305_open(const uint8_t *key, const uint8_t *nonce,
+        const uint8_t *aad, size_t aad_len,
+        const uint8_t *in, uint8_t *out, size_t len, const uint8_t *tag)
+{
+    int i;
+    uint8_t diff = 0;
+    uint8_t check[POLY1305_TAG_SIZE];
+    CHACHA20_CTX chacha;
+
+    aead_tag(key, nonce, aad, aad_len, in, len, check);
+    for (i = 0; i < POLY1305_TAG_SIZE; i++)
+        diff |= check[i] ^ tag[i];
+    if (diff != 0)
+        return 0;
+
+    chacha20_init(&chacha, key, nonce, 1);
+    chacha20_crypt(&chacha, in, out, len);
+    memset(&chacha, 0, sizeof(chacha));
+    return 1;
+}
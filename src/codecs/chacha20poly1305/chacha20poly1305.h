@@ -0,0 +1,51 @@
+/*
+ * ChaCha20 and Poly1305 for IETF protocols (RFC 7539)
+ *
+ * Written for the Rebol codecs directory; placed in the public domain.
+ * The Poly1305 arithmetic follows Andrew Moon's 32-bit "donna" layout
+ * (five 26-bit limbs), which needs no 128-bit integer support.
+ */
+
+#include <stdint.h>  // uint{8,32,64}_t
+#include <stddef.h>  // size_t
+
+#define CHACHA20_KEY_SIZE       32
+#define CHACHA20_NONCE_SIZE     12
+#define POLY1305_TAG_SIZE       16
+
+typedef struct chacha20_st
+{
+    uint32_t state[16];
+    uint8_t stream[64];
+    size_t available;  /* unused bytes left in stream */
+} CHACHA20_CTX;
+
+void chacha20_init(CHACHA20_CTX *ctx, const uint8_t *key,
+        const uint8_t *nonce, uint32_t counter);
+void chacha20_crypt(CHACHA20_CTX *ctx, const uint8_t *in,
+        uint8_t *out, size_t len);
+
+typedef struct poly1305_st
+{
+    uint32_t r[5];
+    uint32_t h[5];
+    uint32_t pad[4];
+    uint8_t buffer[16];
+    size_t leftover;
+} POLY1305_CTX;
+
+void poly1305_init(POLY1305_CTX *ctx, const uint8_t *key);
+void poly1305_update(POLY1305_CTX *ctx, const uint8_t *data, size_t len);
+void poly1305_finish(POLY1305_CTX *ctx, uint8_t *mac);
+
+/*
+ * AEAD_CHACHA20_POLY1305 (RFC 7539 section 2.8).  The output of seal is
+ * the same length as the input, with the tag written separately.  Open
+ * returns 0 if the tag does not verify, in which case nothing is written.
+ */
+void chacha20poly1305_seal(const uint8_t *key, const uint8_t *nonce,
+        const uint8_t *aad, size_t aad_len,
+        const uint8_t *in, uint8_t *out, size_t len, uint8_t *tag);
+int chacha20poly1305_open(const uint8_t *key, const uint8_t *nonce,
+        const uint8_t *aad, size_t aad_len,
+        const uint8_t *in, uint8_t *out, size_t len, const uint8_t *tag);
@@ -5,19 +5,28 @@ The code uses Bigint implementation Copyright (c) 2007, Cameron Rich
 
 #include "dh.h"
 #include "rsa/rsa.h"
+#include "mont64/mont64.h"
 
 void DH_generate_key(DH_CTX *dh_ctx)
 {
-    BI_CTX *bi_ctx = bi_initialize();
+    BI_CTX *bi_ctx;
     int len = dh_ctx->len;
-    bigint *p = bi_import(bi_ctx, dh_ctx->p, len); //p modulus
-    bigint *g = bi_import(bi_ctx, dh_ctx->g, dh_ctx->glen); //generator
-    bigint *x, *gx;
-
-    bi_permanent(g);
+    bigint *p, *g, *x, *gx;
 
     //generate private key  X
     get_random_NZ(len, dh_ctx->x);
+
+    //constant-time gx = g^x mod p, if p is odd (it is for any real group)
+    if (mont64_mod_exp(
+        dh_ctx->gx, dh_ctx->g, dh_ctx->glen, dh_ctx->x, len, dh_ctx->p, len
+    ) == 0)
+        return;
+
+    bi_ctx = bi_initialize();
+    p = bi_import(bi_ctx, dh_ctx->p, len); //p modulus
+    g = bi_import(bi_ctx, dh_ctx->g, dh_ctx->glen); //generator
+    bi_permanent(g);
+
     x = bi_import(bi_ctx, dh_ctx->x, len);
     bi_permanent(x);
 
@@ -43,13 +52,22 @@ void DH_generate_key(DH_CTX *dh_ctx)
 
 void DH_compute_key(DH_CTX *dh_ctx)
 {
-    BI_CTX *bi_ctx = bi_initialize();
+    BI_CTX *bi_ctx;
     int len = dh_ctx->len;
-    bigint *p = bi_import(bi_ctx, dh_ctx->p, len); //p modulus
-    bigint *x = bi_import(bi_ctx, dh_ctx->x, len); //private key
-    bigint *gy = bi_import(bi_ctx, dh_ctx->gy, len);  //public key(peer)
+    bigint *p, *x, *gy;
     bigint *k;                                      //negotiated(session) key
 
+    //constant-time k = gy^x mod p, if p is odd
+    if (mont64_mod_exp(
+        dh_ctx->k, dh_ctx->gy, len, dh_ctx->x, len, dh_ctx->p, len
+    ) == 0)
+        return;
+
+    bi_ctx = bi_initialize();
+    p = bi_import(bi_ctx, dh_ctx->p, len); //p modulus
+    x = bi_import(bi_ctx, dh_ctx->x, len); //private key
+    gy = bi_import(bi_ctx, dh_ctx->gy, len);  //public key(peer)
+
     bi_permanent(x);
     bi_permanent(gy);
 
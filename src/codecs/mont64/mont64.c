@@ -0,0 +1,483 @@
+/*
+ * Modular exponentiation for RSA and Diffie-Hellman
+ *
+ * Written for the Rebol codecs directory; placed in the public domain.
+ * See mont64.h for the interface.
+ *
+ * Montgomery form of x is xR mod m, with R = 2^(bits per limb * limbs in m).
+ * mont_mul() of two numbers in that form gives their product in that form,
+ * reducing with multiplies and adds instead of division ("CIOS" method from
+ * Koc, Acar and Kaliski, "Analyzing and Comparing Montgomery Multiplication
+ * Algorithms", 1996).
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "mont64.h"
+
+#if defined(__SIZEOF_INT128__)
+    typedef uint64_t limb;
+    typedef unsigned __int128 dlimb;
+    #define LIMB_BITS 64
+#else
+    typedef uint32_t limb;
+    typedef uint64_t dlimb;
+    #define LIMB_BITS 32
+#endif
+
+#define LIMB_BYTES (LIMB_BITS / 8)
+
+#define WINDOW_BITS 4
+#define WINDOW_SIZE (1 << WINDOW_BITS)
+
+typedef struct {
+    int n;          /* number of limbs in the modulus */
+    limb m0inv;     /* -1/m mod 2^LIMB_BITS */
+    limb *m;        /* the modulus (n limbs, least significant first) */
+    limb *rr;       /* R^2 mod m */
+    limb *one;      /* 1 */
+    limb *t;        /* n + 2 limbs of scratch for mont_mul() */
+    limb *mem;      /* allocation holding all of the above */
+} MONT;
+
+
+/*
+ * All ones if x is 0, otherwise 0 (without branching on x).
+ */
+static limb mask_if_zero(limb x)
+{
+    return ((x | (0 - x)) >> (LIMB_BITS - 1)) - 1;
+}
+
+/*
+ * Clear memory that held secrets, in a way the compiler can't drop.
+ */
+static void wipe(limb *x, int n)
+{
+    volatile limb *v = x;
+    while (n-- > 0)
+        *v++ = 0;
+}
+
+/*
+ * Skip leading zero bytes (the lengths of numbers are not secret).
+ */
+static const uint8_t *strip(const uint8_t *b, int *len)
+{
+    while (*len > 0 && *b == 0) {
+        ++b;
+        --*len;
+    }
+    return b;
+}
+
+static int limbs_for(int len)
+{
+    int n = (len + LIMB_BYTES - 1) / LIMB_BYTES;
+    return n == 0 ? 1 : n;
+}
+
+/*
+ * Big-endian bytes to n limbs.  The bytes must fit.
+ */
+static void import_be(limb *x, int n, const uint8_t *b, int len)
+{
+    int k;
+    memset(x, 0, n * sizeof(limb));
+    for (k = 0; k < len; ++k)
+        x[k / LIMB_BYTES] |= (limb)b[len - 1 - k] << (8 * (k % LIMB_BYTES));
+}
+
+/*
+ * n limbs to len big-endian bytes (zero padded, or truncated at the top).
+ */
+static void export_be(uint8_t *b, int len, const limb *x, int n)
+{
+    int k;
+    for (k = 0; k < len; ++k) {
+        int i = k / LIMB_BYTES;
+        b[len - 1 - k] = i < n
+            ? (uint8_t)(x[i] >> (8 * (k % LIMB_BYTES)))
+            : 0;
+    }
+}
+
+/*
+ * r = a + b, returning the carry.  (r may be a or b)
+ */
+static limb add_n(limb *r, const limb *a, const limb *b, int n)
+{
+    limb carry = 0;
+    int i;
+    for (i = 0; i < n; ++i) {
+        dlimb s = (dlimb)a[i] + b[i] + carry;
+        r[i] = (limb)s;
+        carry = (limb)(s >> LIMB_BITS);
+    }
+    return carry;
+}
+
+/*
+ * r = a - b, returning the borrow.  (r may be a or b)
+ */
+static limb sub_n(limb *r, const limb *a, const limb *b, int n)
+{
+    limb borrow = 0;
+    int i;
+    for (i = 0; i < n; ++i) {
+        dlimb d = (dlimb)a[i] - b[i] - borrow;
+        r[i] = (limb)d;
+        borrow = (limb)(d >> LIMB_BITS) & 1;
+    }
+    return borrow;
+}
+
+/*
+ * r = (mask ? a : r)
+ */
+static void select_n(limb *r, const limb *a, limb mask, int n)
+{
+    int i;
+    for (i = 0; i < n; ++i)
+        r[i] = (a[i] & mask) | (r[i] & ~mask);
+}
+
+/*
+ * Given x = (hi:x) < 2m, set x to x mod m.  `tmp` is n limbs.
+ */
+static void reduce_once(const MONT *M, limb *x, limb hi, limb *tmp)
+{
+    limb borrow = sub_n(tmp, x, M->m, M->n);
+
+    /* x - m is right unless it went negative (borrow, and no high limb) */
+    select_n(x, tmp, ~(mask_if_zero(hi) & (0 - borrow)), M->n);
+}
+
+/*
+ * r = a * b / R mod m, for a * b < m * R.  r may be a or b.
+ */
+static void mont_mul(const MONT *M, limb *r, const limb *a, const limb *b)
+{
+    int n = M->n;
+    const limb *m = M->m;
+    limb *t = M->t;
+    int i, j;
+
+    memset(t, 0, (n + 2) * sizeof(limb));
+
+    for (i = 0; i < n; ++i) {
+        dlimb c = 0;
+        limb u;
+
+        /* t += a * b[i] */
+        for (j = 0; j < n; ++j) {
+            c += (dlimb)a[j] * b[i] + t[j];
+            t[j] = (limb)c;
+            c >>= LIMB_BITS;
+        }
+        c += t[n];
+        t[n] = (limb)c;
+        t[n + 1] = (limb)(c >> LIMB_BITS);
+
+        /* t = (t + u * m) / 2^LIMB_BITS, with u making the low limb 0 */
+        u = t[0] * M->m0inv;
+        c = (dlimb)u * m[0] + t[0];
+        c >>= LIMB_BITS;
+        for (j = 1; j < n; ++j) {
+            c += (dlimb)u * m[j] + t[j];
+            t[j - 1] = (limb)c;
+            c >>= LIMB_BITS;
+        }
+        c += t[n];
+        t[n - 1] = (limb)c;
+        t[n] = t[n + 1] + (limb)(c >> LIMB_BITS);
+    }
+
+    /* t < 2m, so at most one subtraction of m is needed */
+    {
+        limb hi = t[n];
+        memcpy(r, t, n * sizeof(limb));
+        reduce_once(M, r, hi, t);
+    }
+}
+
+/*
+ * r = a + b mod m, for a, b < m.  `tmp` is n limbs.
+ */
+static void mod_add(const MONT *M, limb *r, const limb *a, const limb *b,
+                    limb *tmp)
+{
+    limb carry = add_n(r, a, b, M->n);
+    reduce_once(M, r, carry, tmp);
+}
+
+/*
+ * r = a - b mod m, for a, b < m.  `tmp` is n limbs.
+ */
+static void mod_sub(const MONT *M, limb *r, const limb *a, const limb *b,
+                    limb *tmp)
+{
+    limb borrow = sub_n(r, a, b, M->n);
+    add_n(tmp, r, M->m, M->n);
+    select_n(r, tmp, 0 - borrow, M->n);
+}
+
+/*
+ * Set up for arithmetic mod m.  Returns -1 for moduli that aren't odd or
+ * are too small to be worth it.
+ */
+static int mont_init(MONT *M, const uint8_t *m, int m_len)
+{
+    int n, i;
+    limb inv, carry, borrow;
+
+    m = strip(m, &m_len);
+    if (m_len == 0 || (m[m_len - 1] & 1) == 0)
+        return -1;
+    if (m_len == 1 && m[0] == 1)
+        return -1;
+
+    n = limbs_for(m_len);
+    M->n = n;
+    M->mem = (limb*)malloc((4 * n + 2) * sizeof(limb));
+    if (!M->mem)
+        return -1;
+    M->m = M->mem;
+    M->rr = M->m + n;
+    M->one = M->rr + n;
+    M->t = M->one + n;  /* n + 2 limbs */
+
+    import_be(M->m, n, m, m_len);
+    memset(M->one, 0, n * sizeof(limb));
+    M->one[0] = 1;
+
+    /* Newton's iteration doubles the correct low bits of 1/m each step */
+    inv = 1;
+    for (i = 0; i < 6; ++i)
+        inv *= 2 - M->m[0] * inv;
+    M->m0inv = 0 - inv;
+
+    /* R^2 mod m, by doubling 1 (less than m) 2 * LIMB_BITS * n times */
+    memcpy(M->rr, M->one, n * sizeof(limb));
+    for (i = 0; i < 2 * LIMB_BITS * n; ++i) {
+        carry = add_n(M->rr, M->rr, M->rr, n);
+        borrow = sub_n(M->t, M->rr, M->m, n);
+        select_n(M->rr, M->t, ~(mask_if_zero(carry) & (0 - borrow)), n);
+    }
+
+    return 0;
+}
+
+static void mont_free(MONT *M)
+{
+    wipe(M->mem, 4 * M->n + 2);
+    free(M->mem);
+}
+
+/*
+ * r = x * R mod m, for x of up to 2n limbs.  `tmp` is n limbs.
+ *
+ * With x = hi * R + lo, that's lo * R + hi * R^2, and each part is a
+ * Montgomery multiply by R^2 (which is less than m, so the products are
+ * less than m * R as mont_mul() needs).
+ */
+static void to_mont_wide(const MONT *M, limb *r, const limb *x, int xn,
+                         limb *tmp)
+{
+    int n = M->n;
+
+    mont_mul(M, r, x, M->rr);
+    if (xn > n) {
+        mont_mul(M, tmp, x + n, M->rr);
+        mont_mul(M, tmp, tmp, M->rr);
+        mod_add(M, r, r, tmp, M->t);
+    }
+}
+
+/*
+ * r = a^exp (all in Montgomery form), with exp as big-endian bytes.
+ * `table` is (WINDOW_SIZE + 1) * n limbs, the last n for the lookup.
+ *
+ * Every bit of the exponent costs the same squarings and multiply, and
+ * each lookup reads the whole table, so neither the sequence of operations
+ * nor the memory accessed depends on the exponent's value.
+ */
+static void mont_pow(const MONT *M, limb *r, const limb *a,
+                     const uint8_t *exp, int exp_len, limb *table)
+{
+    int n = M->n;
+    limb *pick = table + WINDOW_SIZE * n;
+    int i, j, k;
+
+    /* table[k] = a^k */
+    mont_mul(M, table, M->one, M->rr);
+    memcpy(table + n, a, n * sizeof(limb));
+    for (k = 2; k < WINDOW_SIZE; ++k)
+        mont_mul(M, table + k * n, table + (k - 1) * n, a);
+
+    memcpy(r, table, n * sizeof(limb));
+
+    for (i = 0; i < exp_len; ++i) {
+        for (j = 8 - WINDOW_BITS; j >= 0; j -= WINDOW_BITS) {
+            limb bits = (exp[i] >> j) & (WINDOW_SIZE - 1);
+
+            for (k = 0; k < WINDOW_BITS; ++k)
+                mont_mul(M, r, r, r);
+
+            memset(pick, 0, n * sizeof(limb));
+            for (k = 0; k < WINDOW_SIZE; ++k)
+                select_n(pick, table + k * n, mask_if_zero(bits ^ k), n);
+            mont_mul(M, r, r, pick);
+        }
+    }
+}
+
+
+/*
+ * out = base^exp mod m
+ */
+int mont64_mod_exp(
+    uint8_t *out,
+    const uint8_t *base, int base_len,
+    const uint8_t *exp, int exp_len,
+    const uint8_t *m, int m_len
+){
+    MONT M;
+    limb *work;
+    limb *x, *acc, *table;
+    int n, xn, size;
+
+    if (mont_init(&M, m, m_len) != 0)
+        return -1;
+    n = M.n;
+
+    base = strip(base, &base_len);
+    xn = limbs_for(base_len);
+    if (xn > 2 * n) {
+        mont_free(&M);
+        return -1;
+    }
+
+    size = (2 * n) + n + ((WINDOW_SIZE + 1) * n);
+    work = (limb*)malloc(size * sizeof(limb));
+    if (!work) {
+        mont_free(&M);
+        return -1;
+    }
+    x = work;
+    acc = x + 2 * n;
+    table = acc + n;
+
+    import_be(x, 2 * n, base, base_len);
+    to_mont_wide(&M, x, x, 2 * n, acc);
+    mont_pow(&M, acc, x, exp, exp_len, table);
+    mont_mul(&M, acc, acc, M.one);
+
+    export_be(out, m_len, acc, n);
+
+    wipe(work, size);
+    free(work);
+    mont_free(&M);
+    return 0;
+}
+
+
+/*
+ * out = c^d mod p*q, by the Chinese Remainder Theorem:
+ *
+ *     m1 = c^dP mod p
+ *     m2 = c^dQ mod q
+ *     h = qInv * (m1 - m2) mod p
+ *     out = m2 + h * q
+ */
+int mont64_rsa_crt(
+    uint8_t *out, int out_len,
+    const uint8_t *c, int c_len,
+    const uint8_t *p, int p_len,
+    const uint8_t *q, int q_len,
+    const uint8_t *dP, int dP_len,
+    const uint8_t *dQ, int dQ_len,
+    const uint8_t *qInv, int qInv_len
+){
+    MONT P, Q;
+    limb *work;
+    limb *x, *m1, *m2, *h, *qn, *tmp, *table;
+    int n, i, j, size;
+    int result = -1;
+
+    if (mont_init(&P, p, p_len) != 0)
+        return -1;
+    if (mont_init(&Q, q, q_len) != 0) {
+        mont_free(&P);
+        return -1;
+    }
+
+    n = P.n;
+    c = strip(c, &c_len);
+    qInv = strip(qInv, &qInv_len);
+    if (
+        Q.n != n
+        || limbs_for(c_len) > 2 * n
+        || limbs_for(qInv_len) > n
+    ){
+        goto done;
+    }
+
+    size = (2 * n) + (5 * n) + ((WINDOW_SIZE + 1) * n);
+    work = (limb*)malloc(size * sizeof(limb));
+    if (!work)
+        goto done;
+    x = work;           /* 2n: c, then m2 + h * q */
+    m1 = x + 2 * n;
+    m2 = m1 + n;
+    h = m2 + n;
+    qn = h + n;
+    tmp = qn + n;
+    table = tmp + n;
+
+    import_be(x, 2 * n, c, c_len);
+
+    /* m1 = c^dP mod p, left in Montgomery form */
+    to_mont_wide(&P, m1, x, 2 * n, tmp);
+    mont_pow(&P, m1, m1, dP, dP_len, table);
+
+    /* m2 = c^dQ mod q */
+    to_mont_wide(&Q, m2, x, 2 * n, tmp);
+    mont_pow(&Q, m2, m2, dQ, dQ_len, table);
+    mont_mul(&Q, m2, m2, Q.one);
+
+    /* h = (m1 - m2) * qInv mod p; m2 < q < R, so it can go to p's form */
+    to_mont_wide(&P, h, m2, n, tmp);
+    mod_sub(&P, h, m1, h, tmp);
+    import_be(tmp, n, qInv, qInv_len);
+    mont_mul(&P, h, h, tmp);  /* (m1 - m2)R * qInv / R */
+
+    /* x = m2 + h * q (less than p * q, so no carry out of 2n limbs) */
+    memcpy(qn, Q.m, n * sizeof(limb));
+    memset(x, 0, 2 * n * sizeof(limb));
+    memcpy(x, m2, n * sizeof(limb));
+    for (i = 0; i < n; ++i) {
+        dlimb carry = 0;
+        for (j = 0; j < n; ++j) {
+            carry += (dlimb)h[i] * qn[j] + x[i + j];
+            x[i + j] = (limb)carry;
+            carry >>= LIMB_BITS;
+        }
+        for (j = i + n; j < 2 * n; ++j) {
+            carry += x[j];
+            x[j] = (limb)carry;
+            carry >>= LIMB_BITS;
+        }
+    }
+
+    export_be(out, out_len, x, 2 * n);
+    result = 0;
+
+    wipe(work, size);
+    free(work);
+
+done:
+    mont_free(&Q);
+    mont_free(&P);
+    return result;
+}
@@ -0,0 +1,43 @@
+/*
+ * Modular exponentiation for RSA and Diffie-Hellman
+ *
+ * Written for the Rebol codecs directory; placed in the public domain.
+ * Numbers are arrays of 64-bit limbs multiplied with unsigned __int128 (or
+ * 32-bit limbs with uint64_t products where that isn't available).  Products
+ * are reduced with Montgomery multiplication, and exponentiation uses a
+ * fixed 4-bit window with table lookups that touch every entry, so the time
+ * taken depends only on the sizes of the numbers, not their values.
+ *
+ * All numbers are unsigned big-endian byte strings, as in the key objects.
+ * The modulus must be odd (true of RSA moduli and primes, and DH primes).
+ * The functions return 0 on success, or -1 if given input they don't handle
+ * (even modulus, or CRT primes of different sizes), in which case callers
+ * can fall back on the general bigint code.
+ */
+
+#include <stdint.h>  // uint8_t
+
+/*
+ * out = base^exp mod m, written as m_len bytes.  The base may be any size.
+ */
+int mont64_mod_exp(
+    uint8_t *out,
+    const uint8_t *base, int base_len,
+    const uint8_t *exp, int exp_len,
+    const uint8_t *m, int m_len
+);
+
+/*
+ * RSA private operation with the Chinese Remainder Theorem: given c < p*q,
+ * out = c^d mod p*q, computed from c^dP mod p and c^dQ mod q and written
+ * as out_len bytes.
+ */
+int mont64_rsa_crt(
+    uint8_t *out, int out_len,
+    const uint8_t *c, int c_len,
+    const uint8_t *p, int p_len,
+    const uint8_t *q, int q_len,
+    const uint8_t *dP, int dP_len,
+    const uint8_t *dQ, int dQ_len,
+    const uint8_t *qInv, int qInv_len
+);
@@ -46,13 +46,14 @@
 #endif
 
 #include "rsa.h"
+#include "../mont64/mont64.h"
 
 
 // Initialized by Init_Core_Ext() and released by Shutdown_Core_Ext()
 #ifdef TO_WINDOWS
-    HCRYPTPROV gCryptProv = 0;
+    RNG_THREAD_LOCAL HCRYPTPROV gCryptProv = 0;
 #else
-    int rng_fd = -1;
+    RNG_THREAD_LOCAL int rng_fd = -1;
 #endif
 
 /**
@@ -92,6 +93,27 @@ void get_random_NZ(int num_rand_bytes, uint8_t *rand_data)
     }
 }
 
+/**
+ * Keep a copy of a key number's bytes for the mont64 code.
+ */
+static void keep_octets(RSA_OCTETS *o, const uint8_t *data, int len)
+{
+    o->data = (uint8_t *)malloc(len > 0 ? len : 1);
+    if (o->data == NULL)
+        return; /* RSA_mont64() will decline, and the bigint code is used */
+    memcpy(o->data, data, len);
+    o->len = len;
+}
+
+static void free_octets(RSA_OCTETS *o)
+{
+    if (o->data == NULL)
+        return;
+    memset(o->data, 0, o->len);
+    free(o->data);
+    o->data = NULL;
+}
+
 void RSA_priv_key_new(RSA_CTX **ctx,
         const uint8_t *modulus, int mod_len,
         const uint8_t *pub_exp, int pub_len,
@@ -112,6 +134,7 @@ void RSA_priv_key_new(RSA_CTX **ctx,
     bi_ctx = rsa_ctx->bi_ctx;
     rsa_ctx->d = bi_import(bi_ctx, priv_exp, priv_len);
     bi_permanent(rsa_ctx->d);
+    keep_octets(&rsa_ctx->raw_d, priv_exp, priv_len);
 
 #ifdef CONFIG_BIGINT_CRT
     if (dP && dQ && p && q && qInv)
@@ -126,6 +149,11 @@ void RSA_priv_key_new(RSA_CTX **ctx,
         bi_permanent(rsa_ctx->qInv);
         bi_set_mod(bi_ctx, rsa_ctx->p, BIGINT_P_OFFSET);
         bi_set_mod(bi_ctx, rsa_ctx->q, BIGINT_Q_OFFSET);
+        keep_octets(&rsa_ctx->raw_p, p, p_len);
+        keep_octets(&rsa_ctx->raw_q, q, q_len);
+        keep_octets(&rsa_ctx->raw_dP, dP, dP_len);
+        keep_octets(&rsa_ctx->raw_dQ, dQ, dQ_len);
+        keep_octets(&rsa_ctx->raw_qInv, qInv, qInv_len);
     }
 #endif
 }
@@ -149,6 +177,8 @@ void RSA_pub_key_new(RSA_CTX **ctx,
     bi_set_mod(bi_ctx, rsa_ctx->m, BIGINT_M_OFFSET);
     rsa_ctx->e = bi_import(bi_ctx, pub_exp, pub_len);
     bi_permanent(rsa_ctx->e);
+    keep_octets(&rsa_ctx->raw_m, modulus, mod_len);
+    keep_octets(&rsa_ctx->raw_e, pub_exp, pub_len);
 }
 
 /**
@@ -185,10 +215,65 @@ void RSA_free(RSA_CTX *rsa_ctx)
 #endif
     }
 
+    free_octets(&rsa_ctx->raw_m);
+    free_octets(&rsa_ctx->raw_e);
+    free_octets(&rsa_ctx->raw_d);
+#ifdef CONFIG_BIGINT_CRT
+    free_octets(&rsa_ctx->raw_p);
+    free_octets(&rsa_ctx->raw_q);
+    free_octets(&rsa_ctx->raw_dP);
+    free_octets(&rsa_ctx->raw_dQ);
+    free_octets(&rsa_ctx->raw_qInv);
+#endif
+
     bi_terminate(bi_ctx);
     free(rsa_ctx);
 }
 
+/**
+ * Performs out = in^d mod n (is_private) or out = in^e mod n with the
+ * constant-time mont64 code, with in and out both num_octets long (they may
+ * be the same buffer).  Returns -1 if that code can't be used, in which case
+ * out is untouched and the caller should use RSA_private() or RSA_public().
+ */
+static int RSA_mont64(const RSA_CTX *ctx, const uint8_t *in, uint8_t *out,
+        int is_private)
+{
+    const int byte_size = ctx->num_octets;
+
+    if (ctx->raw_m.data == NULL)
+        return -1;
+
+    if (!is_private)
+    {
+        if (ctx->raw_e.data == NULL)
+            return -1;
+        return mont64_mod_exp(out, in, byte_size,
+                ctx->raw_e.data, ctx->raw_e.len,
+                ctx->raw_m.data, ctx->raw_m.len);
+    }
+
+#ifdef CONFIG_BIGINT_CRT
+    if (ctx->dP && ctx->raw_p.data && ctx->raw_q.data && ctx->raw_dP.data
+            && ctx->raw_dQ.data && ctx->raw_qInv.data)
+    {
+        if (mont64_rsa_crt(out, byte_size, in, byte_size,
+                ctx->raw_p.data, ctx->raw_p.len,
+                ctx->raw_q.data, ctx->raw_q.len,
+                ctx->raw_dP.data, ctx->raw_dP.len,
+                ctx->raw_dQ.data, ctx->raw_dQ.len,
+                ctx->raw_qInv.data, ctx->raw_qInv.len) == 0)
+            return 0;
+    }
+#endif
+
+    if (ctx->raw_d.data == NULL)
+        return -1;
+    return mont64_mod_exp(out, in, byte_size,
+            ctx->raw_d.data, ctx->raw_d.len,
+            ctx->raw_m.data, ctx->raw_m.len);
+}
+
 /**
  * @brief Use PKCS1.5 for decryption/verification.
  * @param ctx [in] The context
@@ -209,16 +294,23 @@ int RSA_decrypt(const RSA_CTX *ctx, const uint8_t *in_data,
     memset(out_data, 0, byte_size); /* initialise */
 
     /* decrypt */
-    dat_bi = bi_import(ctx->bi_ctx, in_data, byte_size);
 #ifdef CONFIG_SSL_CERT_VERIFICATION
-    decrypted_bi = is_decryption ?  /* decrypt or verify? */
-            RSA_private(ctx, dat_bi) : RSA_public(ctx, dat_bi);
+    if (RSA_mont64(ctx, in_data, block, is_decryption) != 0)
+#else   /* always a decryption */
+    if (RSA_mont64(ctx, in_data, block, 1) != 0)
+#endif
+    {
+        dat_bi = bi_import(ctx->bi_ctx, in_data, byte_size);
+#ifdef CONFIG_SSL_CERT_VERIFICATION
+        decrypted_bi = is_decryption ?  /* decrypt or verify? */
+                RSA_private(ctx, dat_bi) : RSA_public(ctx, dat_bi);
 #else   /* always a decryption */
-    decrypted_bi = RSA_private(ctx, dat_bi);
+        decrypted_bi = RSA_private(ctx, dat_bi);
 #endif
 
-    /* convert to a normal block */
-    bi_export(ctx->bi_ctx, decrypted_bi, block, byte_size);
+        /* convert to a normal block */
+        bi_export(ctx->bi_ctx, decrypted_bi, block, byte_size);
+    }
 
     if (padding)
     {
@@ -341,6 +433,9 @@ int RSA_encrypt(const RSA_CTX *ctx, const uint8_t *in_data, uint16_t in_len,
     }
 
     /* now encrypt it */
+    if (RSA_mont64(ctx, out_data, out_data, is_signing) == 0)
+        return byte_size;
+
     dat_bi = bi_import(ctx->bi_ctx, out_data, byte_size);
     encrypt_bi = is_signing ? RSA_private(ctx, dat_bi) :
                               RSA_public(ctx, dat_bi);
@@ -35,16 +35,28 @@
 extern "C" {
 #endif
 
+// With REB_INSTANCES each interpreter thread runs Init_Crypto() and
+// Shutdown_Crypto() itself, so each needs its own random number source.
+// (This header doesn't see reb-c.h, hence not using THREAD_LOCAL.)
+//
+#if !defined(REB_INSTANCES)
+    #define RNG_THREAD_LOCAL
+#elif defined(_MSC_VER)
+    #define RNG_THREAD_LOCAL __declspec(thread)
+#else
+    #define RNG_THREAD_LOCAL __thread
+#endif
+
 #ifdef TO_WINDOWS
     #include <windows.h>
     #include <wincrypt.h>
 
-    extern HCRYPTPROV gCryptProv; // encryption provider handle
+    extern RNG_THREAD_LOCAL HCRYPTPROV gCryptProv; // encryption provider handle
 #else
     #include <fcntl.h>
     #include <unistd.h>
 
-    extern int rng_fd; // file descriptor for random number generator
+    extern RNG_THREAD_LOCAL int rng_fd; // file descriptor for random number generator
 #endif
 
 
@@ -73,6 +85,16 @@ extern "C" {
  * RSA declarations
  **************************************************************************/
 
+/*
+ * Big-endian copies of the key numbers, kept for the mont64 code (which
+ * works from bytes rather than bigints).
+ */
+typedef struct
+{
+    uint8_t *data;
+    int len;
+} RSA_OCTETS;
+
 typedef struct
 {
     bigint *m;              /* modulus */
@@ -87,6 +109,16 @@ typedef struct
 #endif
     int num_octets;
     BI_CTX *bi_ctx;
+    RSA_OCTETS raw_m;
+    RSA_OCTETS raw_e;
+    RSA_OCTETS raw_d;
+#ifdef CONFIG_BIGINT_CRT
+    RSA_OCTETS raw_p;
+    RSA_OCTETS raw_q;
+    RSA_OCTETS raw_dP;
+    RSA_OCTETS raw_dQ;
+    RSA_OCTETS raw_qInv;
+#endif
 } RSA_CTX;
 
 void RSA_priv_key_new(RSA_CTX **rsa_ctx,
@@ -0,0 +1,199 @@
+/*
+ * X25519 Diffie-Hellman function (RFC 7748)
+ *
+ * Derived from TweetNaCl (Bernstein, van Gastel, Janssen, Lange,
+ * Schwabe, Smetsers), which is in the public domain.  Field elements are
+ * sixteen 16-bit limbs held in 64-bit integers, and the ladder is
+ * constant-time.
+ */
+
+#include <string.h>
+#include "x25519.h"
+
+typedef int64_t gf[16];
+
+static const gf gf_121665 = {0xDB41, 1};
+
+static void car25519(gf o)
+{
+    int i;
+    int64_t c;
+
+    for (i = 0; i < 16; i++)
+    {
+        o[i] += ((int64_t)1 << 16);
+        c = o[i] >> 16;
+        if (i < 15)
+            o[i + 1] += c - 1;
+        else
+            o[0] += 38 * (c - 1);
+        o[i] -= c * 65536;
+    }
+}
+
+static void sel25519(gf p, gf q, int b)
+{
+    int i;
+    int64_t t, c = ~((int64_t)b - 1);
+
+    for (i = 0; i < 16; i++)
+    {
+        t = c & (p[i] ^ q[i]);
+        p[i] ^= t;
+        q[i] ^= t;
+    }
+}
+
+static void pack25519(uint8_t *o, const gf n)
+{
+    int i, j, b;
+    gf m, t;
+
+    for (i = 0; i < 16; i++)
+        t[i] = n[i];
+    car25519(t);
+    car25519(t);
+    car25519(t);
+
+    for (j = 0; j < 2; j++)
+    {
+        m[0] = t[0] - 0xffed;
+        for (i = 1; i < 15; i++)
+        {
+            m[i] = t[i] - 0xffff - ((m[i - 1] >> 16) & 1);
+            m[i - 1] &= 0xffff;
+        }
+        m[15] = t[15] - 0x7fff - ((m[14] >> 16) & 1);
+        b = (int)((m[15] >> 16) & 1);
+        m[14] &= 0xffff;
+        sel25519(t, m, 1 - b);
+    }
+
+    for (i = 0; i < 16; i++)
+    {
+        o[2 * i] = (uint8_t)(t[i] & 0xff);
+        o[2 * i + 1] = (uint8_t)(t[i] >> 8);
+    }
+}
+
+static void unpack25519(gf o, const uint8_t *n)
+{
+    int i;
+
+    for (i = 0; i < 16; i++)
+        o[i] = n[2 * i] + ((int64_t)n[2 * i + 1] << 8);
+    o[15] &= 0x7fff;
+}
+
+static void fe_add(gf o, const gf a, const gf b)
+{
+    int i;
+    for (i = 0; i < 16; i++)
+        o[i] = a[i] + b[i];
+}
+
+static void fe_sub(gf o, const gf a, const gf b)
+{
+    int i;
+    for (i = 0; i < 16; i++)
+        o[i] = a[i] - b[i];
+}
+
+static void fe_mul(gf o, const gf a, const gf b)
+{
+    int i, j;
+    int64_t t[31];
+
+    for (i = 0; i < 31; i++)
+        t[i] = 0;
+    for (i = 0; i < 16; i++)
+        for (j = 0; j < 16; j++)
+            t[i + j] += a[i] * b[j];
+    for (i = 0; i < 15; i++)
+        t[i] += 38 * t[i + 16];
+    for (i = 0; i < 16; i++)
+        o[i] = t[i];
+    car25519(o);
+    car25519(o);
+}
+
+static void fe_sq(gf o, const gf a)
+{
+    fe_mul(o, a, a);
+}
+
+static void fe_inv(gf o, const gf i)
+{
+    gf c;
+    int a;
+
+    for (a = 0; a < 16; a++)
+        c[a] = i[a];
+    for (a = 253; a >= 0; a--)
+    {
+        fe_sq(c, c);
+        if (a != 2 && a != 4)
+            fe_mul(c, c, i);
+    }
+    for (a = 0; a < 16; a++)
+        o[a] = c[a];
+}
+
+void x25519(uint8_t *out, const uint8_t *scalar, const uint8_t *point)
+{
+    static const uint8_t base[X25519_KEY_SIZE] = {9};
+    uint8_t z[32];
+    int i;
+    int64_t r;
+    gf x, a, b, c, d, e, f;
+
+    if (point == NULL)
+        point = base;
+
+    /* clamp */
+    for (i = 0; i < 32; i++)
+        z[i] = scalar[i];
+    z[31] = (z[31] & 127) | 64;
+    z[0] &= 248;
+
+    unpack25519(x, point);
+    for (i = 0; i < 16; i++)
+    {
+        b[i] = x[i];
+        d[i] = a[i] = c[i] = 0;
+    }
+    a[0] = d[0] = 1;
+
+    for (i = 254; i >= 0; --i)
+    {
+        r = (z[i >> 3] >> (i & 7)) & 1;
+        sel25519(a, b, (int)r);
+        sel25519(c, d, (int)r);
+        fe_add(e, a, c);
+        fe_sub(a, a, c);
+        fe_add(c, b, d);
+        fe_sub(b, b, d);
+        fe_sq(d, e);
+        fe_sq(f, a);
+        fe_mul(a, c, a);
+        fe_mul(c, b, e);
+        fe_add(e, a, c);
+        fe_sub(a, a, c);
+        fe_sq(b, a);
+        fe_sub(c, d, f);
+        fe_mul(a, c, gf_121665);
+        fe_add(a, a, d);
+        fe_mul(c, c, a);
+        fe_mul(a, d, f);
+        fe_mul(d, b, x);
+        fe_sq(b, e);
+        sel25519(a, b, (int)r);
+        sel25519(c, d, (int)r);
+    }
+
+    fe_inv(c, c);
+    fe_mul(a, a, c);
+    pack25519(out, a);
+
+    memset(z, 0, sizeof(z));
+}
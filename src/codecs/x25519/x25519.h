@@ -0,0 +1,18 @@
+/*
+ * X25519 Diffie-Hellman function (RFC 7748)
+ *
+ * Derived from TweetNaCl (Bernstein, van Gastel, Janssen, Lange,
+ * Schwabe, Smetsers), which is in the public domain.  Field elements are
+ * sixteen 16-bit limbs held in 64-bit integers, and the ladder is
+ * constant-time.
+ */
+
+#include <stdint.h>  // uint8_t
+
+#define X25519_KEY_SIZE 32
+
+/*
+ * out = scalar * point.  Pass NULL for point to multiply by the base
+ * point (9), which produces the public key for a private scalar.
+ */
+void x25519(uint8_t *out, const uint8_t *scalar, const uint8_t *point);
@@ -41,7 +41,7 @@
 #undef PVAR
 #undef TVAR
 
-#define PVAR
-#define TVAR
+#define PVAR THREAD_LOCAL
+#define TVAR THREAD_LOCAL
 
 #include "sys-globals.h"
@@ -104,6 +104,11 @@ RL_API void RL_Version(REBYTE vers[])
 //     structures used by the REBOL interpreter. This is an
 //     extensive process that takes time.
 //
+//     When built with REB_INSTANCES, the interpreter state is
+//     thread-local: each thread that calls RL_Init gets its own
+//     independent interpreter, which only that thread may use
+//     (through to RL_Shutdown).  All threads share the one lib.
+//
 void RL_Init(void *lib)
 {
     // These tables used to be built by overcomplicated Rebol scripts.  It's
@@ -185,6 +185,7 @@ static void Init_Base(REBARR *boot_base)
     // for FUNCTION to bind to.  So FUNCTION: would be an unbound SET-WORD!,
     // and give an error on the assignment.
     //
+    REBI64 start = OS_DELTA_TIME(0, 0);
     Bind_Values_Set_Midstream_Shallow(head, Lib_Context);
 
     // With the base block's definitions added to the mix, deep bind the code
@@ -192,13 +193,16 @@ static void Init_Base(REBARR *boot_base)
     // return no value when executed...hence it should end in `()`.
 
     Bind_Values_Deep(head, Lib_Context);
+    PG_Boot_Times[BOOT_TIME_BIND] += OS_DELTA_TIME(start, 0);
 
+    start = OS_DELTA_TIME(0, 0);
     REBVAL result;
     if (Do_At_Throws(&result, boot_base, 0, SPECIFIED))
         panic (&result);
 
     if (!IS_VOID(&result))
         panic (&result);
+    PG_Boot_Times[BOOT_TIME_RUN] += OS_DELTA_TIME(start, 0);
 }
 
 
@@ -224,16 +228,20 @@ static void Init_Sys(REBARR *boot_sys) {
     // and then bind deeply all words to Lib and Sys.  See Init_Base() notes
     // for why the top-level walk is needed first.
     //
+    REBI64 start = OS_DELTA_TIME(0, 0);
     Bind_Values_Set_Midstream_Shallow(head, Sys_Context);
     Bind_Values_Deep(head, Lib_Context);
     Bind_Values_Deep(head, Sys_Context);
+    PG_Boot_Times[BOOT_TIME_BIND] += OS_DELTA_TIME(start, 0);
 
+    start = OS_DELTA_TIME(0, 0);
     REBVAL result;
     if (Do_At_Throws(&result, boot_sys, 0, SPECIFIED))
         panic (&result);
 
     if (!IS_VOID(&result))
         panic (&result);
+    PG_Boot_Times[BOOT_TIME_RUN] += OS_DELTA_TIME(start, 0);
 }
 
 
@@ -596,6 +604,24 @@ static REBARR *Init_Natives(REBARR *boot_natives)
             NULL // no underlying function, this is fundamental
         );
 
+        // Control constructs only run or return their arguments, so passing
+        // a function body's blocks to them doesn't stop its frame from being
+        // reused (see SERIES_INFO_FRAME_ESCAPED)
+        //
+        if (
+            Native_C_Funcs[n] == &N_if
+            || Native_C_Funcs[n] == &N_unless
+            || Native_C_Funcs[n] == &N_either
+            || Native_C_Funcs[n] == &N_case
+            || Native_C_Funcs[n] == &N_all
+            || Native_C_Funcs[n] == &N_any
+            || Native_C_Funcs[n] == &N_loop
+            || Native_C_Funcs[n] == &N_while
+            || Native_C_Funcs[n] == &N_until
+        ){
+            SET_VAL_FLAG(FUNC_VALUE(fun), FUNC_FLAG_ARGS_DONT_ESCAPE);
+        }
+
         // If a user-equivalent body was provided, we save it in the native's
         // REBVAL for later lookup.
         //
@@ -1212,6 +1238,181 @@ void Init_Locale(void)
 }
 
 
+//
+//  Boot_Bin_Count: C
+//
+// Read one of the LEB128-encoded counts in the pre-scanned boot block.
+//
+static REBCNT Boot_Bin_Count(const REBYTE **bp)
+{
+    REBCNT n = 0;
+    REBCNT shift = 0;
+    REBYTE b;
+    do {
+        b = *(*bp)++;
+        n |= cast(REBCNT, b & 0x7F) << shift;
+        shift += 7;
+    } while (b & 0x80);
+    return n;
+}
+
+
+//
+//  Load_Boot_Array: C
+//
+// Build an array from a count and that many values of the pre-scanned boot
+// block.  Like the scanner, values are gathered on the data stack, and the
+// resulting arrays are all managed.
+//
+static REBARR *Load_Boot_Array(const REBYTE **bp, REBSTR **symbols)
+{
+    REBDSP dsp_orig = DSP;
+    REBCNT len = Boot_Bin_Count(bp);
+
+    for (; len != 0; --len) {
+        enum Reb_Kind kind;
+
+        switch (*(*bp)++) {
+        case BOOT_BIN_WORD:
+            kind = REB_WORD;
+            goto load_word;
+
+        case BOOT_BIN_SET_WORD:
+            kind = REB_SET_WORD;
+            goto load_word;
+
+        case BOOT_BIN_GET_WORD:
+            kind = REB_GET_WORD;
+            goto load_word;
+
+        case BOOT_BIN_LIT_WORD:
+            kind = REB_LIT_WORD;
+            goto load_word;
+
+        case BOOT_BIN_REFINEMENT:
+            kind = REB_REFINEMENT;
+        load_word:
+            DS_PUSH_TRASH;
+            Init_Any_Word(DS_TOP, kind, symbols[Boot_Bin_Count(bp)]);
+            break;
+
+        case BOOT_BIN_BLOCK:
+            kind = REB_BLOCK;
+            goto load_array;
+
+        case BOOT_BIN_GROUP:
+            kind = REB_GROUP;
+            goto load_array;
+
+        case BOOT_BIN_PATH:
+            kind = REB_PATH;
+            goto load_array;
+
+        case BOOT_BIN_SET_PATH:
+            kind = REB_SET_PATH;
+            goto load_array;
+
+        case BOOT_BIN_GET_PATH:
+            kind = REB_GET_PATH;
+            goto load_array;
+
+        case BOOT_BIN_LIT_PATH:
+            kind = REB_LIT_PATH;
+        load_array: {
+            REBARR *array = Load_Boot_Array(bp, symbols);
+            DS_PUSH_TRASH;
+            Init_Any_Array(DS_TOP, kind, array);
+            break; }
+
+        case BOOT_BIN_INTEGER: {
+            REBCNT size = Boot_Bin_Count(bp);
+            DS_PUSH_TRASH;
+            if (Scan_Integer(DS_TOP, *bp, size) == NULL)
+                panic ("bad integer in boot block (try `make clean`)");
+            *bp += size;
+            break; }
+
+        case BOOT_BIN_STRING: {
+            REBCNT size = Boot_Bin_Count(bp);
+            REBSER *s = Append_UTF8_May_Fail(NULL, *bp, size);
+            *bp += size;
+            DS_PUSH_TRASH;
+            Init_String(DS_TOP, s);
+            break; }
+
+        case BOOT_BIN_BLANK:
+            DS_PUSH_TRASH;
+            SET_BLANK(DS_TOP);
+            break;
+
+        case BOOT_BIN_BAR:
+            DS_PUSH_TRASH;
+            SET_BAR(DS_TOP);
+            break;
+
+        case BOOT_BIN_SCAN: {
+            //
+            // Types with no binary form of their own are stored as (zero
+            // terminated) source text, one value at a time.
+            //
+            REBCNT size = Boot_Bin_Count(bp);
+            REBARR *scanned = Scan_UTF8_Managed(*bp, size);
+            *bp += size;
+            if (ARR_LEN(scanned) != 1)
+                panic ("bad source text in boot block (try `make clean`)");
+            DS_PUSH_TRASH;
+            *DS_TOP = *KNOWN(ARR_HEAD(scanned));
+            break; }
+
+        default:
+            panic ("unknown tag in boot block (try `make clean`)");
+        }
+    }
+
+    REBARR *array = Pop_Stack_Values(dsp_orig);
+    MANAGE_ARRAY(array);
+    return array;
+}
+
+
+//
+//  Load_Boot_Block: C
+//
+// %make-boot.r stores the boot block pre-scanned, so that startup doesn't
+// have to run the scanner over the source text of all the mezzanine code.
+// The data begins with a count of symbols, each a size and UTF-8 spelling.
+// Then come arrays: a count of values, each a Boot_Bin_Tags byte followed by
+// what the tag calls for (a symbol index for words, an array for blocks and
+// paths, a size and UTF-8 bytes for strings and source text, and so on).
+//
+// The result is the same as scanning the boot block's source text would have
+// given: a managed array with the boot block as its only value.
+//
+static REBARR *Load_Boot_Block(const REBYTE *data, REBCNT size)
+{
+    const REBYTE *bp = data;
+
+    REBCNT num_symbols = Boot_Bin_Count(&bp);
+    REBSTR **symbols = ALLOC_N(REBSTR*, num_symbols);
+
+    REBCNT n;
+    for (n = 0; n < num_symbols; ++n) {
+        REBCNT len = Boot_Bin_Count(&bp);
+        symbols[n] = Intern_UTF8_Managed(bp, len);
+        bp += len;
+    }
+
+    REBARR *boot_array = Load_Boot_Array(&bp, symbols);
+
+    FREE_N(REBSTR*, num_symbols, symbols);
+
+    if (bp != data + size || ARR_LEN(boot_array) != 1)
+        panic ("boot block size mismatch (try `make clean`)");
+
+    return boot_array;
+}
+
+
 //
 //  Init_Core: C
 //
@@ -1264,6 +1465,10 @@ void Init_Core(void)
     PG_Boot_Level = BOOT_LEVEL_FULL;
     PG_Mem_Usage = 0;
     PG_Mem_Limit = 0;
+    PG_Jit_Threshold = 0;
+    PG_Profiling = FALSE;
+    PG_Series_Profiling = FALSE;
+    PG_Series_Made = 0;
     Reb_Opts = ALLOC(REB_OPTS);
     CLEAR(Reb_Opts, sizeof(REB_OPTS));
     Saved_State = NULL;
@@ -1320,22 +1525,41 @@ void Init_Core(void)
 //==//////////////////////////////////////////////////////////////////////==//
 
     // The %make-boot.r process takes all the various definitions and
-    // mezzanine code and packs it into one compressed string in %b-boot.c
+    // mezzanine code and packs it into one compressed binary in %b-boot.c
     // which gets embedded into the executable.  This includes the type list,
     // word list, error message templates, system object, mezzanines, etc.
+    // It's stored pre-scanned, see Load_Boot_Block().
+    //
+    // Builds with REB_BOOT_UNCOMPRESSED trade executable size for startup
+    // time, loading from the embedded data in place.
+
+    CLEAR(PG_Boot_Times, sizeof(PG_Boot_Times));
+    REBI64 start = OS_DELTA_TIME(0, 0);
+
+#if defined(REB_BOOT_UNCOMPRESSED)
+    REBARR *boot_array = Load_Boot_Block(Native_Specs, NAT_UNCOMPRESSED_SIZE);
+    PUSH_GUARD_ARRAY(boot_array); // managed, so must be guarded
 
-    REBSER *utf8 = Decompress(
+    PG_Boot_Times[BOOT_TIME_LOAD] = OS_DELTA_TIME(start, 0);
+#else
+    REBSER *bin = Decompress(
         Native_Specs, NAT_COMPRESSED_SIZE, NAT_UNCOMPRESSED_SIZE, FALSE, FALSE
     );
-    if (utf8 == NULL || SER_LEN(utf8) != NAT_UNCOMPRESSED_SIZE)
+    if (bin == NULL || SER_LEN(bin) != NAT_UNCOMPRESSED_SIZE)
         panic ("decompressed native specs size mismatch (try `make clean`)");
 
-    REBARR *boot_array = Scan_UTF8_Managed(
-        BIN_HEAD(utf8), NAT_UNCOMPRESSED_SIZE
-    );
+    PG_Boot_Times[BOOT_TIME_DECOMPRESS] = OS_DELTA_TIME(start, 0);
+    start = OS_DELTA_TIME(0, 0);
+
+    REBARR *boot_array = Load_Boot_Block(BIN_HEAD(bin), NAT_UNCOMPRESSED_SIZE);
     PUSH_GUARD_ARRAY(boot_array); // managed, so must be guarded
 
-    Free_Series(utf8); // don't need decompressed text after it's scanned
+    Free_Series(bin); // don't need decompressed data after it's loaded
+
+    PG_Boot_Times[BOOT_TIME_LOAD] = OS_DELTA_TIME(start, 0);
+#endif
+
+    start = OS_DELTA_TIME(0, 0);
 
     BOOT_BLK *boot = cast(BOOT_BLK*, VAL_ARRAY_HEAD(ARR_HEAD(boot_array)));
 
@@ -1394,6 +1618,12 @@ void Init_Core(void)
     MANAGE_ARRAY(CTX_VARLIST(Lib_Context));
     PUSH_GUARD_CONTEXT(Lib_Context);
 
+    // Everything LOADed is bound to lib, so the index of each of its words
+    // is kept on the word's canon (see %sys-bind.h)
+    //
+    PG_Bind_Cache_Context = NULL;
+    Cache_Bind_Indices(Lib_Context);
+
     Sys_Context = Alloc_Context(50);
     VAL_RESET_HEADER(CTX_VALUE(Sys_Context), REB_OBJECT);
     CTX_VALUE(Sys_Context)->extra.binding = NULL;
@@ -1489,6 +1719,8 @@ void Init_Core(void)
         panic (error);
     }
 
+    PG_Boot_Times[BOOT_TIME_INIT] = OS_DELTA_TIME(start, 0);
+
     Init_Base(VAL_ARRAY(&boot->base));
 
     Init_Sys(VAL_ARRAY(&boot->sys));
@@ -1497,12 +1729,22 @@ void Init_Core(void)
 
     assert(DSP == 0 && FS_TOP == NULL);
 
+    // Bind the mezzanine as BIND-LIB would: its top-level SET-WORD!s are
+    // added to lib, and then it's bound deeply to lib.
+    //
+    start = OS_DELTA_TIME(0, 0);
+    Bind_Values_Set_Midstream_Shallow(VAL_ARRAY_HEAD(&boot->mezz), Lib_Context);
+    Bind_Values_Deep(VAL_ARRAY_HEAD(&boot->mezz), Lib_Context);
+    PG_Boot_Times[BOOT_TIME_BIND] += OS_DELTA_TIME(start, 0);
+
+    start = OS_DELTA_TIME(0, 0);
+
     Init_Ports();
 
     // The FINISH-INIT-CORE function should theoretically do very little.
     // But right now it is where:
     //
-    // * the mezzanine definitions are bound to the lib context and DO'd
+    // * the mezzanine definitions (bound to lib above) are DO'd
     // * the various scheme handlers (http://, file://) are registered
     // * protocols implemented in user code (HTTP and TLS) are registered
     //
@@ -1539,6 +1781,8 @@ void Init_Core(void)
         panic (&result);
     }
 
+    PG_Boot_Times[BOOT_TIME_RUN] += OS_DELTA_TIME(start, 0);
+
     DROP_GUARD_ARRAY(boot_array);
 
     assert(DSP == 0 && FS_TOP == NULL);
@@ -1602,8 +1846,11 @@ void Shutdown_Core(void)
         &= (~NODE_FLAG_ROOT);
     AS_SERIES(CTX_VARLIST(TG_Task_Context))->header.bits
         &= (~NODE_FLAG_ROOT);
+    Shutdown_Series_Profile();
+    Uncache_Bind_Indices(); // lib's canons are freed with it
     Recycle_Core(TRUE, NULL);
 
+    Shutdown_Profile();
     Shutdown_Ports();
     Shutdown_Event_Scheme();
     Shutdown_CRC();
@@ -1611,8 +1858,7 @@ void Shutdown_Core(void)
     Shutdown_Scanner();
     Shutdown_Char_Cases();
 
-    assert(PG_Num_Canon_Slots_In_Use - PG_Num_Canon_Deleteds == 0);
-    Free_Series(PG_Canons_By_Hash);
+    Shutdown_Words();
     Free_Series(PG_Symbol_Canons);
 
     Shutdown_GC();
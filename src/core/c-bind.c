@@ -35,11 +35,87 @@
 #include "sys-core.h"
 
 
+//
+//  Cache_Bind_Indices: C
+//
+// Keep the index of each key of a context in the low half of its canon's
+// bind_index from now on, so binding to it doesn't need a binder to be set
+// up and torn down (see %sys-bind.h).  Only one context can have this at a
+// time.  Append_Context_Core() keeps it in sync as keys are added.
+//
+void Cache_Bind_Indices(REBCTX *context)
+{
+    assert(PG_Bind_Cache_Context == NULL);
+
+    if (CTX_LEN(context) > MAX_CACHED_BIND_INDEX)
+        return;
+
+    REBCNT index = 1;
+    REBVAL *key = CTX_KEYS_HEAD(context);
+    for (; NOT_END(key); ++key, ++index) {
+        REBSTR *canon = VAL_KEY_CANON(key);
+        if (canon->misc.bind_index.low == 0) // first key wins, like a search
+            canon->misc.bind_index.low = index;
+    }
+
+    PG_Bind_Cache_Context = context;
+}
+
+
+//
+//  Uncache_Bind_Indices: C
+//
+// Stop caching the indices of PG_Bind_Cache_Context's keys (if any).  This
+// is done at shutdown, or if the context grows past what the cache holds.
+//
+void Uncache_Bind_Indices(void)
+{
+    REBCTX *context = PG_Bind_Cache_Context;
+    if (context == NULL)
+        return;
+
+    REBVAL *key = CTX_KEYS_HEAD(context);
+    for (; NOT_END(key); ++key)
+        VAL_KEY_CANON(key)->misc.bind_index.low = 0;
+
+    PG_Bind_Cache_Context = NULL;
+}
+
+
+//
+//  Get_Cached_Bind_Index: C
+//
+// The index a word would be bound to in the bind cache's context, or 0 if
+// it would not be bound.  (If the cache was dropped midstream by adding too
+// many keys, fall back on a search.)
+//
+static REBCNT Get_Cached_Bind_Index(REBCTX *context, REBSTR *canon)
+{
+    REBCNT n;
+    if (context == PG_Bind_Cache_Context)
+        n = canon->misc.bind_index.low;
+    else {
+        REBVAL *key = CTX_KEYS_HEAD(context);
+        for (n = 1; NOT_END(key); ++key, ++n) {
+            if (VAL_KEY_CANON(key) == canon)
+                break;
+        }
+        if (IS_END(key))
+            return 0;
+    }
+
+    if (n == 0 || GET_VAL_FLAG(CTX_KEY(context, n), TYPESET_FLAG_UNBINDABLE))
+        return 0;
+    return n;
+}
+
+
 //
 //  Bind_Values_Inner_Loop: C
 //
 // Bind_Values_Core() sets up the binding table and then calls
-// this recursive routine to do the actual binding.
+// this recursive routine to do the actual binding.  If the binder is NULL,
+// the context is the one with its indices cached on the canons.
 //
 static void Bind_Values_Inner_Loop(
     struct Reb_Binder *binder,
@@ -55,7 +131,9 @@ static void Bind_Values_Inner_Loop(
 
         if (type_bit & bind_types) {
             REBSTR *canon = VAL_WORD_CANON(value);
-            REBCNT n = Try_Get_Binder_Index(binder, canon);
+            REBCNT n = (binder == NULL)
+                ? Get_Cached_Bind_Index(context, canon)
+                : Try_Get_Binder_Index(binder, canon);
             if (n != 0) {
                 assert(n <= CTX_LEN(context));
 
@@ -74,7 +152,8 @@ static void Bind_Values_Inner_Loop(
                 //
                 Expand_Context(context, 1);
                 Append_Context(context, value, 0);
-                Add_Binder_Index(binder, canon, VAL_WORD_INDEX(value));
+                if (binder != NULL) // else Append_Context() updated the cache
+                    Add_Binder_Index(binder, canon, VAL_WORD_INDEX(value));
             }
         }
         else if (ANY_ARRAY(value) && (flags & BIND_DEEP)) {
@@ -125,6 +204,17 @@ void Bind_Values_Core(
     REBU64 add_midstream_types,
     REBFLGS flags // see %sys-core.h for BIND_DEEP, etc.
 ) {
+    // The indices of the context's keys may already be on the canons, which
+    // saves walking its keylist twice to set up a binder (lib has thousands
+    // of keys, and gets bound to on every LOAD).
+    //
+    if (context == PG_Bind_Cache_Context) {
+        Bind_Values_Inner_Loop(
+            NULL, head, context, bind_types, add_midstream_types, flags
+        );
+        return;
+    }
+
     struct Reb_Binder binder;
     INIT_BINDER(&binder);
 
@@ -192,6 +192,12 @@ REBVAL *Append_Context_Core(
     REBSTR *opt_name,
     REBOOL lookback
 ) {
+    // A shared keylist may be the shape of other objects, so it can't be
+    // extended in place.  (Callers usually did Expand_Context() already.)
+    //
+    if (GET_SER_INFO(CTX_KEYLIST(context), SERIES_INFO_SHARED_KEYLIST))
+        Ensure_Keylist_Unique_Invalidated(context);
+
     REBARR *keylist = CTX_KEYLIST(context);
 
     // Add the key to key list
@@ -215,6 +221,14 @@ REBVAL *Append_Context_Core(
     SET_VOID(value);
     TERM_ARRAY_LEN(CTX_VARLIST(context), ARR_LEN(CTX_VARLIST(context)));
 
+    if (context == PG_Bind_Cache_Context) {
+        REBSTR *canon = VAL_KEY_CANON(key);
+        if (CTX_LEN(context) > MAX_CACHED_BIND_INDEX)
+            Uncache_Bind_Indices();
+        else if (canon->misc.bind_index.low == 0)
+            canon->misc.bind_index.low = CTX_LEN(context);
+    }
+
     if (opt_any_word) {
         REBCNT len = CTX_LEN(context);
 
@@ -398,12 +412,10 @@ void Collect_Keys_End(struct Reb_Binder *binder)
         // which thread had the error to roll back any binding structures.
         // For now just zero it out based on the collect buffer.
         //
-        assert(
-            canon->misc.bind_index.high != 0
-            || canon->misc.bind_index.low != 0
-        );
+        // (The low half is the bind cache, and isn't used by binders.)
+        //
+        assert(canon->misc.bind_index.high != 0);
         canon->misc.bind_index.high = 0;
-        canon->misc.bind_index.low = 0;
     }
 
     SET_ARRAY_LEN_NOTERM(BUF_COLLECT, 0);
@@ -744,13 +756,23 @@ REBCTX *Make_Selfish_Context_Detect(
     const RELVAL *head,
     REBCTX *opt_parent
 ) {
+    // Objects without a parent that are made from the same spec can share
+    // the keylist of the first one as their shape (see Shape_Cache).
+    //
+    REBOOL shapeable = LOGICAL(opt_parent == NULL && NOT_END(head));
+
     REBCNT self_index;
-    REBARR *keylist = Collect_Keylist_Managed(
-        &self_index,
-        head,
-        opt_parent,
-        COLLECT_ONLY_SET_WORDS | COLLECT_ENSURE_SELF
-    );
+    REBARR *keylist = shapeable ? Find_Shape_For_Spec(head) : NULL;
+    if (keylist != NULL)
+        self_index = 1;
+    else {
+        keylist = Collect_Keylist_Managed(
+            &self_index,
+            head,
+            opt_parent,
+            COLLECT_ONLY_SET_WORDS | COLLECT_ENSURE_SELF
+        );
+    }
 
     REBCNT len = ARR_LEN(keylist);
 
@@ -768,6 +790,9 @@ REBCTX *Make_Selfish_Context_Detect(
     //
     INIT_CTX_KEYLIST_SHARED(context, keylist);
 
+    if (shapeable)
+        Remember_Shape_For_Spec(head, keylist);
+
     // context[0] is an instance value of the OBJECT!/PORT!/ERROR!/MODULE!
     //
     CTX_VALUE(context)->payload.any_context.varlist = varlist;
@@ -1158,6 +1183,12 @@ void Resolve_Context(
         }
     }
 
+    // Lookback flags may be copied onto the target's keys below, which must
+    // not affect other contexts sharing its keylist.
+    //
+    if (NOT_SER_FLAG(CTX_KEYLIST(target), ARRAY_FLAG_PARAMLIST))
+        Ensure_Keylist_Unique_Invalidated(target);
+
     // Foreach word in target, copy the correct value from source:
     //
     var = i != 0 ? CTX_VAR(target, i) : CTX_VARS_HEAD(target);
@@ -1234,6 +1265,119 @@ void Resolve_Context(
 }
 
 
+// Objects made from the same spec block all get the same keys.  Rather than
+// collecting a new keylist for each one, the keylist made for a spec position
+// is remembered, and later objects made from that spec share it as their
+// "shape".  Shared keylists are never modified: an object which adds a field
+// or changes a key's flags first makes a copy of its own (see the notes on
+// Expand_Context_Keylist_Core()).
+//
+// The spec pointers are only compared, never dereferenced, so a spec which
+// has been freed is harmless.  The keylists are weak references, which are
+// dropped by the GC when nothing else holds them (see Prune_Shape_Cache()).
+//
+#define SHAPE_CACHE_SIZE 256 // must be a power of 2
+
+static THREAD_LOCAL struct {
+    const RELVAL *spec;
+    REBARR *keylist;
+} Shape_Cache[SHAPE_CACHE_SIZE];
+
+#define SHAPE_CACHE_SLOT(spec) \
+    ((cast(REBUPT, (spec)) / sizeof(RELVAL)) & (SHAPE_CACHE_SIZE - 1))
+
+
+// By-name field access (path picks, SELECT, IN...) remembers the index at
+// which a canon was found in a keylist, so objects of the same shape find
+// their fields without searching.  A hit is confirmed by checking the key at
+// the cached index in the context being searched, so entries for keylists
+// that were expanded in place (or freed, and their node reused) cannot give
+// a wrong answer--hence nothing has to be invalidated.
+//
+#define FIELD_CACHE_SIZE 1024 // must be a power of 2
+
+static THREAD_LOCAL struct {
+    REBARR *keylist;
+    REBSTR *canon;
+    REBCNT index;
+} Field_Cache[FIELD_CACHE_SIZE];
+
+#define FIELD_CACHE_SLOT(keylist,canon) \
+    (((cast(REBUPT, (keylist)) >> 4) ^ (cast(REBUPT, (canon)) >> 3)) \
+        & (FIELD_CACHE_SIZE - 1))
+
+
+//
+//  Find_Shape_For_Spec: C
+//
+// Get the keylist previously made for objects with this spec (no parent),
+// if it would be the same as collecting the spec's set-words again.  Returns
+// NULL if there isn't one.
+//
+REBARR *Find_Shape_For_Spec(const RELVAL *head)
+{
+    REBCNT slot = SHAPE_CACHE_SLOT(head);
+    if (Shape_Cache[slot].spec != head)
+        return NULL;
+
+    REBARR *keylist = Shape_Cache[slot].keylist;
+
+    // The spec block may have been modified since, so check the set-words
+    // against the keys in order.  (A duplicated set-word doesn't match, and
+    // is left to Collect_Keylist_Managed() to sort out.)
+    //
+    RELVAL *key = ARR_AT(keylist, 2); // [0] is rootkey, [1] is SELF
+    const RELVAL *item = head;
+    for (; NOT_END(item); ++item) {
+        if (!IS_SET_WORD(item))
+            continue;
+        if (IS_END(key) || VAL_KEY_SPELLING(key) != VAL_WORD_SPELLING(item))
+            return NULL;
+        ++key;
+    }
+
+    if (NOT_END(key))
+        return NULL;
+
+    return keylist;
+}
+
+
+//
+//  Remember_Shape_For_Spec: C
+//
+void Remember_Shape_For_Spec(const RELVAL *head, REBARR *keylist)
+{
+    assert(GET_SER_INFO(keylist, SERIES_INFO_SHARED_KEYLIST));
+
+    REBCNT slot = SHAPE_CACHE_SLOT(head);
+    Shape_Cache[slot].spec = head;
+    Shape_Cache[slot].keylist = keylist;
+}
+
+
+//
+//  Prune_Shape_Cache: C
+//
+// Called by the GC after marking, to forget keylists that are going to be
+// swept.  (During shutdown nothing is marked, so all of them are forgotten.)
+//
+void Prune_Shape_Cache(void)
+{
+    REBCNT n;
+    for (n = 0; n < SHAPE_CACHE_SIZE; ++n) {
+        REBARR *keylist = Shape_Cache[n].keylist;
+        if (
+            keylist != NULL
+            && NOT(AS_SERIES(keylist)->header.bits & NODE_FLAG_MARKED)
+        ){
+            Shape_Cache[n].spec = NULL;
+            Shape_Cache[n].keylist = NULL;
+        }
+    }
+}
+
+
 //
 //  Find_Canon_In_Context: C
 //
@@ -1244,17 +1388,47 @@ REBCNT Find_Canon_In_Context(REBCTX *context, REBSTR *canon, REBOOL always)
 {
     assert(GET_SER_FLAG(canon, STRING_FLAG_CANON));
 
-    REBVAL *key = CTX_KEYS_HEAD(context);
+    REBARR *keylist = CTX_KEYLIST(context);
     REBCNT len = CTX_LEN(context);
-
+    REBVAL *key;
     REBCNT n;
-    for (n = 1; n <= len; n++, key++) {
+
+    if (context == PG_Bind_Cache_Context) {
+        n = canon->misc.bind_index.low;
+        if (n == 0)
+            return 0;
+        key = CTX_KEY(context, n);
+        assert(VAL_KEY_CANON(key) == canon);
+        goto found;
+    }
+
+    REBCNT slot = FIELD_CACHE_SLOT(keylist, canon);
+    if (
+        Field_Cache[slot].keylist == keylist
+        && Field_Cache[slot].canon == canon
+        && Field_Cache[slot].index <= len
+    ){
+        n = Field_Cache[slot].index;
+        key = CTX_KEY(context, n);
         if (canon == VAL_KEY_CANON(key))
-            return (!always && GET_VAL_FLAG(key, TYPESET_FLAG_HIDDEN)) ? 0 : n;
+            goto found;
+    }
+
+    key = CTX_KEYS_HEAD(context);
+    for (n = 1; n <= len; n++, key++) {
+        if (canon == VAL_KEY_CANON(key)) {
+            Field_Cache[slot].keylist = keylist;
+            Field_Cache[slot].canon = canon;
+            Field_Cache[slot].index = n;
+            goto found;
+        }
     }
 
     // !!! Should this be changed to NOT_FOUND?
     return 0;
+
+found:
+    return (!always && GET_VAL_FLAG(key, TYPESET_FLAG_HIDDEN)) ? 0 : n;
 }
 
 
@@ -1279,7 +1453,7 @@ REBVAL *Select_Canon_In_Context(REBCTX *context, REBSTR *sym)
 //
 // Find word (of any type) in an array of values with linear search.
 //
-REBCNT Find_Word_In_Array(REBARR *array, REBCNT index, REBSTR *sym)
+REBLEN Find_Word_In_Array(REBARR *array, REBLEN index, REBSTR *sym)
 {
     RELVAL *value;
 
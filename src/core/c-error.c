@@ -989,6 +989,7 @@ REBCTX *Make_Error_Managed_Core(REBCNT code, va_list *vaptr)
                     Init_Typeset(key, ALL_64, VAL_WORD_SPELLING(temp));
 
                 *value = *arg;
+                Note_Binding_Escaped(arg); // e.g. a pending SET-WORD!
 
                 key++;
                 value++;
@@ -1186,7 +1187,7 @@ REBCTX *Error_Invalid_Datatype(REBCNT id)
 //
 //  Error_No_Memory: C
 //
-REBCTX *Error_No_Memory(REBCNT bytes)
+REBCTX *Error_No_Memory(REBU64 bytes)
 {
     REBVAL bytes_value;
 
@@ -50,6 +50,7 @@
 //
 
 #include "sys-core.h"
+#include "sys-int-funcs.h" // REB_I64_ADD_OF, etc. for Try_Fused_Arithmetic()
 
 #include "tmp-evaltypes.inc"
 
@@ -172,6 +173,7 @@ static inline void Link_Vararg_Param_To_Frame(REBFRM *f, REBOOL make) {
         //
         Reify_Frame_Context_Maybe_Fulfilling(f);
     }
+    SET_SER_INFO(f->varlist, SERIES_INFO_FRAME_ESCAPED);
     f->arg->extra.binding = f->varlist;
 
     // Store the offset so that both the f->arg and f->param locations can
@@ -241,6 +243,502 @@ static inline void Link_Vararg_Param_To_Frame(REBFRM *f, REBOOL make) {
 #define LOOKBACK_ARG m_cast(REBVAL*, EMPTY_STRING)
 
 
+// A few common patterns in function bodies, like `if cond [...]` and
+// `x: x + 1`, can be run without building frames for the functions involved
+// and gathering their arguments generically--as "superinstructions".  To
+// avoid re-examining the values around every expression each time it runs,
+// Decode_Array() records once per array which pattern (if any) starts at
+// each cell, and Do_Core() dispatches on that before its main switch.
+//
+// A decoded pattern is only structural.  It doesn't capture what the words
+// look up to (variables can change, and relative words depend on the frame),
+// so the same stream works for any specifier and everything it stands for is
+// checked again each time it is run.  If a check fails, the values are just
+// evaluated generically.
+//
+enum Reb_Decoded_Op {
+    DECODED_GENERIC = 0, // no pattern, go through the main switch
+    DECODED_BRANCH, // `word word [...]`, see Try_Fused_Conditional()
+    DECODED_SET_ARITHMETIC, // `set-word: word word x`, see Try_Fused_Set...
+    DECODED_MAX
+};
+
+
+static REBYTE Decode_Cell(const RELVAL *v)
+{
+    const RELVAL *next = v + 1; // array is terminated, so at worst an END
+
+    switch (VAL_TYPE(v)) {
+    case REB_WORD:
+        if (
+            NOT_END(next) && IS_WORD(next)
+            && NOT_END(next + 1) && IS_BLOCK(next + 1)
+        ){
+            return DECODED_BRANCH;
+        }
+        break;
+
+    case REB_SET_WORD:
+        if (
+            NOT_END(next) && IS_WORD(next)
+            && NOT_END(next + 1) && IS_WORD(next + 1)
+            && NOT_END(next + 2)
+            && (
+                IS_INTEGER(next + 2)
+                || IS_DECIMAL(next + 2)
+                || IS_WORD(next + 2)
+            )
+        ){
+            return DECODED_SET_ARITHMETIC;
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    return DECODED_GENERIC;
+}
+
+
+//
+//  Decode_Array: C
+//
+// Make the pre-decoded instruction stream for an array, one byte per cell
+// holding a Reb_Decoded_Op.  Only frozen arrays are decoded, so there is no
+// way for the stream to get out of sync with the cells it was made from.
+// Function bodies are always frozen (see Make_Interpreted_Function_May_Fail)
+// as are the blocks nested in them, which covers the code the decoding is
+// aimed at.  Returns FALSE if the array can't be decoded.
+//
+REBOOL Decode_Array(REBARR *a)
+{
+    assert(NOT_SER_INFO(a, SERIES_INFO_DECODED));
+
+    if (NOT_SER_INFO(a, SERIES_INFO_FROZEN))
+        return FALSE;
+
+    if (
+        GET_SER_FLAG(a, ARRAY_FLAG_VARLIST)
+        || GET_SER_FLAG(a, ARRAY_FLAG_PARAMLIST)
+        || GET_SER_FLAG(a, ARRAY_FLAG_PAIRLIST)
+    ){
+        return FALSE; // ->link is in use (frozen objects, maps...)
+    }
+
+    REBCNT len = ARR_LEN(a);
+    REBYTE *decoded = ALLOC_N(REBYTE, len + 1);
+
+    const RELVAL *v = ARR_HEAD(a);
+    REBCNT n;
+    for (n = 0; n < len; ++n, ++v)
+        decoded[n] = Decode_Cell(v);
+    decoded[len] = DECODED_GENERIC; // the END
+
+    AS_SERIES(a)->link.decoded = decoded;
+    SET_SER_INFO(a, SERIES_INFO_DECODED);
+    return TRUE;
+}
+
+
+//
+//  Free_Decoded_Array: C
+//
+// Called when the array is freed.  (It can't have changed length, since it
+// is frozen.)
+//
+void Free_Decoded_Array(REBARR *a)
+{
+    assert(GET_SER_INFO(a, SERIES_INFO_DECODED));
+    FREE_N(REBYTE, ARR_LEN(a) + 1, AS_SERIES(a)->link.decoded);
+    CLEAR_SER_INFO(a, SERIES_INFO_DECODED);
+}
+
+
+// Get the decoded op for the expression starting at f->value, decoding the
+// array on first use.  Frames fed from a va_list or running EVAL/ONLY get
+// DECODED_GENERIC, as do all frames while tracing (which shows every call).
+//
+static inline REBYTE Decoded_Op(REBFRM *f, REBOOL args_evaluate)
+{
+    if (f->pending != NULL || NOT(args_evaluate) || Trace_Flags)
+        return DECODED_GENERIC;
+
+    REBARR *a = f->source.array;
+    if (NOT_SER_INFO(a, SERIES_INFO_DECODED) && NOT(Decode_Array(a)))
+        return DECODED_GENERIC;
+
+    // f->value is normally the cell before f->index, but isn't if it was
+    // substituted (e.g. by EVAL).
+    //
+    if (f->index == 0 || f->value != ARR_AT(a, f->index - 1))
+        return DECODED_GENERIC;
+
+    return AS_SERIES(a)->link.decoded[f->index - 1];
+}
+
+
+// `if cond [...]` and `unless cond [...]` are among the most common things
+// in function bodies.  When the condition is just a variable, the call can
+// be done without building a frame for the native and gathering its two
+// arguments generically.  (This also runs the branch with the body's
+// specifier, instead of making a specific BLOCK! for the native.)
+//
+// This is only called for a DECODED_BRANCH, with f->gotten holding what
+// f->value looks up to as a prefix function.  Nothing is done and FALSE is
+// returned if the pattern doesn't apply.  Else f->out has the result (which
+// may be THROWN) and f->value is on whatever follows the branch.
+//
+// The check of what comes after the branch keeps the behavior identical to
+// calling the native: an infix function there which does not defer would
+// have taken the branch block as its left hand argument.
+//
+static inline REBOOL Try_Fused_Conditional(REBFRM *f)
+{
+    REBOOL trigger;
+    if (VAL_FUNC_DISPATCHER(f->gotten) == &N_if)
+        trigger = TRUE;
+    else if (VAL_FUNC_DISPATCHER(f->gotten) == &N_unless)
+        trigger = FALSE;
+    else
+        return FALSE;
+
+    const RELVAL *condition = ARR_AT(f->source.array, f->index);
+    assert(IS_WORD(condition));
+
+    const RELVAL *branch = condition + 1;
+    assert(IS_BLOCK(branch));
+
+    enum Reb_Kind eval_type;
+
+    if (NOT(IS_WORD_BOUND(condition)))
+        return FALSE; // let the generic path give the error
+
+    const REBVAL *cond = Get_Var_Core(
+        &eval_type, condition, f->specifier, GETVAR_READ_ONLY
+    );
+    if (IS_VOID(cond) || IS_FUNCTION(cond))
+        return FALSE; // error, or a function call to make
+
+    // A BLOCK! fetched from a variable is not a literal, so the "safe" test
+    // done by IF does not apply.
+    //
+    REBOOL taken = LOGICAL(IS_CONDITIONAL_TRUE(cond) == trigger);
+
+    // What follows is looked up only now, as the native's argument gathering
+    // would after getting the condition, so any error it raises comes in the
+    // same order.
+    //
+    const RELVAL *after = branch + 1;
+    if (NOT_END(after) && IS_WORD(after)) {
+        if (NOT(IS_WORD_BOUND(after)))
+            return FALSE;
+
+        const REBVAL *var = Get_Var_Core(
+            &eval_type, after, f->specifier, GETVAR_READ_ONLY
+        );
+        if (
+            eval_type == REB_0_LOOKBACK
+            && NOT(GET_VAL_FLAG(var, FUNC_FLAG_DEFERS_LOOKBACK_ARG))
+        ){
+            return FALSE;
+        }
+    }
+
+    REBARR *array = VAL_ARRAY(branch);
+    REBCNT index = VAL_INDEX(branch);
+    REBSPC *specifier = IS_RELATIVE(branch)
+        ? f->specifier
+        : VAL_SPECIFIER(const_KNOWN(branch));
+
+    f->gotten = NULL;
+    Fetch_Next_In_Frame(f); // condition
+    Fetch_Next_In_Frame(f); // branch
+    Fetch_Next_In_Frame(f); // whatever follows
+
+    if (NOT(taken)) {
+        SET_VOID(f->out);
+        return TRUE;
+    }
+
+    if (Do_At_Throws(f->out, array, index, specifier))
+        return TRUE;
+
+    CLEAR_VAL_FLAG(f->out, VALUE_FLAG_UNEVALUATED);
+    return TRUE;
+}
+
+
+// Infix math and comparison (`+: enfix tighten :add`, `<`, `=`...) on an
+// INTEGER! or DECIMAL! left hand side is done here directly when the right
+// hand side is a literal number or a variable holding one, as opposed to
+// gathering arguments into a frame and going through Action_Dispatcher and
+// the REBTYPE switch.  The operations must give exactly what T_Integer(),
+// T_Decimal() and the comparison natives would, so anything else (including
+// overflow, which raises an error there) is left to the generic path.
+//
+// Because the operators are <tight>, their right argument does not look
+// ahead for more infix, so nothing after it has to be considered.
+//
+// `out` holds the left hand side.  If the pattern doesn't apply it is left
+// alone and FALSE is returned, else it is overwritten with the result.
+//
+static inline REBOOL Fused_Arithmetic_Core(
+    REBVAL *out,
+    const REBVAL *infix,
+    const RELVAL *right,
+    REBSPC *specifier
+){
+    if (NOT(IS_INTEGER(out) || IS_DECIMAL(out)))
+        return FALSE;
+
+    REBFUN *func = VAL_FUNC(infix);
+    if (
+        FUNC_NUM_PARAMS(func) != 2
+        || VAL_PARAM_CLASS(FUNC_PARAM(func, 2)) != PARAM_CLASS_NORMAL
+        || NOT_VAL_FLAG(FUNC_PARAM(func, 2), TYPESET_FLAG_TIGHT)
+    ){
+        return FALSE;
+    }
+
+    enum {
+        FUSED_ADD,
+        FUSED_SUBTRACT,
+        FUSED_MULTIPLY,
+        FUSED_EQUAL,
+        FUSED_NOT_EQUAL,
+        FUSED_LESSER,
+        FUSED_LESSER_OR_EQUAL,
+        FUSED_GREATER,
+        FUSED_GREATER_OR_EQUAL
+    } op;
+
+    REBNAT dispatcher = FUNC_DISPATCHER(func);
+    if (dispatcher == &Action_Dispatcher) {
+        switch (STR_SYMBOL(VAL_WORD_SPELLING(FUNC_BODY(func)))) {
+        case SYM_ADD:
+            op = FUSED_ADD;
+            break;
+
+        case SYM_SUBTRACT:
+            op = FUSED_SUBTRACT;
+            break;
+
+        case SYM_MULTIPLY:
+            op = FUSED_MULTIPLY;
+            break;
+
+        default:
+            return FALSE;
+        }
+    }
+    else if (dispatcher == &N_equal_q || dispatcher == &N_strict_equal_q)
+        op = FUSED_EQUAL;
+    else if (
+        dispatcher == &N_not_equal_q || dispatcher == &N_strict_not_equal_q
+    ){
+        op = FUSED_NOT_EQUAL;
+    }
+    else if (dispatcher == &N_lesser_q)
+        op = FUSED_LESSER;
+    else if (dispatcher == &N_lesser_or_equal_q)
+        op = FUSED_LESSER_OR_EQUAL;
+    else if (dispatcher == &N_greater_q)
+        op = FUSED_GREATER;
+    else if (dispatcher == &N_greater_or_equal_q)
+        op = FUSED_GREATER_OR_EQUAL;
+    else
+        return FALSE;
+
+    const RELVAL *arg;
+    if (IS_INTEGER(right) || IS_DECIMAL(right))
+        arg = right;
+    else if (IS_WORD(right) && IS_WORD_BOUND(right)) {
+        enum Reb_Kind eval_type;
+        arg = Get_Var_Core(&eval_type, right, specifier, GETVAR_READ_ONLY);
+        if (NOT(IS_INTEGER(arg) || IS_DECIMAL(arg)))
+            return FALSE;
+    }
+    else
+        return FALSE; // includes END
+
+    if (IS_INTEGER(out) && IS_INTEGER(arg)) {
+        REBI64 a = VAL_INT64(out);
+        REBI64 b = VAL_INT64(arg);
+        REBI64 result;
+
+        switch (op) {
+        case FUSED_ADD:
+            if (REB_I64_ADD_OF(a, b, &result))
+                return FALSE;
+            SET_INTEGER(out, result);
+            break;
+
+        case FUSED_SUBTRACT:
+            if (REB_I64_SUB_OF(a, b, &result))
+                return FALSE;
+            SET_INTEGER(out, result);
+            break;
+
+        case FUSED_MULTIPLY:
+            if (REB_I64_MUL_OF(a, b, &result))
+                return FALSE;
+            SET_INTEGER(out, result);
+            break;
+
+        case FUSED_EQUAL:
+            SET_LOGIC(out, LOGICAL(a == b));
+            break;
+
+        case FUSED_NOT_EQUAL:
+            SET_LOGIC(out, LOGICAL(a != b));
+            break;
+
+        case FUSED_LESSER:
+            SET_LOGIC(out, LOGICAL(a < b));
+            break;
+
+        case FUSED_LESSER_OR_EQUAL:
+            SET_LOGIC(out, LOGICAL(a <= b));
+            break;
+
+        case FUSED_GREATER:
+            SET_LOGIC(out, LOGICAL(a > b));
+            break;
+
+        case FUSED_GREATER_OR_EQUAL:
+            SET_LOGIC(out, LOGICAL(a >= b));
+            break;
+
+        default:
+            return FALSE;
+        }
+    }
+    else {
+        // Mixed INTEGER! and DECIMAL! math is done as DECIMAL!.  Comparisons
+        // of decimals are left alone, since equality is approximate.
+        //
+        REBDEC a = IS_INTEGER(out)
+            ? cast(REBDEC, VAL_INT64(out))
+            : VAL_DECIMAL(out);
+        REBDEC b = IS_INTEGER(arg)
+            ? cast(REBDEC, VAL_INT64(arg))
+            : VAL_DECIMAL(arg);
+        REBDEC result;
+
+        switch (op) {
+        case FUSED_ADD:
+            result = a + b;
+            break;
+
+        case FUSED_SUBTRACT:
+            result = a - b;
+            break;
+
+        case FUSED_MULTIPLY:
+            result = a * b;
+            break;
+
+        default:
+            return FALSE;
+        }
+
+        if (!FINITE(result))
+            return FALSE; // let the generic path raise the overflow error
+
+        SET_DECIMAL(out, result);
+    }
+
+    return TRUE;
+}
+
+
+// Infix lookahead found f->gotten as a lookback function, with f->out as the
+// left hand side.  If Fused_Arithmetic_Core() can do it, f->out gets the
+// result and f->value is on whatever follows the right hand side.
+//
+static inline REBOOL Try_Fused_Arithmetic(REBFRM *f)
+{
+    if (f->pending != NULL || Trace_Flags)
+        return FALSE; // can only peek in arrays, and tracing shows the call
+
+    if (NOT(Fused_Arithmetic_Core(
+        f->out, f->gotten, ARR_AT(f->source.array, f->index), f->specifier
+    ))){
+        return FALSE;
+    }
+
+    f->gotten = NULL;
+    Fetch_Next_In_Frame(f); // right hand side
+    Fetch_Next_In_Frame(f); // whatever follows
+    return TRUE;
+}
+
+
+// `x: x + 1` (a DECODED_SET_ARITHMETIC) would otherwise push the SET-WORD!,
+// start a new expression for `x`, fetch it, look ahead to find `+` infix,
+// and then do Try_Fused_Arithmetic().  Here that is all done in one step.
+//
+// If the pattern applies, the SET-WORD! is pushed as pending just like the
+// SET-WORD! case does, f->out has the result and f->value is on whatever
+// follows the right hand side.  The caller then continues with the ordinary
+// lookahead, so `x: x + 1 * 2` still multiplies before assigning.  Else
+// FALSE is returned and nothing has changed.
+//
+static inline REBOOL Try_Fused_Set_Arithmetic(REBFRM *f)
+{
+    if (f->flags.bits & DO_FLAG_NO_LOOKAHEAD)
+        return FALSE; // the infix function wouldn't be run
+
+    const RELVAL *left = ARR_AT(f->source.array, f->index);
+    assert(IS_WORD(left));
+
+    const RELVAL *infix = left + 1;
+    assert(IS_WORD(infix));
+
+    if (NOT(IS_WORD_BOUND(left)) || NOT(IS_WORD_BOUND(infix)))
+        return FALSE; // let the generic path give the error
+
+    enum Reb_Kind eval_type;
+
+    const REBVAL *var = Get_Var_Core(
+        &eval_type, left, f->specifier, GETVAR_READ_ONLY
+    );
+    if (NOT(IS_INTEGER(var) || IS_DECIMAL(var)))
+        return FALSE;
+
+    const REBVAL *func = Get_Var_Core(
+        &eval_type, infix, f->specifier, GETVAR_READ_ONLY
+    );
+    if (
+        eval_type != REB_0_LOOKBACK
+        || NOT(IS_FUNCTION(func))
+        || (
+            GET_VAL_FLAG(func, FUNC_FLAG_DEFERS_LOOKBACK_ARG)
+            && (f->flags.bits & DO_FLAG_FULFILLING_ARG)
+        )
+    ){
+        return FALSE;
+    }
+
+    REBVAL result;
+    result = *var;
+    if (NOT(Fused_Arithmetic_Core(&result, func, infix + 1, f->specifier)))
+        return FALSE;
+
+    DS_PUSH_TRASH;
+    Derelativize_Core(DS_TOP, f->value, f->specifier, FALSE); // as SET-WORD!
+    *f->out = result;
+
+    f->gotten = NULL;
+    Fetch_Next_In_Frame(f); // left hand side
+    Fetch_Next_In_Frame(f); // infix function
+    Fetch_Next_In_Frame(f); // right hand side
+    Fetch_Next_In_Frame(f); // whatever follows
+    return TRUE;
+}
+
+
 //
 //  Do_Core: C
 //
@@ -353,6 +851,33 @@ do_next:;
     START_NEW_EXPRESSION_MAY_THROW(f, goto finished);
     // ^-- sets args_evaluate, do_count, Ctrl-C may abort
 
+    // Before the switch, see if Decode_Array() found a pattern starting at
+    // this value which can be run as a superinstruction.  Compilers which
+    // support it (GCC, Clang) jump straight through a table of label
+    // addresses instead of going through a bounds-checked switch.
+    //
+#if defined(__GNUC__)
+    {
+        static void * const decoded_labels[DECODED_MAX] = {
+            &&reevaluate, // DECODED_GENERIC
+            &&do_decoded_branch, // DECODED_BRANCH
+            &&do_decoded_set_arithmetic // DECODED_SET_ARITHMETIC
+        };
+        goto *decoded_labels[Decoded_Op(f, args_evaluate)];
+    }
+#else
+    switch (Decoded_Op(f, args_evaluate)) {
+    case DECODED_BRANCH:
+        goto do_decoded_branch;
+
+    case DECODED_SET_ARITHMETIC:
+        goto do_decoded_set_arithmetic;
+
+    default:
+        break; // DECODED_GENERIC
+    }
+#endif
+
 reevaluate:;
     //
     // ^-- doesn't advance expression index, so `eval x` starts with `eval`
@@ -1055,6 +1580,16 @@ reevaluate:;
         if (Trace_Flags)
             Trace_Func(FRM_LABEL(f));
 
+        if (PG_Profiling)
+            Profile_Enter(f); // see Profile_Exit() in frame dropping
+
+        // Natives may keep their arguments anywhere, so a BLOCK! or WORD!
+        // passed in that is bound to a stack frame stops that frame's
+        // varlist from being reused (see SERIES_INFO_FRAME_ESCAPED).
+        //
+        if (NOT(GET_VAL_FLAG(FUNC_VALUE(f->func), FUNC_FLAG_ARGS_DONT_ESCAPE)))
+            Note_Args_Escaped(f->args_head, FUNC_NUM_PARAMS(f->underlying));
+
         // The out slot needs initialization for GC safety during the function
         // run.  Choosing an END marker should be legal because places that
         // you can use as output targets can't be visible to the GC (that
@@ -1249,6 +1784,17 @@ reevaluate:;
         if (Trace_Flags)
             Trace_Return(FRM_LABEL(f), f->out);
 
+        // A result made from the body, as in `func [x] [[x]]`, refers to the
+        // frame that is about to end.  So does `func [] [:return]`.
+        //
+        if (
+            f->varlist != NULL
+            && (ANY_WORD(f->out) || ANY_ARRAY(f->out) || IS_FUNCTION(f->out))
+            && f->out->extra.binding == f->varlist
+        ){
+            Note_Binding_Escaped(f->out);
+        }
+
         // !!! It would technically be possible to drop the arguments before
         // running chains... and if the chained function were to run *in*
         // this frame that could be even more optimal.  However, having the
@@ -1322,6 +1868,30 @@ reevaluate:;
 //
 //==//////////////////////////////////////////////////////////////////////==//
 
+    do_decoded_branch:
+        //
+        // The WORD! is followed by a WORD! and a BLOCK!, so it may be an IF
+        // or UNLESS that Try_Fused_Conditional() can run.  Look it up as the
+        // WORD! case would, and continue there if it isn't.
+        //
+        if (f->gotten == NULL)
+            f->gotten = Get_Var_Core(
+                &f->eval_type, f->value, f->specifier, GETVAR_READ_ONLY
+            );
+        else if (IS_FUNCTION(f->gotten))
+            f->eval_type = REB_FUNCTION;
+
+        if (
+            f->eval_type == REB_FUNCTION
+            && IS_FUNCTION(f->gotten)
+            && Try_Fused_Conditional(f)
+        ){
+            if (THROWN(f->out))
+                goto finished;
+            break;
+        }
+        goto do_word_in_gotten;
+
     case REB_WORD:
     do_word_in_value:
         if (f->gotten == NULL) // no work to reuse from failed optimization
@@ -1333,6 +1903,8 @@ reevaluate:;
                 f->eval_type = REB_FUNCTION;
         }
 
+    do_word_in_gotten:
+
         // eval_type will be set to either REB_0_LOOKBACK or REB_FUNCTION
 
         if (IS_FUNCTION(f->gotten)) { // before IS_VOID() speeds common case
@@ -1385,9 +1957,21 @@ reevaluate:;
 //
 //==//////////////////////////////////////////////////////////////////////==//
 
+    do_decoded_set_arithmetic:
+        if (Try_Fused_Set_Arithmetic(f))
+            goto lookahead; // may be more infix before the pending assignment
+
+        // fall through
+
     case REB_SET_WORD:
         assert(IS_SET_WORD(f->value));
-        DS_PUSH_RELVAL(f->value, f->specifier);
+
+        // The pushed word only lives until it is assigned, which happens
+        // before this frame finishes...so it does not count as a reference
+        // that escapes a function's frame (unless Lookback captures it)
+        //
+        DS_PUSH_TRASH;
+        Derelativize_Core(DS_TOP, f->value, f->specifier, FALSE);
 
         // ^-- see Do_Pending_Sets_May_Invalidate_Gotten() for real assignment
 
@@ -1645,6 +2229,8 @@ reevaluate:;
     // 1...it needs to wait.  The pending sets are not flushed until the
     // infix operation has finished.
 
+lookahead:;
+
     if (IS_END(f->value)) {
         Do_Pending_Sets_May_Invalidate_Gotten(f->out, f); // don't care if does
         goto finished;
@@ -1718,6 +2304,9 @@ reevaluate:;
                 // pending SET-WORD!s or SET-PATH!s to the *result* of this
                 // lookback expression.
                 //
+                if (args_evaluate && Try_Fused_Arithmetic(f))
+                    goto lookahead; // result may be left side of more infix
+
                 SET_FRAME_LABEL(f, VAL_WORD_SPELLING(f->value));
                 f->refine = LOOKBACK_ARG;
                 goto do_function_in_gotten;
@@ -1728,6 +2317,15 @@ reevaluate:;
             if (f->gotten == NULL)
                 goto do_word_in_value; // pay for refetch, lookbacks see end
 
+            if (
+                Decoded_Op(f, args_evaluate) == DECODED_BRANCH
+                && Try_Fused_Conditional(f)
+            ){
+                if (THROWN(f->out))
+                    goto finished;
+                goto lookahead;
+            }
+
             SET_END(f->out);
             SET_FRAME_LABEL(f, VAL_WORD_SPELLING(f->value));
             f->refine = ORDINARY_ARG;
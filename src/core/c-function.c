@@ -997,6 +997,7 @@ done_caching:;
     // facilitates the "Hijacker" to change multiple REBVALs behavior.
 
     AS_SERIES(body_holder)->misc.dispatcher = dispatcher;
+    AS_SERIES(body_holder)->link.calls = 0; // see Tier_Up_If_Hot()
 
     // To avoid NULL checking when a function is called and looking for the
     // underlying function, put the functions own pointer in if needed
@@ -1629,6 +1630,30 @@ REB_R Typeset_Checker_Dispatcher(REBFRM *f)
 }
 
 
+// Interpreted functions count their calls, and when they reach the number
+// set by `jit <integer>` they try to replace their dispatcher with compiled
+// code.  If that works, the dispatcher is run again (now the compiled one).
+//
+inline static REBOOL Tier_Up_If_Hot(REBFRM *f)
+{
+#if defined(WITH_TCC)
+    if (PG_Jit_Threshold == 0)
+        return FALSE;
+
+    REBSER *holder = AS_SERIES(
+        FUNC_VALUE(f->func)->payload.function.body_holder
+    );
+    if (++holder->link.calls != PG_Jit_Threshold)
+        return FALSE;
+
+    return Jit_Compile_Function(f->func);
+#else
+    UNUSED(f);
+    return FALSE;
+#endif
+}
+
+
 //
 //  Unchecked_Dispatcher: C
 //
@@ -1638,6 +1663,9 @@ REB_R Typeset_Checker_Dispatcher(REBFRM *f)
 //
 REB_R Unchecked_Dispatcher(REBFRM *f)
 {
+    if (Tier_Up_If_Hot(f))
+        return R_REDO_UNCHECKED;
+
     RELVAL *body = FUNC_BODY(f->func);
     assert(IS_BLOCK(body) && IS_RELATIVE(body) && VAL_INDEX(body) == 0);
 
@@ -1645,7 +1673,7 @@ REB_R Unchecked_Dispatcher(REBFRM *f)
         f->out,
         VAL_ARRAY(body),
         VAL_INDEX(body),
-        AS_SPECIFIER(Context_For_Frame_May_Reify_Managed(f))
+        Specifier_For_Frame_May_Reify(f)
     )){
         return R_OUT_IS_THROWN;
     }
@@ -1663,6 +1691,9 @@ REB_R Unchecked_Dispatcher(REBFRM *f)
 //
 REB_R Voider_Dispatcher(REBFRM *f)
 {
+    if (Tier_Up_If_Hot(f))
+        return R_REDO_UNCHECKED;
+
     RELVAL *body = FUNC_BODY(f->func);
     assert(IS_BLOCK(body) && IS_RELATIVE(body) && VAL_INDEX(body) == 0);
 
@@ -1670,7 +1701,7 @@ REB_R Voider_Dispatcher(REBFRM *f)
         f->out,
         VAL_ARRAY(body),
         VAL_INDEX(body),
-        AS_SPECIFIER(Context_For_Frame_May_Reify_Managed(f))
+        Specifier_For_Frame_May_Reify(f)
     )){
         return R_OUT_IS_THROWN;
     }
@@ -1688,6 +1719,9 @@ REB_R Voider_Dispatcher(REBFRM *f)
 //
 REB_R Returner_Dispatcher(REBFRM *f)
 {
+    if (Tier_Up_If_Hot(f))
+        return R_REDO_UNCHECKED;
+
     RELVAL *body = FUNC_BODY(f->func);
     assert(IS_BLOCK(body) && IS_RELATIVE(body) && VAL_INDEX(body) == 0);
 
@@ -1695,7 +1729,7 @@ REB_R Returner_Dispatcher(REBFRM *f)
         f->out,
         VAL_ARRAY(body),
         VAL_INDEX(body),
-        AS_SPECIFIER(Context_For_Frame_May_Reify_Managed(f))
+        Specifier_For_Frame_May_Reify(f)
     )){
         return R_OUT_IS_THROWN;
     }
@@ -1822,7 +1856,7 @@ REB_R Adapter_Dispatcher(REBFRM *f)
         f->out,
         VAL_ARRAY(prelude),
         VAL_INDEX(prelude),
-        AS_SPECIFIER(Context_For_Frame_May_Reify_Managed(f))
+        Specifier_For_Frame_May_Reify(f)
     )){
         return R_OUT_IS_THROWN;
     }
@@ -0,0 +1,1487 @@
+//
+//  File: %c-jit.c
+//  Summary: "compile hot interpreted functions to C with the embedded TCC"
+//  Section: core
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2017 Rebol Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Builds that embed TCC for user natives (see %n-native.c) can also use it
+// to replace the dispatcher of an interpreted FUNCTION! with compiled code.
+// This happens when JIT is called on the function, or automatically once it
+// has been called the number of times given by `jit <integer>`:
+//
+//     fib: func [n] [
+//         if n < 2 [return n]
+//         (fib n - 1) + (fib n - 2)
+//     ]
+//     jit :fib ;-- TRUE if the body could be compiled
+//
+// The generated C does exactly what the evaluator would do for the body, but
+// without walking the array.  Only a subset of bodies are compiled, and any
+// body using something outside of it is left interpreted:
+//
+// * INTEGER!, DECIMAL!, CHAR! and STRING! literals
+// * reading and setting the function's arguments and locals, as long as
+//   they can't hold a FUNCTION! (which would be called)
+// * GROUP!s
+// * calls to functions bound in contexts (e.g. lib) with only normal
+//   arguments, and tight infix operators (+, <, etc.)
+// * IF, UNLESS, EITHER and WHILE with BLOCK! branches, in a position where
+//   their result is not used
+// * RETURN (and LEAVE in procedures)
+//
+// Arithmetic and comparison on two INTEGER!s are done inline, with anything
+// else (decimals, overflow...) calling the operator's function as usual.
+//
+// What the compiled code depends on is which functions the words in the
+// body referred to when it was compiled, and whether they were infix.  Each
+// call checks those words are still set the same, and if not the original
+// dispatcher is put back and runs the body ("deoptimization").  Since the
+// check is on entry, a redefinition done while a compiled call is in
+// progress affects only the calls after it.
+//
+// !!! Each compilation has its own TCCState, and it lives as long as the
+// interpreter does (a deoptimized function may still have compiled calls in
+// progress further up the stack).  So that a function whose words keep
+// getting redefined can't pile these up, it is only compiled JIT_MAX_COMPILES
+// times, after which it stays interpreted.
+//
+
+#include "sys-core.h"
+
+#if defined(WITH_TCC)
+
+#include "libtcc.h"
+
+extern const REBYTE core_header_source[];
+
+#define CHAR_HEAD(x) cs_cast(BIN_HEAD(x))
+
+// Most arguments a compiled call can pass, see Jit_Call_Throws()
+//
+#define JIT_MAX_ARGS 6
+
+// Most times one function is compiled, see Jit_Compile_Function()
+//
+#define JIT_MAX_COMPILES 4
+
+// The interpreted dispatchers that can be replaced.  Their index is kept in
+// the compilation's info array so the function can be restored.
+//
+enum {
+    JIT_UNCHECKED,
+    JIT_VOIDER,
+    JIT_RETURNER,
+    JIT_MAX_KIND
+};
+
+static REBNAT Jit_Replaceable[JIT_MAX_KIND] = {
+    &Unchecked_Dispatcher,
+    &Voider_Dispatcher,
+    &Returner_Dispatcher
+};
+
+// Each compilation has an "info" array, which the generated code gets at as
+// `jit_info`.  It's kept alive by ROOT_JIT_FUNCTIONS.  After the fixed slots
+// come guards (a WORD!, the FUNCTION! it had, and a LOGIC! of whether it was
+// infix) and constants the code copies (never WORD!s).
+//
+enum {
+    JIT_INFO_FUNCTION, // the function that was compiled
+    JIT_INFO_STATE, // HANDLE! of the TCCState
+    JIT_INFO_ENTRY, // HANDLE! of the compiled dispatcher
+    JIT_INFO_KIND, // INTEGER! index in Jit_Replaceable
+    JIT_INFO_FIRST_GUARD
+};
+
+// Operators that the generated code can do inline for INTEGER!s
+//
+enum Jit_Op {
+    JIT_OP_NONE,
+    JIT_OP_ADD,
+    JIT_OP_SUBTRACT,
+    JIT_OP_MULTIPLY,
+    JIT_OP_EQUAL,
+    JIT_OP_NOT_EQUAL,
+    JIT_OP_LESSER,
+    JIT_OP_LESSER_OR_EQUAL,
+    JIT_OP_GREATER,
+    JIT_OP_GREATER_OR_EQUAL
+};
+
+// How a word in the body is compiled
+//
+enum Jit_Word {
+    JIT_WORD_NONE, // not supported
+    JIT_WORD_ARG, // argument or local of the function
+    JIT_WORD_RETURN, // its definitional RETURN
+    JIT_WORD_LEAVE, // its definitional LEAVE
+    JIT_WORD_FUNCTION, // prefix function in a context
+    JIT_WORD_ENFIX // infix function in a context
+};
+
+// What the body does with each argument and local.  An argument or local
+// word that holds a FUNCTION! is a call, which the compiled code can't do,
+// so it is only compiled if nothing can have put a function there: the
+// typeset doesn't allow one (it was checked when the frame was filled) and
+// no assignment in the body stores something that might be one.
+//
+#define JIT_VAR_READ 0x01 // read by a WORD!
+#define JIT_VAR_MAY_BE_FUNCTION 0x02 // set to a value that may be a FUNCTION!
+
+struct Jit_State {
+    REBFUN *func; // function being compiled
+    REBARR *info; // guards and constants the code refers to
+    REBSER *out; // mold buffer the C source is written to
+    REBSER *vars; // JIT_VAR_XXX flags for each parameter, by index
+    REBOOL may_be_function; // whether the last value compiled could be one
+    REBCNT temps; // temporaries in use, jit_t[0] to jit_t[temps - 1]
+    REBCNT max_temps; // how many temporaries the code needs reserved
+    REBCNT loop; // label of the innermost WHILE, 0 if none
+    REBCNT labels; // for making unique labels
+};
+
+// Definitions used by all generated code
+//
+static const char Jit_Prelude[] =
+    "\n# 0 \"jit\" 1\n"
+    "extern REBARR jit_info;\n"
+    "#define JIT_INFO(n) KNOWN(ARR_AT(&jit_info, (n)))\n"
+    "#define JIT_I(n) VAL_INT64(&jit_t[n])\n"
+    "#define JIT_INTS(a,b) (IS_INTEGER(&jit_t[a]) && IS_INTEGER(&jit_t[b]))\n"
+    "#define JIT_SMALL(x) ((x) >= -MAX_I32 && (x) <= MAX_I32)\n"
+    "#define JIT_INT(a,e) (jit_i = (e), SET_INTEGER(&jit_t[a], jit_i), TRUE)\n"
+    "#define JIT_LOGIC(a,e) (jit_b = (e), SET_LOGIC(&jit_t[a], jit_b), TRUE)\n"
+    "#define JIT_ADD(a,b) (JIT_INTS(a,b) \\\n"
+    "    && NOT((JIT_I(b) > 0 && JIT_I(a) > MAX_I64 - JIT_I(b)) \\\n"
+    "        || (JIT_I(b) < 0 && JIT_I(a) < MIN_I64 - JIT_I(b))) \\\n"
+    "    && JIT_INT(a, JIT_I(a) + JIT_I(b)))\n"
+    "#define JIT_SUBTRACT(a,b) (JIT_INTS(a,b) \\\n"
+    "    && NOT((JIT_I(b) < 0 && JIT_I(a) > MAX_I64 + JIT_I(b)) \\\n"
+    "        || (JIT_I(b) > 0 && JIT_I(a) < MIN_I64 + JIT_I(b))) \\\n"
+    "    && JIT_INT(a, JIT_I(a) - JIT_I(b)))\n"
+    "#define JIT_MULTIPLY(a,b) (JIT_INTS(a,b) \\\n"
+    "    && JIT_SMALL(JIT_I(a)) && JIT_SMALL(JIT_I(b)) \\\n"
+    "    && JIT_INT(a, JIT_I(a) * JIT_I(b)))\n"
+    "#define JIT_COMPARE(a,b,op) (JIT_INTS(a,b) \\\n"
+    "    && JIT_LOGIC(a, LOGICAL(JIT_I(a) op JIT_I(b))))\n"
+    "\n";
+
+
+//
+//  Emit: C
+//
+// Append C source to the compilation.  Only %d (a REBINT) and %s are
+// understood in the format.
+//
+static void Emit(struct Jit_State *j, const char *fmt, ...)
+{
+    va_list va;
+    va_start(va, fmt);
+
+    const char *cp = fmt;
+    while (*cp != '\0') {
+        const char *percent = strchr(cp, '%');
+        if (percent == NULL) {
+            Append_Unencoded(j->out, cp);
+            break;
+        }
+
+        Append_Unencoded_Len(j->out, cp, percent - cp);
+        if (percent[1] == 'd')
+            Append_Int(j->out, va_arg(va, REBINT));
+        else {
+            assert(percent[1] == 's');
+            Append_Unencoded(j->out, va_arg(va, const char*));
+        }
+        cp = percent + 2;
+    }
+
+    va_end(va);
+}
+
+
+//
+//  Emit_Thrown: C
+//
+// Where generated code goes when a call throws (the thrown value has been
+// put in f->out): out of the function, or to the innermost WHILE to see if
+// it is a BREAK or CONTINUE.
+//
+static void Emit_Thrown(struct Jit_State *j)
+{
+    if (j->loop == 0)
+        Emit(j, "return R_OUT_IS_THROWN;\n");
+    else
+        Emit(j, "goto jit_caught_%d;\n", cast(REBINT, j->loop));
+}
+
+
+//
+//  Alloc_Temp: C
+//
+static REBCNT Alloc_Temp(struct Jit_State *j)
+{
+    REBCNT n = j->temps++;
+    if (j->temps > j->max_temps)
+        j->max_temps = j->temps;
+    return n;
+}
+
+
+//
+//  Add_Guard: C
+//
+// Remember what a word looked up to, returning the position of the guard in
+// the info array (the function is in the position after it).
+//
+static REBCNT Add_Guard(
+    struct Jit_State *j,
+    const RELVAL *word,
+    const REBVAL *var,
+    REBOOL enfix
+){
+    REBCNT n;
+    for (n = JIT_INFO_FIRST_GUARD; n < ARR_LEN(j->info); ++n) {
+        RELVAL *item = ARR_AT(j->info, n);
+        if (
+            IS_WORD(item)
+            && item->extra.binding == word->extra.binding
+            && VAL_WORD_INDEX(item) == VAL_WORD_INDEX(word)
+        ){
+            return n;
+        }
+    }
+
+    n = ARR_LEN(j->info);
+
+    *Alloc_Tail_Array(j->info) = *word;
+    VAL_SET_TYPE_BITS(ARR_AT(j->info, n), REB_WORD); // may be a SET-WORD!
+    *Alloc_Tail_Array(j->info) = *var;
+    SET_LOGIC(Alloc_Tail_Array(j->info), enfix);
+
+    return n;
+}
+
+
+//
+//  Classify_Word: C
+//
+// For an argument or local of the function, *index is the parameter number.
+// For a function in a context, *index is the position of its guard.
+//
+static enum Jit_Word Classify_Word(
+    struct Jit_State *j,
+    const RELVAL *word,
+    REBCNT *index
+){
+    if (!IS_WORD_BOUND(word))
+        return JIT_WORD_NONE;
+
+    if (IS_RELATIVE(word)) {
+        if (VAL_RELATIVE(word) != j->func)
+            return JIT_WORD_NONE;
+
+        *index = VAL_WORD_INDEX(word);
+        switch (VAL_PARAM_CLASS(FUNC_PARAM(j->func, *index))) {
+        case PARAM_CLASS_NORMAL:
+        case PARAM_CLASS_LOCAL:
+            return JIT_WORD_ARG;
+
+        case PARAM_CLASS_RETURN:
+            return JIT_WORD_RETURN;
+
+        case PARAM_CLASS_LEAVE:
+            return JIT_WORD_LEAVE;
+
+        default:
+            return JIT_WORD_NONE;
+        }
+    }
+
+    enum Reb_Kind eval_type;
+    const REBVAL *var = Get_Var_Core(
+        &eval_type, word, SPECIFIED, GETVAR_READ_ONLY
+    );
+    if (!IS_FUNCTION(var))
+        return JIT_WORD_NONE; // !!! could read variables in contexts
+
+    REBOOL enfix = LOGICAL(eval_type == REB_0_LOOKBACK);
+    *index = Add_Guard(j, word, var, enfix);
+    return enfix ? JIT_WORD_ENFIX : JIT_WORD_FUNCTION;
+}
+
+
+//
+//  Is_Enfix_Word: C
+//
+static REBOOL Is_Enfix_Word(const RELVAL *item)
+{
+    if (!IS_WORD(item) || !IS_WORD_BOUND(item) || IS_RELATIVE(item))
+        return FALSE;
+
+    enum Reb_Kind eval_type;
+    const REBVAL *var = Get_Var_Core(
+        &eval_type, item, SPECIFIED, GETVAR_READ_ONLY
+    );
+    return LOGICAL(IS_FUNCTION(var) && eval_type == REB_0_LOOKBACK);
+}
+
+
+//
+//  Jit_Op_Of: C
+//
+static enum Jit_Op Jit_Op_Of(REBFUN *op)
+{
+    REBNAT dispatcher = FUNC_DISPATCHER(op);
+
+    if (dispatcher == &Action_Dispatcher) {
+        switch (STR_SYMBOL(VAL_WORD_SPELLING(FUNC_BODY(op)))) {
+        case SYM_ADD:
+            return JIT_OP_ADD;
+
+        case SYM_SUBTRACT:
+            return JIT_OP_SUBTRACT;
+
+        case SYM_MULTIPLY:
+            return JIT_OP_MULTIPLY;
+
+        default:
+            return JIT_OP_NONE;
+        }
+    }
+
+    if (dispatcher == &N_equal_q || dispatcher == &N_strict_equal_q)
+        return JIT_OP_EQUAL;
+    if (dispatcher == &N_not_equal_q || dispatcher == &N_strict_not_equal_q)
+        return JIT_OP_NOT_EQUAL;
+    if (dispatcher == &N_lesser_q)
+        return JIT_OP_LESSER;
+    if (dispatcher == &N_lesser_or_equal_q)
+        return JIT_OP_LESSER_OR_EQUAL;
+    if (dispatcher == &N_greater_q)
+        return JIT_OP_GREATER;
+    if (dispatcher == &N_greater_or_equal_q)
+        return JIT_OP_GREATER_OR_EQUAL;
+
+    return JIT_OP_NONE;
+}
+
+
+//
+//  Emit_Call: C
+//
+// Call the function of a guard with `num` arguments in the temporaries from
+// `first`, which gets the result.
+//
+static void Emit_Call(
+    struct Jit_State *j,
+    REBCNT guard,
+    REBCNT first,
+    REBCNT num
+){
+    Emit(
+        j,
+        "    if (Jit_Call_Throws(f, jit_dsp, JIT_INFO(%d), %d, %d))\n        ",
+        cast(REBINT, guard + 1),
+        cast(REBINT, first),
+        cast(REBINT, num)
+    );
+    Emit_Thrown(j);
+    Emit(j, "    jit_t = Jit_Temps(jit_dsp);\n");
+}
+
+
+static REBOOL Jit_Primary(
+    struct Jit_State *j,
+    const RELVAL **item,
+    REBCNT dest
+);
+static REBOOL Jit_Expression(
+    struct Jit_State *j,
+    const RELVAL **item,
+    REBCNT dest
+);
+static REBOOL Jit_Statements(
+    struct Jit_State *j,
+    const RELVAL *item,
+    REBOOL want_value,
+    REBCNT dest
+);
+
+
+//
+//  Jit_Call: C
+//
+// Gather the arguments of a prefix function into temporaries and call it.
+// Refinements are left unused, as when the function is called by a WORD!.
+//
+static REBOOL Jit_Call(
+    struct Jit_State *j,
+    const RELVAL **item,
+    REBCNT guard,
+    REBCNT dest
+){
+    REBFUN *fun = VAL_FUNC(KNOWN(ARR_AT(j->info, guard + 1)));
+
+    REBCNT num = 0;
+    REBVAL *param = FUNC_PARAMS_HEAD(fun);
+    for (; NOT_END(param); ++param) {
+        enum Reb_Param_Class pclass = VAL_PARAM_CLASS(param);
+
+        switch (pclass) {
+        case PARAM_CLASS_LOCAL:
+        case PARAM_CLASS_RETURN:
+        case PARAM_CLASS_LEAVE:
+            break;
+
+        case PARAM_CLASS_REFINEMENT:
+            goto done_args;
+
+        case PARAM_CLASS_NORMAL: {
+            if (GET_VAL_FLAG(param, TYPESET_FLAG_VARIADIC))
+                return FALSE;
+            if (num == JIT_MAX_ARGS)
+                return FALSE;
+
+            REBCNT arg = num == 0 ? dest : Alloc_Temp(j);
+            assert(arg == dest + num);
+
+            if (GET_VAL_FLAG(param, TYPESET_FLAG_TIGHT)) {
+                if (!Jit_Primary(j, item, arg))
+                    return FALSE;
+            }
+            else {
+                if (!Jit_Expression(j, item, arg))
+                    return FALSE;
+            }
+            ++num;
+            break; }
+
+        default:
+            return FALSE; // quoted arguments
+        }
+    }
+
+done_args:
+    Emit_Call(j, guard, dest, num);
+    j->temps = dest + 1;
+    return TRUE;
+}
+
+
+//
+//  Jit_Primary: C
+//
+// Compile one value (without any infix after it) into jit_t[dest], which
+// must be the most recently allocated temporary.
+//
+static REBOOL Jit_Primary(
+    struct Jit_State *j,
+    const RELVAL **item,
+    REBCNT dest
+){
+    const RELVAL *v = *item;
+    REBCNT index;
+
+    assert(dest + 1 == j->temps);
+
+    if (IS_END(v))
+        return FALSE;
+
+    if (IS_INTEGER(v) || IS_DECIMAL(v) || IS_CHAR(v) || IS_STRING(v)) {
+        REBCNT k = ARR_LEN(j->info);
+        *Alloc_Tail_Array(j->info) = *v;
+        Emit(
+            j,
+            "    jit_t[%d] = *JIT_INFO(%d);\n"
+            "    SET_VAL_FLAG(&jit_t[%d], VALUE_FLAG_UNEVALUATED);\n",
+            cast(REBINT, dest), cast(REBINT, k), cast(REBINT, dest)
+        );
+        ++*item;
+        j->may_be_function = FALSE;
+        return TRUE;
+    }
+
+    if (IS_GROUP(v)) {
+        ++*item;
+        return Jit_Statements(j, VAL_ARRAY_AT(v), TRUE, dest);
+    }
+
+    if (IS_SET_WORD(v)) {
+        if (Classify_Word(j, v, &index) != JIT_WORD_ARG)
+            return FALSE;
+
+        ++*item;
+        if (!Jit_Expression(j, item, dest))
+            return FALSE;
+
+        Emit(
+            j,
+            "    *FRM_ARG(f, %d) = jit_t[%d];\n",
+            cast(REBINT, index), cast(REBINT, dest)
+        );
+        if (j->may_be_function)
+            *BIN_AT(j->vars, index) |= JIT_VAR_MAY_BE_FUNCTION;
+        return TRUE;
+    }
+
+    if (!IS_WORD(v))
+        return FALSE;
+
+    ++*item;
+
+    switch (Classify_Word(j, v, &index)) {
+    case JIT_WORD_ARG:
+        if (TYPE_CHECK(FUNC_PARAM(j->func, index), REB_FUNCTION))
+            return FALSE;
+        *BIN_AT(j->vars, index) |= JIT_VAR_READ;
+        j->may_be_function = FALSE;
+
+        Emit(
+            j,
+            "    if (IS_VOID(FRM_ARG(f, %d)))\n"
+            "        Jit_Fail_No_Value(f, %d);\n"
+            "    jit_t[%d] = *FRM_ARG(f, %d);\n"
+            "    CLEAR_VAL_FLAG(&jit_t[%d], VALUE_FLAG_UNEVALUATED);\n",
+            cast(REBINT, index), cast(REBINT, index),
+            cast(REBINT, dest), cast(REBINT, index),
+            cast(REBINT, dest)
+        );
+        return TRUE;
+
+    case JIT_WORD_RETURN:
+        if (!Jit_Expression(j, item, dest))
+            return FALSE;
+
+        Emit(
+            j,
+            "    Jit_Check_Return_Arg(f, %d, &jit_t[%d]);\n"
+            "    *f->out = jit_t[%d];\n"
+            "    goto jit_return;\n",
+            cast(REBINT, index), cast(REBINT, dest), cast(REBINT, dest)
+        );
+        return TRUE;
+
+    case JIT_WORD_LEAVE:
+        Emit(j, "    goto jit_return;\n");
+        return TRUE;
+
+    case JIT_WORD_FUNCTION:
+        if (!Jit_Call(j, item, index, dest))
+            return FALSE;
+        j->may_be_function = TRUE; // !!! could check the return typeset
+        return TRUE;
+
+    default:
+        return FALSE;
+    }
+}
+
+
+//
+//  Jit_Expression: C
+//
+// Compile a value and any tight infix operations after it into jit_t[dest],
+// which must be the most recently allocated temporary.
+//
+static REBOOL Jit_Expression(
+    struct Jit_State *j,
+    const RELVAL **item,
+    REBCNT dest
+){
+    if (!Jit_Primary(j, item, dest))
+        return FALSE;
+
+    while (Is_Enfix_Word(*item)) {
+        REBCNT guard;
+        if (Classify_Word(j, *item, &guard) != JIT_WORD_ENFIX)
+            return FALSE;
+        ++*item;
+
+        // Only tight operators are compiled, whose right argument is just
+        // the next value (and doesn't do infix lookahead of its own), and
+        // whose left argument is not deferred.
+        //
+        const REBVAL *op_value = KNOWN(ARR_AT(j->info, guard + 1));
+        REBFUN *op = VAL_FUNC(op_value);
+        if (
+            FUNC_NUM_PARAMS(op) != 2
+            || GET_VAL_FLAG(op_value, FUNC_FLAG_DEFERS_LOOKBACK_ARG)
+        ){
+            return FALSE;
+        }
+        REBCNT n;
+        for (n = 1; n <= 2; ++n) {
+            REBVAL *param = FUNC_PARAM(op, n);
+            if (
+                VAL_PARAM_CLASS(param) != PARAM_CLASS_NORMAL
+                || NOT_VAL_FLAG(param, TYPESET_FLAG_TIGHT)
+                || GET_VAL_FLAG(param, TYPESET_FLAG_VARIADIC)
+            ){
+                return FALSE;
+            }
+        }
+
+        REBCNT right = Alloc_Temp(j);
+        assert(right == dest + 1);
+        if (!Jit_Primary(j, item, right))
+            return FALSE;
+
+        const char *inline_op;
+        switch (Jit_Op_Of(op)) {
+        case JIT_OP_ADD:
+            inline_op = "JIT_ADD(%d, %d)";
+            break;
+
+        case JIT_OP_SUBTRACT:
+            inline_op = "JIT_SUBTRACT(%d, %d)";
+            break;
+
+        case JIT_OP_MULTIPLY:
+            inline_op = "JIT_MULTIPLY(%d, %d)";
+            break;
+
+        case JIT_OP_EQUAL:
+            inline_op = "JIT_COMPARE(%d, %d, ==)";
+            break;
+
+        case JIT_OP_NOT_EQUAL:
+            inline_op = "JIT_COMPARE(%d, %d, !=)";
+            break;
+
+        case JIT_OP_LESSER:
+            inline_op = "JIT_COMPARE(%d, %d, <)";
+            break;
+
+        case JIT_OP_LESSER_OR_EQUAL:
+            inline_op = "JIT_COMPARE(%d, %d, <=)";
+            break;
+
+        case JIT_OP_GREATER:
+            inline_op = "JIT_COMPARE(%d, %d, >)";
+            break;
+
+        case JIT_OP_GREATER_OR_EQUAL:
+            inline_op = "JIT_COMPARE(%d, %d, >=)";
+            break;
+
+        default:
+            inline_op = NULL;
+        }
+
+        // The inlined operators give numbers or LOGIC!s, whether or not
+        // they fall back on calling the function.
+        //
+        j->may_be_function = LOGICAL(inline_op == NULL);
+
+        if (inline_op == NULL)
+            Emit_Call(j, guard, dest, 2);
+        else {
+            Emit(j, "    if (!");
+            Emit(j, inline_op, cast(REBINT, dest), cast(REBINT, right));
+            Emit(j, ") {\n");
+            Emit_Call(j, guard, dest, 2);
+            Emit(j, "    }\n");
+        }
+
+        j->temps = dest + 1;
+    }
+
+    return TRUE;
+}
+
+
+//
+//  Jit_Control: C
+//
+// IF, UNLESS, EITHER and WHILE with BLOCK! branches are compiled to C
+// control flow when their result isn't needed.  Returns FALSE if the
+// construct couldn't be compiled; *item is left alone if it isn't one.
+//
+static REBOOL Jit_Control(struct Jit_State *j, const RELVAL **item)
+{
+    const RELVAL *v = *item;
+    if (!IS_WORD(v) || !IS_WORD_BOUND(v) || IS_RELATIVE(v))
+        return TRUE;
+
+    enum Reb_Kind eval_type;
+    const REBVAL *var = Get_Var_Core(
+        &eval_type, v, SPECIFIED, GETVAR_READ_ONLY
+    );
+    if (!IS_FUNCTION(var) || eval_type != REB_FUNCTION)
+        return TRUE;
+
+    REBNAT dispatcher = VAL_FUNC_DISPATCHER(var);
+    if (
+        dispatcher != &N_if
+        && dispatcher != &N_unless
+        && dispatcher != &N_either
+        && dispatcher != &N_while
+    ){
+        return TRUE;
+    }
+
+    REBCNT guard = Add_Guard(j, v, var, FALSE);
+    const RELVAL *next = v + 1;
+
+    if (dispatcher == &N_while) {
+        if (!IS_BLOCK(next) || !IS_BLOCK(next + 1))
+            return FALSE;
+
+        REBINT label = cast(REBINT, ++j->labels);
+
+        Emit(j, "    while (TRUE) {\n    if (Jit_Loop_Throws(f))\n        ");
+        Emit_Thrown(j);
+        Emit(j, "    jit_t = Jit_Temps(jit_dsp);\n");
+
+        REBCNT cond = Alloc_Temp(j);
+        if (!Jit_Statements(j, VAL_ARRAY_AT(next), TRUE, cond))
+            return FALSE;
+
+        Emit(
+            j,
+            "    if (IS_VOID(&jit_t[%d]))\n"
+            "        fail (Error(RE_NO_RETURN));\n"
+            "    if (IS_CONDITIONAL_FALSE(&jit_t[%d]))\n"
+            "        break;\n",
+            cast(REBINT, cond), cast(REBINT, cond)
+        );
+        j->temps = cond;
+
+        REBCNT outer = j->loop;
+        j->loop = label;
+        if (!Jit_Statements(j, VAL_ARRAY_AT(next + 1), FALSE, 0))
+            return FALSE;
+        j->loop = outer;
+
+        Emit(
+            j,
+            "    continue;\n"
+            "  jit_caught_%d: {\n"
+            "        REBOOL jit_stop;\n"
+            "        if (!Catching_Break_Or_Continue(f->out, &jit_stop))\n"
+            "            ",
+            label
+        );
+        Emit_Thrown(j);
+        Emit(j, "        if (jit_stop)\n            break;\n    }\n    }\n");
+
+        *item = next + 2;
+        return TRUE;
+    }
+
+    // IF, UNLESS or EITHER.  Note that the condition may be an expression
+    // spanning several values, so the branches are found after compiling it.
+
+    ++*item;
+    REBCNT cond = Alloc_Temp(j);
+    if (!Jit_Expression(j, item, cond))
+        return FALSE;
+
+    const RELVAL *branch = *item;
+    if (!IS_BLOCK(branch))
+        return FALSE;
+    if (dispatcher == &N_either && !IS_BLOCK(branch + 1))
+        return FALSE;
+
+    Emit(
+        j,
+        "    if (IS_VOID(&jit_t[%d]))\n"
+        "        Jit_Fail_Void_Arg(JIT_INFO(%d), 1);\n"
+        "    if (%sIS_CONDITIONAL_TRUE_SAFE(&jit_t[%d])) {\n",
+        cast(REBINT, cond),
+        cast(REBINT, guard),
+        dispatcher == &N_unless ? "!" : "",
+        cast(REBINT, cond)
+    );
+    j->temps = cond;
+
+    if (!Jit_Statements(j, VAL_ARRAY_AT(branch), FALSE, 0))
+        return FALSE;
+
+    if (dispatcher == &N_either) {
+        Emit(j, "    }\n    else {\n");
+        if (!Jit_Statements(j, VAL_ARRAY_AT(branch + 1), FALSE, 0))
+            return FALSE;
+        *item = branch + 2;
+    }
+    else
+        *item = branch + 1;
+
+    Emit(j, "    }\n");
+    return TRUE;
+}
+
+
+//
+//  Jit_Statements: C
+//
+// Compile the expressions of a block.  If `want_value` then the last one's
+// result goes in jit_t[dest], which must be the most recently allocated
+// temporary.
+//
+static REBOOL Jit_Statements(
+    struct Jit_State *j,
+    const RELVAL *item,
+    REBOOL want_value,
+    REBCNT dest
+){
+    if (IS_END(item))
+        return FALSE; // !!! empty blocks give void, not done yet
+
+    while (NOT_END(item)) {
+        const RELVAL *start = item;
+        if (!Jit_Control(j, &item))
+            return FALSE;
+
+        if (item != start) {
+            //
+            // The result of the construct isn't made, so it can't be the
+            // value of the block, or have infix (like ELSE) applied to it.
+            //
+            if (want_value && IS_END(item))
+                return FALSE;
+            if (Is_Enfix_Word(item))
+                return FALSE;
+            continue;
+        }
+
+        REBCNT slot = want_value ? dest : Alloc_Temp(j);
+        if (!Jit_Expression(j, &item, slot))
+            return FALSE;
+        if (!want_value)
+            j->temps = slot;
+    }
+
+    return TRUE;
+}
+
+
+//
+//  jit_error_report: C
+//
+// TCC errors on generated code just mean the function won't be compiled.
+//
+static void jit_error_report(void *opaque, const char *msg)
+{
+    UNUSED(msg);
+    *cast(REBOOL*, opaque) = TRUE;
+}
+
+
+//
+//  jit_cleanup: C
+//
+static void jit_cleanup(const REBVAL *val)
+{
+    assert(IS_HANDLE(val));
+    tcc_delete(cast(TCCState*, VAL_HANDLE_POINTER(val)));
+}
+
+
+//
+//  Jit_Compile_Core: C
+//
+static REBOOL Jit_Compile_Core(REBFUN *func, REBINT kind)
+{
+    struct Jit_State jit;
+    struct Jit_State *j = &jit;
+
+    j->func = func;
+    j->info = Make_Array(JIT_INFO_FIRST_GUARD + 8);
+    j->vars = Make_Binary(FUNC_NUM_PARAMS(func) + 1);
+    CLEAR(BIN_HEAD(j->vars), FUNC_NUM_PARAMS(func) + 1);
+    j->may_be_function = FALSE;
+    j->temps = 0;
+    j->max_temps = 0;
+    j->loop = 0;
+    j->labels = 0;
+
+    Append_Value(j->info, FUNC_VALUE(func));
+    SET_BLANK(Alloc_Tail_Array(j->info));
+    SET_BLANK(Alloc_Tail_Array(j->info));
+    SET_INTEGER(Alloc_Tail_Array(j->info), kind);
+
+    REB_MOLD mo;
+    CLEARS(&mo);
+    Push_Mold(&mo);
+    j->out = mo.series;
+
+    Append_Unencoded(j->out, cs_cast(core_header_source));
+    Append_Unencoded(j->out, Jit_Prelude);
+
+    Emit(
+        j,
+        "static REB_R jit_run(REBFRM *f, REBDSP jit_dsp)\n"
+        "{\n"
+        "    REBVAL *jit_t = Jit_Temps(jit_dsp);\n"
+        "    REBI64 jit_i;\n"
+        "    REBOOL jit_b;\n"
+        "\n"
+    );
+
+    RELVAL *body = FUNC_BODY(func);
+    REBOOL want_value = LOGICAL(kind != JIT_VOIDER);
+    REBCNT result = want_value ? Alloc_Temp(j) : 0;
+
+    REBOOL ok = Jit_Statements(j, VAL_ARRAY_AT(body), want_value, result);
+
+    REBCNT n;
+    for (n = 1; ok && n <= FUNC_NUM_PARAMS(func); ++n) {
+        REBYTE uses = *BIN_AT(j->vars, n);
+        if ((uses & JIT_VAR_READ) && (uses & JIT_VAR_MAY_BE_FUNCTION))
+            ok = FALSE;
+    }
+    Free_Series(j->vars);
+
+    if (!ok) {
+        Drop_Mold(&mo);
+        Free_Array(j->info);
+        return FALSE;
+    }
+
+    if (want_value)
+        Emit(j, "    *f->out = jit_t[%d];\n", cast(REBINT, result));
+
+    Emit(j, "  jit_return:\n");
+    switch (kind) {
+    case JIT_UNCHECKED:
+        Emit(j, "    return R_OUT;\n");
+        break;
+
+    case JIT_VOIDER:
+        Emit(j, "    return R_VOID;\n");
+        break;
+
+    case JIT_RETURNER:
+        Emit(j, "    Jit_Check_Return(f);\n    return R_OUT;\n");
+        break;
+
+    default:
+        assert(FALSE);
+    }
+
+    Emit(
+        j,
+        "}\n"
+        "\n"
+        "REB_R jit_main(REBFRM *f)\n"
+        "{\n"
+        "    REBDSP jit_dsp;\n"
+        "    REB_R r;\n"
+        "\n"
+        "    if (Jit_Must_Interpret(f, &jit_info))\n"
+        "        return Jit_Interpret(f, &jit_info);\n"
+        "\n"
+        "    jit_dsp = Jit_Push_Temps(%d);\n"
+        "    r = jit_run(f, jit_dsp);\n"
+        "    Jit_Drop_Temps(jit_dsp);\n"
+        "    return r;\n"
+        "}\n",
+        cast(REBINT, j->max_temps)
+    );
+
+    REBSER *source = Pop_Molded_UTF8(&mo);
+
+    REBOOL failed = FALSE;
+    void *entry = NULL;
+
+    TCCState *state = tcc_new();
+    if (state == NULL)
+        failed = TRUE;
+    else {
+        tcc_set_error_func(state, &failed, jit_error_report);
+
+        // Everything the code uses comes from the interpreter's symbols, see
+        // Add_Symbols_To_TCC().
+        //
+        if (
+            tcc_set_options(state, "-nostdlib") < 0
+            || tcc_set_output_type(state, TCC_OUTPUT_MEMORY) < 0
+            || tcc_compile_string(state, CHAR_HEAD(source)) < 0
+            || !Add_Symbols_To_TCC(state)
+            || tcc_add_symbol(state, "jit_info", j->info) < 0
+            || tcc_relocate(state, TCC_RELOCATE_AUTO) < 0
+        ){
+            failed = TRUE;
+        }
+        else
+            entry = tcc_get_symbol(state, "jit_main");
+    }
+
+    Free_Series(source);
+
+    if (failed || entry == NULL) {
+        if (state != NULL)
+            tcc_delete(state);
+        Free_Array(j->info);
+        return FALSE;
+    }
+
+    Init_Handle_Managed(
+        ARR_AT(j->info, JIT_INFO_STATE),
+        state,
+        0,
+        &jit_cleanup
+    );
+    Init_Handle_Simple(ARR_AT(j->info, JIT_INFO_ENTRY), entry, 0);
+
+    if (IS_BLANK(ROOT_JIT_FUNCTIONS))
+        Set_Root_Series(ROOT_JIT_FUNCTIONS, AS_SERIES(Make_Array(8)));
+    Init_Block(Alloc_Tail_Array(VAL_ARRAY(ROOT_JIT_FUNCTIONS)), j->info);
+
+    AS_SERIES(
+        FUNC_VALUE(func)->payload.function.body_holder
+    )->misc.dispatcher = cast(REBNAT, entry);
+
+    return TRUE;
+}
+
+
+//
+//  Count_Jit_Compilations: C
+//
+// Number of times the function has been compiled, including compilations
+// that were deoptimized.
+//
+static REBCNT Count_Jit_Compilations(REBFUN *func)
+{
+    if (IS_BLANK(ROOT_JIT_FUNCTIONS))
+        return 0;
+
+    REBCNT count = 0;
+    RELVAL *item = VAL_ARRAY_AT(ROOT_JIT_FUNCTIONS);
+    for (; NOT_END(item); ++item) {
+        if (VAL_FUNC(ARR_AT(VAL_ARRAY(item), JIT_INFO_FUNCTION)) == func)
+            ++count;
+    }
+    return count;
+}
+
+
+//
+//  Jit_Compile_Function: C
+//
+// Replace the dispatcher of an interpreted function with compiled code, if
+// its body only uses what the compiler supports.  Returns FALSE if not.
+//
+REBOOL Jit_Compile_Function(REBFUN *func)
+{
+    REBNAT dispatcher = FUNC_DISPATCHER(func);
+
+    REBINT kind;
+    for (kind = 0; kind < JIT_MAX_KIND; ++kind) {
+        if (dispatcher == Jit_Replaceable[kind])
+            break;
+    }
+    if (kind == JIT_MAX_KIND)
+        return FALSE;
+
+    // Every compilation keeps its TCCState (see notes at top of file), so
+    // one that keeps being deoptimized isn't compiled again indefinitely.
+    //
+    if (Count_Jit_Compilations(func) >= JIT_MAX_COMPILES)
+        return FALSE;
+
+    // The frame is filled in by the evaluator, so the compiled code only
+    // needs to handle the parameter classes of its own body's words.
+    //
+    REBVAL *param = FUNC_PARAMS_HEAD(func);
+    for (; NOT_END(param); ++param) {
+        switch (VAL_PARAM_CLASS(param)) {
+        case PARAM_CLASS_NORMAL:
+        case PARAM_CLASS_LOCAL:
+        case PARAM_CLASS_RETURN:
+        case PARAM_CLASS_LEAVE:
+            if (GET_VAL_FLAG(param, TYPESET_FLAG_VARIADIC))
+                return FALSE;
+            break;
+
+        default:
+            return FALSE; // !!! refinements and quoting not done yet
+        }
+    }
+
+    // Looking up words may fail (e.g. a word bound into a frame that has
+    // ended), which just means the body isn't compiled.
+    //
+    struct Reb_State state;
+    REBCTX *error;
+
+    PUSH_TRAP(&error, &state);
+
+// The first time through the following code 'error' will be NULL, but...
+// `fail` can longjmp here, so 'error' won't be NULL *if* that happens!
+
+    if (error)
+        return FALSE;
+
+    REBOOL compiled = Jit_Compile_Core(func, kind);
+
+    DROP_TRAP_SAME_STACKLEVEL_AS_PUSH(&state);
+
+    return compiled;
+}
+
+
+//
+//  Jit_Entry: C
+//
+// The compiled dispatcher of a compilation.
+//
+static REBNAT Jit_Entry(REBARR *info)
+{
+    return cast(REBNAT, VAL_HANDLE_POINTER(ARR_AT(info, JIT_INFO_ENTRY)));
+}
+
+
+//
+//  Is_Jit_Compiled: C
+//
+// Whether the function runs compiled code.  (Its dispatcher could be that of
+// any compilation, e.g. a HIJACK proxy inherits the one of its victim.)
+//
+REBOOL Is_Jit_Compiled(REBFUN *func)
+{
+    if (IS_BLANK(ROOT_JIT_FUNCTIONS))
+        return FALSE;
+
+    RELVAL *item = VAL_ARRAY_AT(ROOT_JIT_FUNCTIONS);
+    for (; NOT_END(item); ++item) {
+        if (FUNC_DISPATCHER(func) == Jit_Entry(VAL_ARRAY(item)))
+            return TRUE;
+    }
+    return FALSE;
+}
+
+
+//=//// RUNTIME SUPPORT FOR GENERATED CODE ////////////////////////////////=//
+//
+// These are called by the code compiled by TCC.  That code only gets at the
+// interpreter through functions (not global variables), and keeps its
+// temporaries on the data stack where the GC can see them.  Since the data
+// stack may move when code runs, it gets the address again after calls.
+//
+
+//
+//  Jit_Push_Temps: C
+//
+REBDSP Jit_Push_Temps(REBCNT num)
+{
+    REBDSP dsp = DSP;
+    for (; num != 0; --num) {
+        DS_PUSH_TRASH;
+        SET_BLANK(DS_TOP);
+    }
+    return dsp;
+}
+
+
+//
+//  Jit_Temps: C
+//
+REBVAL *Jit_Temps(REBDSP dsp)
+{
+    return DS_AT(dsp + 1);
+}
+
+
+//
+//  Jit_Drop_Temps: C
+//
+void Jit_Drop_Temps(REBDSP dsp)
+{
+    DS_DROP_TO(dsp);
+}
+
+
+//
+//  Jit_Call_Throws: C
+//
+// Call a function with `num` arguments from the temporaries starting at
+// `first`, putting the result in the first one.  If it throws, the thrown
+// value is in f->out.
+//
+REBOOL Jit_Call_Throws(
+    REBFRM *f,
+    REBDSP dsp,
+    const REBVAL *fun,
+    REBCNT first,
+    REBCNT num
+){
+    // The arguments are only read while the callee's frame is filled, which
+    // does not push to the data stack...but the result is written later.
+    //
+    REBVAL *a = DS_AT(dsp + 1 + first);
+    REBVAL result;
+    REBOOL threw;
+
+    switch (num) {
+    case 0:
+        threw = Apply_Only_Throws(&result, TRUE, fun, END_CELL);
+        break;
+
+    case 1:
+        threw = Apply_Only_Throws(&result, TRUE, fun, a, END_CELL);
+        break;
+
+    case 2:
+        threw = Apply_Only_Throws(&result, TRUE, fun, a, a + 1, END_CELL);
+        break;
+
+    case 3:
+        threw = Apply_Only_Throws(
+            &result, TRUE, fun, a, a + 1, a + 2, END_CELL
+        );
+        break;
+
+    case 4:
+        threw = Apply_Only_Throws(
+            &result, TRUE, fun, a, a + 1, a + 2, a + 3, END_CELL
+        );
+        break;
+
+    case 5:
+        threw = Apply_Only_Throws(
+            &result, TRUE, fun, a, a + 1, a + 2, a + 3, a + 4, END_CELL
+        );
+        break;
+
+    case 6:
+        threw = Apply_Only_Throws(
+            &result, TRUE, fun, a, a + 1, a + 2, a + 3, a + 4, a + 5,
+            END_CELL
+        );
+        break;
+
+    default:
+        assert(FALSE); // see JIT_MAX_ARGS
+        threw = FALSE;
+        SET_VOID(&result);
+    }
+
+    if (threw) {
+        *f->out = result;
+        return TRUE;
+    }
+
+    *DS_AT(dsp + 1 + first) = result;
+    return FALSE;
+}
+
+
+//
+//  Jit_Loop_Throws: C
+//
+// Compiled loops count against the evaluator's signal checking, as each
+// pass through an interpreted loop would.
+//
+REBOOL Jit_Loop_Throws(REBFRM *f)
+{
+    assert(Eval_Count >= 0);
+    if (--Eval_Count == 0) {
+        REBVAL cell;
+        if (Do_Signals_Throws(&cell)) {
+            *f->out = cell;
+            return TRUE;
+        }
+
+        if (!IS_VOID(&cell))
+            fail (Error(RE_MISC)); // see Start_New_Expression_Throws()
+    }
+    return FALSE;
+}
+
+
+//
+//  Jit_Fail_No_Value: C
+//
+void Jit_Fail_No_Value(REBFRM *f, REBCNT n)
+{
+    REBVAL word;
+    Init_Any_Word_Bound(
+        &word,
+        REB_WORD,
+        VAL_PARAM_SPELLING(FUNC_PARAM(f->func, n)),
+        Context_For_Frame_May_Reify_Managed(f),
+        n
+    );
+    fail (Error_No_Value(&word));
+}
+
+
+//
+//  Jit_Fail_Void_Arg: C
+//
+// `guard` is the word a compiled native call came from, with the function
+// after it in the info array.
+//
+void Jit_Fail_Void_Arg(const REBVAL *guard, REBCNT n)
+{
+    fail (Error_Arg_Type(
+        VAL_WORD_SPELLING(guard),
+        FUNC_PARAM(VAL_FUNC(guard + 1), n),
+        REB_MAX_VOID
+    ));
+}
+
+
+//
+//  Jit_Check_Return_Arg: C
+//
+// Type check done by a definitional RETURN (see REBNATIVE(return)).
+//
+void Jit_Check_Return_Arg(REBFRM *f, REBCNT n, const REBVAL *value)
+{
+    REBVAL *typeset = FUNC_PARAM(f->func, n);
+    assert(VAL_PARAM_SYM(typeset) == SYM_RETURN);
+
+    if (!TYPE_CHECK(typeset, VAL_TYPE(value)))
+        fail (Error_Bad_Return_Type(Canon(SYM_RETURN), VAL_TYPE(value)));
+}
+
+
+//
+//  Jit_Check_Return: C
+//
+// Type check done by Returner_Dispatcher() when the end of the body is
+// reached.
+//
+void Jit_Check_Return(REBFRM *f)
+{
+    REBVAL *typeset = FUNC_PARAM(f->func, FUNC_NUM_PARAMS(f->func));
+    assert(VAL_PARAM_SYM(typeset) == SYM_RETURN);
+
+    if (!TYPE_CHECK(typeset, VAL_TYPE(f->out)))
+        fail (Error_Bad_Return_Type(f->label, VAL_TYPE(f->out)));
+}
+
+
+//
+//  Jit_Must_Interpret: C
+//
+// Checked on entry to compiled code.  If a word the code depends on has
+// been set to something else, the function goes back to its interpreted
+// dispatcher for good (and counts calls again toward a new compilation, if
+// it hasn't reached JIT_MAX_COMPILES).
+// Tracing also runs the interpreted body, so the trace shows it.
+//
+// The function running may not be the one that was compiled: HIJACK makes
+// its proxy with the victim's dispatcher, and then gives the victim one of
+// its own.  So it's the running function that is changed back, and only if
+// it still has this compilation's dispatcher.
+//
+REBOOL Jit_Must_Interpret(REBFRM *f, REBARR *info)
+{
+    if (Trace_Flags)
+        return TRUE;
+
+    RELVAL *item = ARR_AT(info, JIT_INFO_FIRST_GUARD);
+    while (NOT_END(item)) {
+        if (!IS_WORD(item)) {
+            ++item; // constant
+            continue;
+        }
+
+        enum Reb_Kind eval_type;
+        const REBVAL *var = Get_Var_Core(
+            &eval_type, item, SPECIFIED, GETVAR_READ_ONLY
+        );
+        const RELVAL *fun = item + 1;
+        if (
+            !IS_FUNCTION(var)
+            || VAL_FUNC(var) != VAL_FUNC(fun)
+            || var->extra.binding != fun->extra.binding
+            || LOGICAL(eval_type == REB_0_LOOKBACK) != VAL_LOGIC(item + 2)
+        ){
+            REBSER *holder = AS_SERIES(
+                FUNC_VALUE(f->func)->payload.function.body_holder
+            );
+            if (holder->misc.dispatcher == Jit_Entry(info)) {
+                holder->misc.dispatcher = Jit_Replaceable[
+                    VAL_INT32(ARR_AT(info, JIT_INFO_KIND))
+                ];
+                holder->link.calls = 0;
+            }
+            return TRUE;
+        }
+
+        item += 3;
+    }
+
+    return FALSE;
+}
+
+
+//
+//  Jit_Interpret: C
+//
+REB_R Jit_Interpret(REBFRM *f, REBARR *info)
+{
+    REBNAT dispatcher = Jit_Replaceable[
+        VAL_INT32(ARR_AT(info, JIT_INFO_KIND))
+    ];
+    return dispatcher(f);
+}
+
+#endif // WITH_TCC
+
+
+//
+//  jit: native [
+//
+//  {Compile interpreted functions to native code, if the build has TCC.}
+//
+//      return: [logic!]
+//          {TRUE if the function runs compiled (or the threshold was set)}
+//      target [function! integer!]
+//          {Function to compile now, or number of calls after which any
+//          interpreted function is compiled automatically (0 for never)}
+//  ]
+//
+REBNATIVE(jit)
+{
+    INCLUDE_PARAMS_OF_JIT;
+
+    REBVAL *target = ARG(target);
+
+#if !defined(WITH_TCC)
+    UNUSED(target);
+    return R_FALSE;
+#else
+    if (IS_INTEGER(target)) {
+        if (VAL_INT64(target) < 0)
+            fail (Error_Invalid_Arg(target));
+        PG_Jit_Threshold = Int32(target);
+        return R_TRUE;
+    }
+
+    REBFUN *func = VAL_FUNC(target);
+    if (Is_Jit_Compiled(func) || Jit_Compile_Function(func))
+        return R_TRUE;
+
+    return R_FALSE;
+#endif
+}
@@ -601,7 +601,7 @@ typedef struct rebol_scheme_actions {
     REBPAF fun;
 } SCHEME_ACTIONS;
 
-SCHEME_ACTIONS *Scheme_Actions; // Initial Global (not threaded)
+THREAD_LOCAL SCHEME_ACTIONS *Scheme_Actions; // Initial Global (per-instance)
 
 
 //
@@ -711,6 +711,10 @@ void Init_Ports(void)
 #ifdef HAS_POSIX_SIGNAL
     Init_Signal_Scheme();
 #endif
+
+#ifdef HAS_PROCESS_PORT
+    Init_Process_Scheme();
+#endif
 }
 
 
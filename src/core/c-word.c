@@ -96,79 +96,197 @@ REBINT Get_Hash_Prime(REBCNT size)
 }
 
 
-// Removals from linear probing lists can be complex, because the same
-// overflow slot may be visited through different initial hashes:
+// The canon table is a power-of-two sized array of slots, probed linearly
+// from the slot picked by the low bits of a spelling's hash.  Each slot keeps
+// the full 32-bit hash (its "tag") next to the canon pointer, so a probe only
+// does a UTF-8 comparison when the tags agree--and growing the table doesn't
+// need to hash any spellings again.
+//
+// When the table gets half full, a table twice the size is made, and the
+// canons are moved into it a few slots at a time on each new interning,
+// instead of all at once.  While that is in progress the old table is still
+// searched for canons that haven't moved yet.
+//
+// Lookups and interning both assume they are the only thing touching the
+// table.  There is no lock-free reader for scanners running in parallel: the
+// scanner runs on one thread, and with REB_INSTANCES each interpreter has a
+// word table of its own (see sys-core.h).  Sharing one table between threads
+// would need canon pointers published with release/acquire ordering, and
+// replaced tables kept alive until no reader could still be probing them.
+//
+struct Reb_Canon_Slot {
+    REBCNT tag; // Hash_Spelling() of the canon
+    REBSTR *canon; // NULL if the slot is free
+};
+
+#define CANON_MIGRATE_STEP 8 // old slots moved per interning during growth
+
+
 //
-// http://stackoverflow.com/a/279812/211160
+//  Hash_Spelling: C
 //
-// Since it's not enough to simply NULL out the spot when an interned string
-// is GC'd, a special pointer signaling "deletedness" is used.  It does not
-// cause a linear probe to terminate, but it is reused on insertions.
+// Case-insensitive hash of UTF-8 data, agreeing with Compare_UTF8() on which
+// spellings are synonyms.  (FNV-1a over the lowercased codepoints, with a
+// final mix since the table is indexed by the low bits.)
 //
-static REBSTR PG_Deleted_Canon;
-#define DELETED_CANON &PG_Deleted_Canon
+static REBCNT Hash_Spelling(const REBYTE *utf8, REBCNT len)
+{
+    REBCNT hash = 2166136261u;
+
+    for (; len > 0; ++utf8, --len) {
+        REBUNI c = *utf8;
+        if (c >= 0x80) {
+            utf8 = Back_Scan_UTF8_Char(&c, utf8, &len);
+            assert(utf8); // UTF8 should have already been verified good
+        }
+        if (c < UNICODE_CASES)
+            c = LO_CASE(c);
+
+        hash = (hash ^ c) * 16777619u;
+    }
+
+    hash ^= hash >> 16;
+    hash *= 0x7feb352du;
+    hash ^= hash >> 15;
+    hash *= 0x846ca68bu;
+    hash ^= hash >> 16;
+    return hash;
+}
 
 
 //
-//  Expand_Word_Table: C
+//  Probe_Canons: C
 //
-// Expand the hash table part of the word_table by allocating
-// the next larger table size and rehashing all the words of
-// the current table.  Free the old hash array.
+// Search a canon table for the canon of a spelling.  Returns the slot that
+// holds it, or the free slot where the search ended if there isn't one.
 //
-static void Expand_Word_Table(void)
-{
-    // The only full list of canon words available is the old hash table.
-    // Hold onto it while creating the new hash table.
+static struct Reb_Canon_Slot *Probe_Canons(
+    REBSER *table,
+    REBCNT tag,
+    const REBYTE *utf8,
+    REBCNT len
+){
+    struct Reb_Canon_Slot *slots = SER_HEAD(struct Reb_Canon_Slot, table);
+    REBCNT mask = SER_LEN(table) - 1;
 
-    REBCNT old_size = SER_LEN(PG_Canons_By_Hash);
-    REBSTR* *old_canons_by_hash = SER_HEAD(REBSER*, PG_Canons_By_Hash);
+    REBCNT n = tag & mask;
+    for (;; n = (n + 1) & mask) {
+        REBSTR *canon = slots[n].canon;
+        if (canon == NULL)
+            return &slots[n];
 
-    REBCNT new_size = Get_Hash_Prime(old_size + 1);
-    if (new_size == 0) {
-        REBVAL temp;
-        SET_INTEGER(&temp, old_size + 1);
-        fail (Error(RE_SIZE_LIMIT, &temp));
+        // Compare_UTF8() is 0 for an exact match, and > 0 when the canon
+        // is another casing of the spelling (both mean it's the right one)
+        //
+        if (
+            slots[n].tag == tag
+            && Compare_UTF8(STR_HEAD(canon), utf8, len) >= 0
+        ){
+            assert(GET_SER_FLAG(canon, STRING_FLAG_CANON));
+            return &slots[n];
+        }
     }
+}
 
-    assert(SER_WIDE(PG_Canons_By_Hash) == sizeof(REBSTR*));
 
-    REBSER *ser = Make_Series(new_size, sizeof(REBSTR*), MKS_POWER_OF_2);
-    Clear_Series(ser);
-    SET_SERIES_LEN(ser, new_size);
+//
+//  Find_Synonym: C
+//
+// Given a canon, find the interning with exactly the spelling (if any).
+// The synonyms are a circularly linked list, starting from the canon.
+//
+static REBSTR *Find_Synonym(REBSTR *canon, const REBYTE *utf8, REBCNT len)
+{
+    REBSTR *intern = canon;
+    do {
+        REBINT cmp = Compare_UTF8(STR_HEAD(intern), utf8, len);
+        if (cmp == 0)
+            return intern;
+        assert(cmp > 0); // should at least be a synonym, if in this list
+
+        intern = intern->link.synonym;
+    } while (intern != canon);
 
-    // Rehash all the symbols:
+    return NULL;
+}
 
-    REBSTR **new_canons_by_hash = SER_HEAD(REBSER*, ser);
 
-    REBCNT n;
-    for (n = 0; n < old_size; ++n) {
-        REBSTR *canon = old_canons_by_hash[n];
+//
+//  Claim_Canon_Slot: C
+//
+// Put a canon in a table known not to contain it.
+//
+static void Claim_Canon_Slot(REBSER *table, REBCNT tag, REBSTR *canon)
+{
+    struct Reb_Canon_Slot *slots = SER_HEAD(struct Reb_Canon_Slot, table);
+    REBCNT mask = SER_LEN(table) - 1;
 
-        if (canon == NULL) continue;
+    REBCNT n = tag & mask;
+    while (slots[n].canon != NULL)
+        n = (n + 1) & mask;
 
-        if (canon == DELETED_CANON) { // clean out any deleted canon entries
-            --PG_Num_Canon_Slots_In_Use;
-        #if !defined(NDEBUG)
-            --PG_Num_Canon_Deleteds; // keep track for shutdown assert
-        #endif
-            continue;
-        }
+    slots[n].tag = tag;
+    slots[n].canon = canon;
+}
 
-        REBINT hash = Hash_Word(STR_HEAD(canon), STR_NUM_BYTES(canon));
-        REBINT skip = (hash & 0x0000FFFF) % new_size;
-        if (skip == 0) skip = 1;
-        hash = (hash & 0x00FFFF00) % new_size;
 
-        while (new_canons_by_hash[hash] != NULL) {
-            hash += skip;
-            if (hash >= cast(REBINT, new_size))
-                hash -= new_size;
-        }
-        new_canons_by_hash[hash] = canon;
+//
+//  Migrate_Canons: C
+//
+// Move up to `count` slots of the old table into the new one.  Once all of
+// them are moved, the old table is freed and no longer searched.
+//
+static void Migrate_Canons(REBCNT count)
+{
+    REBSER *old = PG_Canons_By_Hash_Old;
+    assert(old != NULL);
+
+    struct Reb_Canon_Slot *slots = SER_HEAD(struct Reb_Canon_Slot, old);
+    REBCNT size = SER_LEN(old);
+
+    REBCNT n = PG_Canons_Migrated;
+    REBCNT limit = (count >= size - n) ? size : n + count;
+    for (; n < limit; ++n) {
+        if (slots[n].canon != NULL)
+            Claim_Canon_Slot(PG_Canons_By_Hash, slots[n].tag, slots[n].canon);
     }
+    PG_Canons_Migrated = n;
 
-    Free_Series(PG_Canons_By_Hash);
+    if (n == size) {
+        Free_Series(old);
+        PG_Canons_By_Hash_Old = NULL;
+    }
+}
+
+
+//
+//  Expand_Word_Table: C
+//
+// Start moving the canons to a table twice the size.  The new table must be
+// able to take all the remaining interning that happens before the move is
+// finished, which it can: it starts a quarter full, and the whole old table
+// is moved after 1/CANON_MIGRATE_STEP of its size more have been interned.
+//
+static void Expand_Word_Table(void)
+{
+    assert(PG_Canons_By_Hash_Old == NULL);
+
+    REBCNT old_size = SER_LEN(PG_Canons_By_Hash);
+    if (old_size > MAX_U32 / 2 / sizeof(struct Reb_Canon_Slot)) {
+        REBVAL temp;
+        SET_INTEGER(&temp, old_size + 1);
+        fail (Error(RE_SIZE_LIMIT, &temp));
+    }
+
+    REBCNT new_size = old_size * 2;
+    REBSER *ser = Make_Series(
+        new_size, sizeof(struct Reb_Canon_Slot), MKS_NONE
+    );
+    Clear_Series(ser);
+    SET_SERIES_LEN(ser, new_size);
+
+    PG_Canons_Migrated = 0;
+    PG_Canons_By_Hash_Old = PG_Canons_By_Hash;
     PG_Canons_By_Hash = ser;
 }
 
@@ -193,103 +311,33 @@ static void Expand_Word_Table(void)
 //
 REBSTR *Intern_UTF8_Managed(const REBYTE *utf8, REBCNT len)
 {
-    // The hashing technique used is called "linear probing":
+    // Growth is checked *before* the search, so the free slot the search
+    // ends on is still the one to use.
     //
-    // https://en.wikipedia.org/wiki/Linear_probing
-    //
-    // For the hash search to be guaranteed to terminate, the table must be
-    // large enough that we are able to find a NULL if there's a miss.  (It's
-    // actually kept larger than that, but to be on the right side of theory,
-    // the table is always checked for expansion needs *before* the search.)
-    //
-    REBCNT size = SER_LEN(PG_Canons_By_Hash);
-    if (PG_Num_Canon_Slots_In_Use > size / 2) {
+    if (PG_Canons_By_Hash_Old != NULL)
+        Migrate_Canons(CANON_MIGRATE_STEP);
+    else if (PG_Num_Canons >= SER_LEN(PG_Canons_By_Hash) / 2)
         Expand_Word_Table();
-        size = SER_LEN(PG_Canons_By_Hash); // got larger
-    }
 
-    REBSTR* *canons_by_hash = SER_HEAD(REBSER*, PG_Canons_By_Hash);
-
-    // Calculate the starting hash slot to try--and the amount to skip to by
-    // each time a slot is found that is occupied by a non-match.
-    //
-    REBCNT hash = Hash_Word(utf8, len);
-    REBCNT skip = (hash & 0x0000FFFF) % size;
-    if (skip == 0) skip = 1;
-    hash = (hash & 0x00FFFF00) % size;
+    REBCNT tag = Hash_Spelling(utf8, len);
 
-    REBSTR **deleted_slot = NULL;
-
-    // The hash table only indexes the canon form of each spelling.  So when
-    // testing a slot to see if it's a match (or a collision that needs to
-    // be skipped to try again) the search uses a comparison that is
-    // case-insensitive...and returns a value > 0 for a match.
-    //
-    // However, the result also indicates whether it was an *exact* match, by
-    // returning 0 if it is.
-    //
-    REBSTR* canon;
-    while ((canon = canons_by_hash[hash]) != NULL) {
-        if (canon == DELETED_CANON) {
-            deleted_slot = &canons_by_hash[hash];
-            hash += skip;
-            if (hash >= size) hash -= size;
-            continue;
-        }
-
-        assert(GET_SER_FLAG(canon, STRING_FLAG_CANON));
-
-        // Compare_UTF8 returns 0 when the spelling is a case-sensitive match,
-        // and is the exact interning to return.
-        //
-        REBINT cmp = Compare_UTF8(STR_HEAD(canon), utf8, len);
-        if (cmp == 0) return canon;
-
-        if (cmp < 0) {
-            //
-            // Compare_UTF8 returns less than zero when the canon value in the
-            // slot isn't the same at all.  Since it's not a match, skip ahead
-            // to the next candidate slot--wrapping around if necessary
-            //
-            hash += skip;
-            if (hash >= size) hash -= size;
-            continue;
-        }
-
-        // The > 0 result means that the canon word that was found is an
-        // alternate casing ("synonym") for the string we're interning.  The
-        // synonyms are attached to the canon form with a circularly linked
-        // list.  Walk the list to see if any of the synonyms are a match.
-        //
-        REBSTR *synonym = canon->link.synonym;
-        while (synonym != canon) {
-            assert(synonym->misc.canon == canon);
-            assert(NOT_SER_FLAG(synonym, STRING_FLAG_CANON));
+    struct Reb_Canon_Slot *slot = Probe_Canons(
+        PG_Canons_By_Hash, tag, utf8, len
+    );
 
-            // Exact match for a synonym also means no new allocation needed.
-            //
-            cmp = Compare_UTF8(STR_HEAD(synonym), utf8, len);
-            if (cmp == 0) return synonym;
+    REBSTR *canon = slot->canon;
+    if (canon == NULL && PG_Canons_By_Hash_Old != NULL)
+        canon = Probe_Canons(PG_Canons_By_Hash_Old, tag, utf8, len)->canon;
 
-            // Comparison should at least be a synonym, if in this list.
-            // Keep checking for an exact match until a cycle is found.
-            //
-            assert(cmp > 0);
-            synonym = synonym->link.synonym;
-        }
+    if (canon != NULL) {
+        REBSTR *synonym = Find_Synonym(canon, utf8, len);
+        if (synonym != NULL)
+            return synonym;
 
         // If none of the synonyms matched, then this case variation needs
         // to get its own interning, and point to the canon found.
-
-        /*assert(canon != NULL);*/
-        goto new_interning; // break loop, make a new synonym
     }
 
-    // normal loop fallthrough at canon == NULL - make a new canon form
-    /*assert(canon == NULL)*/
-
-new_interning: ; // semicolon needed for statement
-
     // If possible, the allocation should be fit into a REBSER node with no
     // separate allocation.  Because automatically doing this is a new
     // feature, double check with an assert that the behavior matches.
@@ -308,23 +356,17 @@ new_interning: ; // semicolon needed for statement
 
     SET_SER_FLAGS(intern, SERIES_FLAG_UTF8_STRING | SERIES_FLAG_FIXED_SIZE);
 
+    // Created series must be managed, because if they were not there could
+    // be no clear contract on the return result--as it wouldn't be possible
+    // to know if a shared instance had been managed by someone else or not.
+    // (It's done before the interning is published, for the same reason.)
+    //
+    MANAGE_SERIES(intern);
+
     if (canon == NULL) {
         //
         // There was no canon symbol found, so this interning will be canon.
-        // Add it to the hash table and mark it, reuse deleted slot (if any)
         //
-        if (deleted_slot) {
-            *deleted_slot = intern; // slot "usage" count stays constant
-
-        #if !defined(NDEBUG)
-            --PG_Num_Canon_Deleteds;
-        #endif
-        }
-        else {
-            canons_by_hash[hash] = intern;
-            ++PG_Num_Canon_Slots_In_Use;
-        }
-
         SET_SER_FLAG(intern, STRING_FLAG_CANON);
 
         intern->link.synonym = intern; // circularly linked list, empty state
@@ -344,6 +386,10 @@ new_interning: ; // semicolon needed for statement
 
         // leave header.bits as 0 for SYM_0 as answer to VAL_WORD_SYM()
         // Init_Symbols() tags values from %words.r after the fact.
+
+        slot->tag = tag;
+        slot->canon = intern;
+        ++PG_Num_Canons;
     }
     else {
         // This is a synonym for an existing canon.  Link it into the synonyms
@@ -351,13 +397,14 @@ new_interning: ; // semicolon needed for statement
         //
         intern->misc.canon = canon;
         intern->link.synonym = canon->link.synonym;
-        canon->link.synonym = intern;
 
         // If the canon form had a SYM_XXX for quick comparison of %words.r
         // words in C switch statements, the synonym inherits that number.
         //
         assert(RIGHT_16_BITS(intern->header.bits) == 0);
         intern->header.bits |= FLAGUINT16_RIGHT(STR_SYMBOL(canon));
+
+        canon->link.synonym = intern;
     }
 
 #if !defined(NDEBUG)
@@ -366,15 +413,23 @@ new_interning: ; // semicolon needed for statement
     assert(sym == sym_canon);
 #endif
 
-    // Created series must be managed, because if they were not there could
-    // be no clear contract on the return result--as it wouldn't be possible
-    // to know if a shared instance had been managed by someone else or not.
-    //
-    MANAGE_SERIES(intern);
     return intern;
 }
 
 
+//
+//  Settle_Word_Table: C
+//
+// Called by the GC before it sweeps.  Finishes any growth that is in
+// progress, so GC_Kill_Interning() only has to deal with one table.
+//
+void Settle_Word_Table(void)
+{
+    if (PG_Canons_By_Hash_Old != NULL)
+        Migrate_Canons(SER_LEN(PG_Canons_By_Hash_Old));
+}
+
+
 //
 //  GC_Kill_Interning: C
 //
@@ -399,62 +454,65 @@ void GC_Kill_Interning(REBSTR *intern)
         return; // for non-canon forms, removing from chain is all you need
 
     assert(intern->misc.bind_index.high == 0); // shouldn't GC during binds?
-    assert(intern->misc.bind_index.low == 0);
 
-    REBCNT size = SER_LEN(PG_Canons_By_Hash);
-    REBSTR* *canons_by_hash = SER_HEAD(REBSER*, PG_Canons_By_Hash);
-    assert(canons_by_hash != NULL);
+    assert(PG_Canons_By_Hash_Old == NULL); // Settle_Word_Table() was called
+
+    struct Reb_Canon_Slot *slots = SER_HEAD(
+        struct Reb_Canon_Slot, PG_Canons_By_Hash
+    );
+    REBCNT mask = SER_LEN(PG_Canons_By_Hash) - 1;
 
     REBCNT len = STR_NUM_BYTES(intern);
     assert(len == LEN_BYTES(STR_HEAD(intern)));
 
-    REBCNT hash = Hash_Word(STR_HEAD(intern), len);
-    REBCNT skip = (hash & 0x0000FFFF) % size;
-    if (skip == 0) skip = 1;
-    hash = (hash & 0x00FFFF00) % size;
+    REBCNT tag = Hash_Spelling(STR_HEAD(intern), len);
 
-    // We *will* find the canon form in the hash table.
+    // We *will* find the canon form in the table.
     //
-    while (canons_by_hash[hash] != intern) {
-        hash += skip;
-        if (hash >= size) hash -= size;
-    }
+    REBCNT n = tag & mask;
+    while (slots[n].canon != intern)
+        n = (n + 1) & mask;
 
     if (synonym != intern) {
         //
         // If there was a synonym in the circularly linked list distinct from
         // the canon form, then it gets a promotion to being the canon form.
-        // It should hash the same, and be able to take over the hash slot.
+        // It hashes the same, and can take over the slot.  A key in the bind
+        // cache's context may use the synonym, so it inherits the cached
+        // index (see %sys-bind.h)
         //
-        /*assert(hash == Hash_Word(STR_HEAD(synonym)));*/
-        canons_by_hash[hash] = synonym;
+        assert(
+            slots[n].tag
+            == Hash_Spelling(STR_HEAD(synonym), STR_NUM_BYTES(synonym))
+        );
+        slots[n].canon = synonym;
         SET_SER_FLAG(synonym, STRING_FLAG_CANON);
-        synonym->misc.bind_index.low = 0;
+        REBINT cached = intern->misc.bind_index.low;
+        synonym->misc.bind_index.low = cached;
         synonym->misc.bind_index.high = 0;
+        return;
     }
-    else {
-        // This canon form must be removed from the hash table.  Ripple the
-        // collision slots back until a NULL is found, to reduce search times.
-        //
-        REBCNT previous_hash = hash;
-        while (canons_by_hash[hash] != NULL) {
-            hash += skip;
-            if (hash >= size) hash -= size;
-            canons_by_hash[previous_hash] = canons_by_hash[hash];
-        }
 
-        // Signal that the hash slot is "deleted" via a special pointer.
-        // See notes on DELETED_SLOT for why the final slot in the collision
-        // chain can't just be left NULL:
-        //
-        // http://stackoverflow.com/a/279812/211160
-        //
-        canons_by_hash[previous_hash] = DELETED_CANON;
+    // No key can be using this spelling (it would have been marked)
+    //
+    assert(intern->misc.bind_index.low == 0);
 
-    #if !defined(NDEBUG)
-        ++PG_Num_Canon_Deleteds; // total use same (PG_Num_Canons_Or_Deleteds)
-    #endif
+    // This canon form must be removed from the table.  With linear probing,
+    // later slots in the same run are shifted back into the hole if they
+    // would otherwise not be reachable from their home slot--so no special
+    // "deleted" marker is needed.
+    //
+    REBCNT hole = n;
+    for (n = (n + 1) & mask; slots[n].canon != NULL; n = (n + 1) & mask) {
+        REBCNT home = slots[n].tag & mask;
+        if (((n - home) & mask) >= ((n - hole) & mask)) {
+            slots[hole] = slots[n];
+            hole = n;
+        }
     }
+    slots[hole].canon = NULL;
+
+    --PG_Num_Canons;
 }
 
 
@@ -565,30 +623,37 @@ void Init_Symbols(REBARR *words)
 //
 void Init_Words(void)
 {
-    PG_Num_Canon_Slots_In_Use = 0;
-#if !defined(NDEBUG)
-    PG_Num_Canon_Deleteds = 0;
-#endif
+    PG_Num_Canons = 0;
 
-    // Start hash table out at a fixed size.  When collisions occur, it
-    // causes a skipping pattern that continues until it finds the desired
-    // slot.  The method is known as linear probing:
-    //
-    // https://en.wikipedia.org/wiki/Linear_probing
-    //
-    // It must always be at least as big as the total number of words, in order
-    // for it to uniquely be able to locate each symbol pointer.  But to
-    // reduce long probing chains, it should be significantly larger than that.
+    // The table must always have free slots, for searches to terminate, and
+    // to keep probe runs short it is grown when it becomes half full.
     // R3-Alpha used a heuristic of 4 times as big as the number of words.
-
+    //
     REBCNT n;
 #if defined(NDEBUG)
-    n = Get_Hash_Prime(WORD_TABLE_SIZE * 4); // extra reduces rehashing
+    n = WORD_TABLE_SIZE * 4; // extra reduces growing (power of 2)
 #else
-    n = 1; // forces exercise of rehashing logic in debug build
+    n = 2; // forces exercise of growing logic in debug build
 #endif
 
-    PG_Canons_By_Hash = Make_Series(n, sizeof(REBSTR*), MKS_POWER_OF_2);
+    PG_Canons_By_Hash = Make_Series(
+        n, sizeof(struct Reb_Canon_Slot), MKS_NONE
+    );
     Clear_Series(PG_Canons_By_Hash); // all slots start at NULL
     SET_SERIES_LEN(PG_Canons_By_Hash, n);
+
+    PG_Canons_By_Hash_Old = NULL;
+    PG_Canons_Migrated = 0;
+}
+
+
+//
+//  Shutdown_Words: C
+//
+void Shutdown_Words(void)
+{
+    Settle_Word_Table();
+    assert(PG_Num_Canons == 0);
+
+    Free_Series(PG_Canons_By_Hash);
 }
@@ -0,0 +1,531 @@
+//
+//  File: %d-alloc.c
+//  Summary: "Series allocation profiler"
+//  Section: debug
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2017 Rebol Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// `profile/series on` makes Make_Series() note which code each new series
+// came from: the function running in the topmost frame, and where in its
+// caller's array that call is (so `copy` in two places are two "sites").
+// Each site counts the series made there and their bytes, then how many of
+// those bytes were freed by the code that made them, collected by the GC,
+// or are still live.  It also adds up how many times its series survived a
+// recycle, which is what tells a leak (series that keep surviving) from
+// churn (lots made and collected):
+//
+//     profile/series on
+//     loop 1000 [handle-request]
+//     recycle
+//     sites: profile/series _ ;-- results, while still profiling
+//
+// Results are 8 values per site, most bytes first:
+//
+//     name near made bytes freed collected live survivals
+//
+// NAME is BLANK! if no function was running, and NEAR is a STRING! of the
+// code at the site (BLANK! if C code was running a variadic feed or an
+// array that isn't GC managed).
+//
+// Sizes are those given when the series is made.  !!! Growth of a series
+// after it is made is not counted, which under-reports the cost of sites
+// whose series are appended to a lot.
+//
+// Like the function profiler (see %d-profile.c) the tables are C memory.
+// The arrays and names of the sites are kept alive by ROOT_PROFILE_SITES,
+// so that one can't be freed and its memory reused by another site.
+//
+
+#include "sys-core.h"
+
+
+struct Reb_Alloc_Site {
+    REBSTR *label; // NULL if no function frame
+    REBARR *array; // NULL if not a managed array
+    REBCNT index;
+
+    REBU64 made;
+    REBU64 bytes;
+    REBU64 freed; // bytes freed by Free_Series()
+    REBU64 collected; // bytes freed by the GC
+    REBU64 survivals; // times a series from here survived a recycle
+    REBCNT live; // series from here not yet freed
+};
+
+struct Reb_Alloc_Record {
+    REBSER *series; // NULL if empty slot
+    REBCNT site;
+    REBU64 bytes; // SER_TOTAL() may pass 4GB with REB_LARGE_SERIES
+};
+
+static THREAD_LOCAL struct {
+    struct Reb_Alloc_Site *sites;
+    REBCNT num_sites;
+    REBCNT max_sites;
+
+    REBCNT *site_hash; // open addressing of site index + 1 (0 is empty)
+    REBCNT site_hash_size;
+
+    // Live series, by open addressing (with deletion by moving back the
+    // entries after a removed one, so there are no tombstones)
+    //
+    struct Reb_Alloc_Record *records;
+    REBCNT num_records;
+    REBCNT records_size;
+} Alloc_Profile;
+
+
+//
+//  Hash_Site: C
+//
+static REBCNT Hash_Site(REBSTR *label, REBARR *array, REBCNT index)
+{
+    return cast(REBCNT,
+        (cast(REBUPT, label) >> 4) * 2654435761u
+        ^ (cast(REBUPT, array) >> 4) * 40503u
+        ^ index
+    );
+}
+
+
+//
+//  Hash_Series: C
+//
+static REBCNT Hash_Series(REBSER *s)
+{
+    return cast(REBCNT, (cast(REBUPT, s) >> 4) * 2654435761u);
+}
+
+
+//
+//  Rehash_Sites: C
+//
+static void Rehash_Sites(void)
+{
+    if (Alloc_Profile.site_hash != NULL)
+        FREE_N(REBCNT, Alloc_Profile.site_hash_size, Alloc_Profile.site_hash);
+
+    REBCNT size = 256;
+    while (size < Alloc_Profile.num_sites * 2)
+        size *= 2;
+
+    Alloc_Profile.site_hash = ALLOC_N_ZEROFILL(REBCNT, size);
+    Alloc_Profile.site_hash_size = size;
+
+    REBCNT i;
+    for (i = 0; i < Alloc_Profile.num_sites; ++i) {
+        struct Reb_Alloc_Site *site = &Alloc_Profile.sites[i];
+        REBCNT slot = Hash_Site(site->label, site->array, site->index)
+            & (size - 1);
+        while (Alloc_Profile.site_hash[slot] != 0)
+            slot = (slot + 1) & (size - 1);
+        Alloc_Profile.site_hash[slot] = i + 1;
+    }
+}
+
+
+//
+//  Rehash_Records: C
+//
+static void Rehash_Records(REBCNT size)
+{
+    struct Reb_Alloc_Record *old = Alloc_Profile.records;
+    REBCNT old_size = Alloc_Profile.records_size;
+
+    Alloc_Profile.records = ALLOC_N_ZEROFILL(struct Reb_Alloc_Record, size);
+    Alloc_Profile.records_size = size;
+
+    REBCNT i;
+    for (i = 0; i < old_size; ++i) {
+        if (old[i].series == NULL)
+            continue;
+
+        REBCNT slot = Hash_Series(old[i].series) & (size - 1);
+        while (Alloc_Profile.records[slot].series != NULL)
+            slot = (slot + 1) & (size - 1);
+        Alloc_Profile.records[slot] = old[i];
+    }
+
+    if (old != NULL)
+        FREE_N(struct Reb_Alloc_Record, old_size, old);
+}
+
+
+//
+//  Find_Or_Add_Site: C
+//
+static REBCNT Find_Or_Add_Site(REBSTR *label, REBARR *array, REBCNT index)
+{
+    REBCNT mask = Alloc_Profile.site_hash_size - 1;
+    REBCNT slot = Hash_Site(label, array, index) & mask;
+    for (; Alloc_Profile.site_hash[slot] != 0; slot = (slot + 1) & mask) {
+        struct Reb_Alloc_Site *site
+            = &Alloc_Profile.sites[Alloc_Profile.site_hash[slot] - 1];
+        if (
+            site->label == label
+            && site->array == array
+            && site->index == index
+        ){
+            return Alloc_Profile.site_hash[slot] - 1;
+        }
+    }
+
+    // Keep the name and array from being GC'd while the site is known.
+    // (Appending only expands the array, so it doesn't call Make_Series().)
+    //
+    REBARR *keep = VAL_ARRAY(ROOT_PROFILE_SITES);
+    if (label != NULL)
+        Init_Word(Alloc_Tail_Array(keep), label);
+    else
+        SET_BLANK(Alloc_Tail_Array(keep));
+    if (array != NULL)
+        Init_Block(Alloc_Tail_Array(keep), array);
+    else
+        SET_BLANK(Alloc_Tail_Array(keep));
+
+    if (Alloc_Profile.num_sites == Alloc_Profile.max_sites) {
+        REBCNT new_max = Alloc_Profile.max_sites == 0
+            ? 64
+            : Alloc_Profile.max_sites * 2;
+        struct Reb_Alloc_Site *sites
+            = ALLOC_N(struct Reb_Alloc_Site, new_max);
+        if (Alloc_Profile.sites != NULL) {
+            memcpy(
+                sites,
+                Alloc_Profile.sites,
+                Alloc_Profile.num_sites * sizeof(struct Reb_Alloc_Site)
+            );
+            FREE_N(
+                struct Reb_Alloc_Site,
+                Alloc_Profile.max_sites,
+                Alloc_Profile.sites
+            );
+        }
+        Alloc_Profile.sites = sites;
+        Alloc_Profile.max_sites = new_max;
+    }
+
+    REBCNT n = Alloc_Profile.num_sites++;
+    struct Reb_Alloc_Site *site = &Alloc_Profile.sites[n];
+    CLEAR(site, sizeof(struct Reb_Alloc_Site));
+    site->label = label;
+    site->array = array;
+    site->index = index;
+
+    if (Alloc_Profile.num_sites * 2 > Alloc_Profile.site_hash_size)
+        Rehash_Sites();
+    else
+        Alloc_Profile.site_hash[slot] = n + 1;
+
+    return n;
+}
+
+
+//
+//  Series_Profile_Made: C
+//
+// Called by Make_Series() while series are profiled.
+//
+void Series_Profile_Made(REBSER *s)
+{
+    assert(PG_Series_Profiling);
+
+    REBSTR *label = NULL;
+    REBARR *array = NULL;
+    REBCNT index = 0;
+
+    REBFRM *f = FS_TOP;
+    if (f != NULL) {
+        if (Is_Any_Function_Frame(f))
+            label = FRM_LABEL(f);
+        // Arrays C code is running before handing them to the GC can't be
+        // kept alive (and might be freed), so only the name says where.
+        //
+        if (NOT(FRM_IS_VALIST(f)) && IS_ARRAY_MANAGED(FRM_ARRAY(f))) {
+            array = FRM_ARRAY(f);
+            index = FRM_EXPR_INDEX(f);
+        }
+    }
+
+    REBCNT site = Find_Or_Add_Site(label, array, index);
+
+    REBU64 bytes = sizeof(REBSER);
+    if (GET_SER_INFO(s, SERIES_INFO_HAS_DYNAMIC))
+        bytes += SER_TOTAL(s);
+
+    ++Alloc_Profile.sites[site].made;
+    Alloc_Profile.sites[site].bytes += bytes;
+    ++Alloc_Profile.sites[site].live;
+
+    if ((Alloc_Profile.num_records + 1) * 2 > Alloc_Profile.records_size)
+        Rehash_Records(Alloc_Profile.records_size * 2);
+
+    REBCNT mask = Alloc_Profile.records_size - 1;
+    REBCNT slot = Hash_Series(s) & mask;
+    while (Alloc_Profile.records[slot].series != NULL)
+        slot = (slot + 1) & mask;
+
+    Alloc_Profile.records[slot].series = s;
+    Alloc_Profile.records[slot].site = site;
+    Alloc_Profile.records[slot].bytes = bytes;
+    ++Alloc_Profile.num_records;
+}
+
+
+//
+//  Series_Profile_Killed: C
+//
+// Called by GC_Kill_Series() while series are profiled.  Series made before
+// profiling started are not known, and ignored.
+//
+void Series_Profile_Killed(REBSER *s)
+{
+    assert(PG_Series_Profiling);
+
+    REBCNT mask = Alloc_Profile.records_size - 1;
+    REBCNT slot = Hash_Series(s) & mask;
+    while (Alloc_Profile.records[slot].series != s) {
+        if (Alloc_Profile.records[slot].series == NULL)
+            return;
+        slot = (slot + 1) & mask;
+    }
+
+    struct Reb_Alloc_Record *record = &Alloc_Profile.records[slot];
+    struct Reb_Alloc_Site *site = &Alloc_Profile.sites[record->site];
+
+    if (GC_Recycling)
+        site->collected += record->bytes;
+    else
+        site->freed += record->bytes;
+    --site->live;
+
+    // Remove the record, moving back any following entries that would
+    // otherwise no longer be found from their hash position.
+    //
+    REBCNT hole = slot;
+    slot = (slot + 1) & mask;
+    while (Alloc_Profile.records[slot].series != NULL) {
+        REBCNT home = Hash_Series(Alloc_Profile.records[slot].series) & mask;
+        if (((slot - home) & mask) >= ((slot - hole) & mask)) {
+            Alloc_Profile.records[hole] = Alloc_Profile.records[slot];
+            hole = slot;
+        }
+        slot = (slot + 1) & mask;
+    }
+    Alloc_Profile.records[hole].series = NULL;
+    --Alloc_Profile.num_records;
+}
+
+
+//
+//  Series_Profile_Recycled: C
+//
+// Called at the end of Recycle_Core(), when the series still known have
+// survived it.
+//
+void Series_Profile_Recycled(void)
+{
+    assert(PG_Series_Profiling);
+
+    REBCNT n;
+    for (n = 0; n < Alloc_Profile.num_sites; ++n)
+        Alloc_Profile.sites[n].survivals += Alloc_Profile.sites[n].live;
+}
+
+
+//
+//  Free_Series_Profile_Tables: C
+//
+static void Free_Series_Profile_Tables(void)
+{
+    if (Alloc_Profile.sites != NULL)
+        FREE_N(
+            struct Reb_Alloc_Site,
+            Alloc_Profile.max_sites,
+            Alloc_Profile.sites
+        );
+    if (Alloc_Profile.site_hash != NULL)
+        FREE_N(REBCNT, Alloc_Profile.site_hash_size, Alloc_Profile.site_hash);
+    if (Alloc_Profile.records != NULL)
+        FREE_N(
+            struct Reb_Alloc_Record,
+            Alloc_Profile.records_size,
+            Alloc_Profile.records
+        );
+
+    CLEAR(&Alloc_Profile, sizeof(Alloc_Profile));
+}
+
+
+//
+//  Start_Series_Profile: C
+//
+void Start_Series_Profile(void)
+{
+    PG_Series_Profiling = FALSE;
+    Free_Series_Profile_Tables();
+
+    if (IS_BLANK(ROOT_PROFILE_SITES))
+        Set_Root_Series(ROOT_PROFILE_SITES, AS_SERIES(Make_Array(128)));
+    else
+        RESET_ARRAY(VAL_ARRAY(ROOT_PROFILE_SITES));
+
+    Rehash_Sites();
+    Rehash_Records(1024);
+
+    PG_Series_Profiling = TRUE;
+}
+
+
+//
+//  Stop_Series_Profile: C
+//
+// The sites are kept for the results, but not the series still live.
+//
+void Stop_Series_Profile(void)
+{
+    if (!PG_Series_Profiling)
+        return;
+
+    PG_Series_Profiling = FALSE;
+
+    FREE_N(
+        struct Reb_Alloc_Record,
+        Alloc_Profile.records_size,
+        Alloc_Profile.records
+    );
+    Alloc_Profile.records = NULL;
+    Alloc_Profile.records_size = 0;
+    Alloc_Profile.num_records = 0;
+}
+
+
+//
+//  Compare_Site_Bytes: C
+//
+static int Compare_Site_Bytes(void *thunk, const void *v1, const void *v2)
+{
+    UNUSED(thunk);
+    const struct Reb_Alloc_Site *s1
+        = &Alloc_Profile.sites[*cast(const REBCNT*, v1)];
+    const struct Reb_Alloc_Site *s2
+        = &Alloc_Profile.sites[*cast(const REBCNT*, v2)];
+
+    if (s1->bytes != s2->bytes)
+        return s1->bytes > s2->bytes ? -1 : 1;
+    return 0;
+}
+
+
+//
+//  Mold_Site_Near: C
+//
+// The first few values of the expression at the site.
+//
+static REBSER *Mold_Site_Near(struct Reb_Alloc_Site *site)
+{
+    REB_MOLD mo;
+    CLEARS(&mo);
+    Push_Mold(&mo);
+
+    RELVAL *item = ARR_AT(site->array, site->index);
+    REBCNT count = 0;
+    for (; NOT_END(item) && count < 4; ++item, ++count) {
+        if (count != 0)
+            Append_Codepoint_Raw(mo.series, ' ');
+        Mold_Value(&mo, item, TRUE);
+    }
+    if (NOT_END(item))
+        Append_Unencoded(mo.series, " ...");
+
+    return Pop_Molded_String(&mo);
+}
+
+
+//
+//  Series_Profile_Results: C
+//
+// See notes at top of file for the format.
+//
+REBARR *Series_Profile_Results(void)
+{
+    // Making the results makes series, which shouldn't add sites while
+    // they are being listed.
+    //
+    REBOOL was_profiling = PG_Series_Profiling;
+    PG_Series_Profiling = FALSE;
+
+    REBCNT num = Alloc_Profile.num_sites;
+    REBARR *results = Make_Array(num * 8 + 1);
+    if (num == 0) {
+        PG_Series_Profiling = was_profiling;
+        return results;
+    }
+
+    REBCNT *order = ALLOC_N(REBCNT, num);
+    REBCNT i;
+    for (i = 0; i < num; ++i)
+        order[i] = i;
+
+    reb_qsort_r(order, num, sizeof(REBCNT), NULL, &Compare_Site_Bytes);
+
+    for (i = 0; i < num; ++i) {
+        struct Reb_Alloc_Site *site = &Alloc_Profile.sites[order[i]];
+
+        if (site->label != NULL)
+            Init_Word(Alloc_Tail_Array(results), site->label);
+        else
+            SET_BLANK(Alloc_Tail_Array(results));
+
+        if (site->array != NULL && site->index < ARR_LEN(site->array))
+            Init_String(Alloc_Tail_Array(results), Mold_Site_Near(site));
+        else
+            SET_BLANK(Alloc_Tail_Array(results));
+
+        SET_INTEGER(Alloc_Tail_Array(results), site->made);
+        SET_INTEGER(Alloc_Tail_Array(results), site->bytes);
+        SET_INTEGER(Alloc_Tail_Array(results), site->freed);
+        SET_INTEGER(Alloc_Tail_Array(results), site->collected);
+        SET_INTEGER(
+            Alloc_Tail_Array(results),
+            site->bytes - site->freed - site->collected
+        );
+        SET_INTEGER(Alloc_Tail_Array(results), site->survivals);
+    }
+
+    FREE_N(REBCNT, num, order);
+
+    PG_Series_Profiling = was_profiling;
+    return results;
+}
+
+
+//
+//  Shutdown_Series_Profile: C
+//
+void Shutdown_Series_Profile(void)
+{
+    PG_Series_Profiling = FALSE;
+    Free_Series_Profile_Tables();
+}
@@ -40,7 +40,7 @@
 
 #include "sys-core.h"
 
-static REBREQ *Req_SIO;
+static THREAD_LOCAL REBREQ *Req_SIO;
 
 
 /***********************************************************************
@@ -239,8 +239,8 @@ void Enable_Backtrace(REBOOL on)
 //
 void Display_Backtrace(REBCNT lines)
 {
-    REBCNT tail;
-    REBCNT i;
+    REBLEN tail;
+    REBLEN i;
 
     if (Trace_Limit > 0) {
         tail = SER_LEN(Trace_Buffer);
@@ -0,0 +1,583 @@
+//
+//  File: %d-profile.c
+//  Summary: "Function call profiler"
+//  Section: debug
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2017 Rebol Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// PROFILE measures every FUNCTION! (natives included) that Do_Core runs
+// while it is on:
+//
+//     profile on
+//     do %script.reb
+//     results: profile off ;-- [name calls total self series ...]
+//     write %script.folded profile/folded off
+//
+// (PROFILE/SERIES instead measures where series are made, see %d-alloc.c)
+//
+// For each function it counts calls, microseconds spent in the calls
+// ("total", with recursive calls counted once), microseconds not spent in
+// calls to other functions ("self") and series made outside of calls to
+// other functions.  It also keeps the self time of each distinct chain of
+// calls, which /FOLDED gives in the "folded stacks" format that flame graph
+// tools read (`outer;inner;leaf 123` per line).
+//
+// Calls are seen when Do_Core dispatches a function, and end when its frame
+// is dropped (which also happens to frames unwound by a FAIL or THROW).  The
+// only cost while profiling is off is the test of PG_Profiling on those two
+// paths.  Operations done inline by the evaluator without calling their
+// function (see Try_Fused_Arithmetic()) count as time of the caller.
+//
+// A function is known by the name it was first called with.
+//
+
+#include "sys-core.h"
+
+
+// One per function called while profiling.
+//
+struct Reb_Profile_Func {
+    REBFUN *func;
+    REBU64 calls;
+    REBI64 total; // microseconds from outermost call to return
+    REBI64 self; // microseconds not in calls to other functions
+    REBU64 series; // series made, not in calls to other functions
+    REBCNT active; // calls of it on the stack (for recursion)
+};
+
+// One per distinct chain of calls, for the folded stacks.
+//
+#define NO_PARENT ((REBCNT)-1)
+
+struct Reb_Profile_Node {
+    REBCNT parent; // node of the caller, or NO_PARENT
+    REBCNT func; // index in Profile.funcs
+    REBI64 self;
+};
+
+// One per call in progress.
+//
+struct Reb_Profile_Call {
+    REBFRM *frame;
+    REBCNT node;
+    REBI64 start;
+    REBI64 child_time;
+    REBU64 series_start;
+    REBU64 child_series;
+};
+
+// The tables are C memory, so they don't disturb the series being measured
+// (or the balance checks on manually managed series).  The functions and
+// their names are kept alive by ROOT_PROFILE_FUNCTIONS.
+//
+static THREAD_LOCAL struct {
+    struct Reb_Profile_Func *funcs;
+    REBCNT num_funcs;
+    REBCNT max_funcs;
+
+    struct Reb_Profile_Node *nodes;
+    REBCNT num_nodes;
+    REBCNT max_nodes;
+
+    struct Reb_Profile_Call *calls;
+    REBCNT num_calls;
+    REBCNT max_calls;
+
+    // Open addressing hashes of indices + 1 (0 is empty), power of 2 sizes
+    //
+    REBCNT *func_hash;
+    REBCNT func_hash_size;
+    REBCNT *node_hash;
+    REBCNT node_hash_size;
+} Profile;
+
+
+//
+//  Grow_Table: C
+//
+// Double the capacity of one of the tables, returning the new memory.
+//
+static void *Grow_Table(void *old, REBCNT *max, REBCNT num, size_t wide)
+{
+    REBCNT new_max = *max == 0 ? 64 : *max * 2;
+    void *mem = Alloc_Mem(new_max * wide);
+    if (mem == NULL)
+        fail (Error_No_Memory(new_max * wide));
+
+    if (old != NULL) {
+        memcpy(mem, old, num * wide);
+        Free_Mem(old, *max * wide);
+    }
+    *max = new_max;
+    return mem;
+}
+
+
+//
+//  Hash_Func: C
+//
+static REBCNT Hash_Func(REBFUN *func)
+{
+    return cast(REBCNT, (cast(REBUPT, func) >> 4) * 2654435761u);
+}
+
+
+//
+//  Hash_Node: C
+//
+static REBCNT Hash_Node(REBCNT parent, REBCNT func)
+{
+    return (parent * 2654435761u) ^ (func * 40503u + 1);
+}
+
+
+//
+//  Rehash: C
+//
+// Make the hashes have room for twice the entries in their tables.
+//
+static void Rehash(REBCNT **hash, REBCNT *size, REBCNT num, REBOOL funcs)
+{
+    if (*hash != NULL)
+        FREE_N(REBCNT, *size, *hash);
+
+    *size = 128;
+    while (*size < num * 2)
+        *size *= 2;
+
+    *hash = ALLOC_N_ZEROFILL(REBCNT, *size);
+
+    REBCNT i;
+    for (i = 0; i < num; ++i) {
+        REBCNT h = funcs
+            ? Hash_Func(Profile.funcs[i].func)
+            : Hash_Node(Profile.nodes[i].parent, Profile.nodes[i].func);
+
+        REBCNT slot = h & (*size - 1);
+        while ((*hash)[slot] != 0)
+            slot = (slot + 1) & (*size - 1);
+        (*hash)[slot] = i + 1;
+    }
+}
+
+
+//
+//  Find_Or_Add_Func: C
+//
+static REBCNT Find_Or_Add_Func(REBFRM *f)
+{
+    REBCNT mask = Profile.func_hash_size - 1;
+    REBCNT slot = Hash_Func(f->func) & mask;
+    for (; Profile.func_hash[slot] != 0; slot = (slot + 1) & mask) {
+        REBCNT i = Profile.func_hash[slot] - 1;
+        if (Profile.funcs[i].func == f->func)
+            return i;
+    }
+
+    // First call of this function.  Keep it and its name from being GC'd
+    // (and the memory reused by another function) while the results exist.
+    //
+    REBARR *keep = VAL_ARRAY(ROOT_PROFILE_FUNCTIONS);
+    Append_Value(keep, FUNC_VALUE(f->func));
+    Init_Word(Alloc_Tail_Array(keep), FRM_LABEL(f));
+
+    if (Profile.num_funcs == Profile.max_funcs)
+        Profile.funcs = cast(struct Reb_Profile_Func*, Grow_Table(
+            Profile.funcs,
+            &Profile.max_funcs,
+            Profile.num_funcs,
+            sizeof(struct Reb_Profile_Func)
+        ));
+
+    REBCNT n = Profile.num_funcs++;
+    struct Reb_Profile_Func *pf = &Profile.funcs[n];
+    pf->func = f->func;
+    pf->calls = 0;
+    pf->total = 0;
+    pf->self = 0;
+    pf->series = 0;
+    pf->active = 0;
+
+    if (Profile.num_funcs * 2 > Profile.func_hash_size)
+        Rehash(
+            &Profile.func_hash,
+            &Profile.func_hash_size,
+            Profile.num_funcs,
+            TRUE
+        );
+    else
+        Profile.func_hash[slot] = n + 1;
+
+    return n;
+}
+
+
+//
+//  Find_Or_Add_Node: C
+//
+static REBCNT Find_Or_Add_Node(REBCNT parent, REBCNT func)
+{
+    REBCNT mask = Profile.node_hash_size - 1;
+    REBCNT slot = Hash_Node(parent, func) & mask;
+    for (; Profile.node_hash[slot] != 0; slot = (slot + 1) & mask) {
+        REBCNT i = Profile.node_hash[slot] - 1;
+        if (Profile.nodes[i].parent == parent && Profile.nodes[i].func == func)
+            return i;
+    }
+
+    if (Profile.num_nodes == Profile.max_nodes)
+        Profile.nodes = cast(struct Reb_Profile_Node*, Grow_Table(
+            Profile.nodes,
+            &Profile.max_nodes,
+            Profile.num_nodes,
+            sizeof(struct Reb_Profile_Node)
+        ));
+
+    REBCNT n = Profile.num_nodes++;
+    Profile.nodes[n].parent = parent;
+    Profile.nodes[n].func = func;
+    Profile.nodes[n].self = 0;
+
+    if (Profile.num_nodes * 2 > Profile.node_hash_size)
+        Rehash(
+            &Profile.node_hash,
+            &Profile.node_hash_size,
+            Profile.num_nodes,
+            FALSE
+        );
+    else
+        Profile.node_hash[slot] = n + 1;
+
+    return n;
+}
+
+
+//
+//  Profile_Enter: C
+//
+// Called by Do_Core when it is about to run the dispatcher of a frame.
+//
+void Profile_Enter(REBFRM *f)
+{
+    assert(PG_Profiling);
+
+    // A dispatcher may ask for the function to be run again (see
+    // R_REDO_UNCHECKED), which is still the same call.
+    //
+    if (
+        Profile.num_calls != 0
+        && Profile.calls[Profile.num_calls - 1].frame == f
+    ){
+        return;
+    }
+
+    REBCNT func = Find_Or_Add_Func(f);
+    REBCNT parent = Profile.num_calls == 0
+        ? NO_PARENT
+        : Profile.calls[Profile.num_calls - 1].node;
+    REBCNT node = Find_Or_Add_Node(parent, func);
+
+    if (Profile.num_calls == Profile.max_calls)
+        Profile.calls = cast(struct Reb_Profile_Call*, Grow_Table(
+            Profile.calls,
+            &Profile.max_calls,
+            Profile.num_calls,
+            sizeof(struct Reb_Profile_Call)
+        ));
+
+    ++Profile.funcs[func].calls;
+    ++Profile.funcs[func].active;
+
+    struct Reb_Profile_Call *call = &Profile.calls[Profile.num_calls++];
+    call->frame = f;
+    call->node = node;
+    call->child_time = 0;
+    call->child_series = 0;
+    call->series_start = PG_Series_Made;
+    call->start = OS_DELTA_TIME(0, 0); // last, so less of this is counted
+}
+
+
+//
+//  Profile_Exit: C
+//
+// Called when the arguments of a function frame are dropped.  That happens
+// also to frames which never got as far as Profile_Enter(), e.g. because
+// gathering an argument failed, so only the most recent call is matched.
+//
+// This runs while a FAIL is unwinding the stack, so it must not fail.
+//
+void Profile_Exit(REBFRM *f)
+{
+    REBI64 now = OS_DELTA_TIME(0, 0);
+
+    if (
+        Profile.num_calls == 0
+        || Profile.calls[Profile.num_calls - 1].frame != f
+    ){
+        return;
+    }
+
+    struct Reb_Profile_Call *call = &Profile.calls[--Profile.num_calls];
+    struct Reb_Profile_Node *node = &Profile.nodes[call->node];
+    struct Reb_Profile_Func *pf = &Profile.funcs[node->func];
+
+    REBI64 elapsed = now - call->start;
+    REBU64 series = PG_Series_Made - call->series_start;
+
+    node->self += elapsed - call->child_time;
+    pf->self += elapsed - call->child_time;
+    pf->series += series - call->child_series;
+
+    if (--pf->active == 0)
+        pf->total += elapsed;
+
+    if (Profile.num_calls != 0) {
+        struct Reb_Profile_Call *caller
+            = &Profile.calls[Profile.num_calls - 1];
+        caller->child_time += elapsed;
+        caller->child_series += series;
+    }
+}
+
+
+//
+//  Free_Profile_Tables: C
+//
+static void Free_Profile_Tables(void)
+{
+    if (Profile.funcs != NULL)
+        FREE_N(struct Reb_Profile_Func, Profile.max_funcs, Profile.funcs);
+    if (Profile.nodes != NULL)
+        FREE_N(struct Reb_Profile_Node, Profile.max_nodes, Profile.nodes);
+    if (Profile.calls != NULL)
+        FREE_N(struct Reb_Profile_Call, Profile.max_calls, Profile.calls);
+    if (Profile.func_hash != NULL)
+        FREE_N(REBCNT, Profile.func_hash_size, Profile.func_hash);
+    if (Profile.node_hash != NULL)
+        FREE_N(REBCNT, Profile.node_hash_size, Profile.node_hash);
+
+    CLEAR(&Profile, sizeof(Profile));
+}
+
+
+//
+//  Start_Profile: C
+//
+static void Start_Profile(void)
+{
+    Free_Profile_Tables();
+
+    Rehash(&Profile.func_hash, &Profile.func_hash_size, 0, TRUE);
+    Rehash(&Profile.node_hash, &Profile.node_hash_size, 0, FALSE);
+
+    if (IS_BLANK(ROOT_PROFILE_FUNCTIONS))
+        Set_Root_Series(ROOT_PROFILE_FUNCTIONS, AS_SERIES(Make_Array(64)));
+    else
+        RESET_ARRAY(VAL_ARRAY(ROOT_PROFILE_FUNCTIONS));
+
+    PG_Profiling = TRUE;
+}
+
+
+//
+//  Profile_Label: C
+//
+// The name a function was first called with (see Find_Or_Add_Func())
+//
+static REBSTR *Profile_Label(REBCNT func)
+{
+    return VAL_WORD_SPELLING(
+        ARR_AT(VAL_ARRAY(ROOT_PROFILE_FUNCTIONS), func * 2 + 1)
+    );
+}
+
+
+//
+//  Compare_Self_Time: C
+//
+static int Compare_Self_Time(void *thunk, const void *v1, const void *v2)
+{
+    UNUSED(thunk);
+    const struct Reb_Profile_Func *f1
+        = &Profile.funcs[*cast(const REBCNT*, v1)];
+    const struct Reb_Profile_Func *f2
+        = &Profile.funcs[*cast(const REBCNT*, v2)];
+
+    if (f1->self != f2->self)
+        return f1->self > f2->self ? -1 : 1;
+    if (f1->calls != f2->calls)
+        return f1->calls > f2->calls ? -1 : 1;
+    return 0;
+}
+
+
+//
+//  Profile_Results: C
+//
+// Block of `name calls total self series` for each function, with the most
+// self time first.
+//
+static REBARR *Profile_Results(void)
+{
+    REBARR *results = Make_Array(Profile.num_funcs * 5);
+    if (Profile.num_funcs == 0)
+        return results;
+
+    REBCNT *order = ALLOC_N(REBCNT, Profile.num_funcs);
+    REBCNT i;
+    for (i = 0; i < Profile.num_funcs; ++i)
+        order[i] = i;
+
+    reb_qsort_r(
+        order, Profile.num_funcs, sizeof(REBCNT), NULL, &Compare_Self_Time
+    );
+
+    for (i = 0; i < Profile.num_funcs; ++i) {
+        struct Reb_Profile_Func *pf = &Profile.funcs[order[i]];
+        Init_Word(Alloc_Tail_Array(results), Profile_Label(order[i]));
+        SET_INTEGER(Alloc_Tail_Array(results), pf->calls);
+        SET_INTEGER(Alloc_Tail_Array(results), pf->total);
+        SET_INTEGER(Alloc_Tail_Array(results), pf->self);
+        SET_INTEGER(Alloc_Tail_Array(results), pf->series);
+    }
+
+    FREE_N(REBCNT, Profile.num_funcs, order);
+    return results;
+}
+
+
+//
+//  Mold_Profile_Stack: C
+//
+static void Mold_Profile_Stack(REB_MOLD *mo, REBCNT node)
+{
+    REBCNT parent = Profile.nodes[node].parent;
+    if (parent != NO_PARENT) {
+        Mold_Profile_Stack(mo, parent);
+        Append_Codepoint_Raw(mo->series, ';');
+    }
+
+    REBSTR *label = Profile_Label(Profile.nodes[node].func);
+    Append_UTF8_May_Fail(mo->series, STR_HEAD(label), STR_NUM_BYTES(label));
+}
+
+
+//
+//  Profile_Folded: C
+//
+// One line per chain of calls which had self time: the names from the
+// outermost call in, separated by semicolons, then the microseconds.
+//
+static REBSER *Profile_Folded(void)
+{
+    REB_MOLD mo;
+    CLEARS(&mo);
+    Push_Mold(&mo);
+
+    REBCNT n;
+    for (n = 0; n < Profile.num_nodes; ++n) {
+        if (Profile.nodes[n].self <= 0)
+            continue;
+
+        Mold_Profile_Stack(&mo, n);
+
+        REBYTE buf[MAX_INT_LEN + 1];
+        REBINT len = INT_TO_STR(Profile.nodes[n].self, buf);
+        Append_Codepoint_Raw(mo.series, ' ');
+        Append_Unencoded_Len(mo.series, cs_cast(buf), len);
+        Append_Codepoint_Raw(mo.series, '\n');
+    }
+
+    return Pop_Molded_String(&mo);
+}
+
+
+//
+//  profile: native [
+//
+//  {Measure the calls of each function run, see %d-profile.c}
+//
+//      return: [<opt> block! string!]
+//          {Unless turned on: [name calls total self series ...] with times
+//          in microseconds, most self time first}
+//      mode [logic! blank!]
+//          {ON starts over, OFF stops, BLANK! only gets the results}
+//      /folded
+//          {Results as folded call stacks for flame graph tools}
+//      /series
+//          {Profile where series are made instead, see %d-alloc.c}
+//  ]
+//
+REBNATIVE(profile)
+{
+    INCLUDE_PARAMS_OF_PROFILE;
+
+    Check_Security(Canon(SYM_DEBUG), POL_READ, 0);
+
+    REBVAL *mode = ARG(mode);
+
+    if (REF(series)) {
+        if (REF(folded))
+            fail (Error(RE_BAD_REFINES));
+
+        if (IS_LOGIC(mode) && VAL_LOGIC(mode)) {
+            Start_Series_Profile();
+            return R_VOID;
+        }
+
+        if (IS_LOGIC(mode))
+            Stop_Series_Profile();
+
+        Init_Block(D_OUT, Series_Profile_Results());
+        return R_OUT;
+    }
+
+    if (IS_LOGIC(mode) && VAL_LOGIC(mode)) {
+        Start_Profile();
+        return R_VOID;
+    }
+
+    if (IS_LOGIC(mode)) {
+        PG_Profiling = FALSE;
+        Profile.num_calls = 0; // calls still running won't be counted
+    }
+
+    if (REF(folded))
+        Init_String(D_OUT, Profile_Folded());
+    else
+        Init_Block(D_OUT, Profile_Results());
+
+    return R_OUT;
+}
+
+
+//
+//  Shutdown_Profile: C
+//
+void Shutdown_Profile(void)
+{
+    PG_Profiling = FALSE;
+    Free_Profile_Tables();
+}
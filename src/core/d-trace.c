@@ -172,7 +172,7 @@ void Trace_Value(
 //
 void Trace_String(const REBYTE *str, REBINT limit)
 {
-    static char tracebuf[64];
+    static THREAD_LOCAL char tracebuf[64];
     int depth;
     int len = MIN(60, limit);
     CHECK_DEPTH(depth);
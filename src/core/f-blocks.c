@@ -472,7 +472,7 @@ REBVAL *Alloc_Tail_Array(REBARR *a)
 // series for the spec, body, and paramlist...the spec and body are blocks,
 // and so recursion would be found when the blocks were output.)
 //
-REBCNT Find_Same_Array(REBARR *search_values, const RELVAL *value)
+REBLEN Find_Same_Array(REBARR *search_values, const RELVAL *value)
 {
     REBCNT index = 0;
     REBARR *array;
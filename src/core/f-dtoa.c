@@ -226,6 +226,14 @@ extern void *MALLOC(size_t);
 #define MALLOC malloc
 #endif
 
+// With REB_INSTANCES the Bigint caches below are per-thread, and the private
+// pool can't be (a thread-local pointer can't be statically initialized to
+// point at another thread-local), so go straight to MALLOC instead.
+//
+#if defined(REB_INSTANCES) && !defined(Omit_Private_Memory)
+#define Omit_Private_Memory
+#endif
+
 #ifndef Omit_Private_Memory
 #ifndef PRIVATE_MEM
 #define PRIVATE_MEM 2304
@@ -549,7 +557,7 @@ Bigint {
 
  typedef struct Bigint Bigint;
 
- static Bigint *freelist[Kmax+1];
+ static THREAD_LOCAL Bigint *freelist[Kmax+1];
 
  static Bigint *
 Balloc
@@ -923,7 +931,7 @@ mult
     return c;
     }
 
- static Bigint *p5s;
+ static THREAD_LOCAL Bigint *p5s;
 
  static Bigint *
 pow5mult
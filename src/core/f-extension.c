@@ -54,8 +54,8 @@ typedef struct reb_ext {
 
 // !!!! The list below should not be hardcoded, but until someone
 // needs a lot of extensions, it will do fine.
-REBEXT Ext_List[64];
-REBCNT Ext_Next = 0;
+THREAD_LOCAL REBEXT Ext_List[64];
+THREAD_LOCAL REBCNT Ext_Next = 0;
 
 
 typedef REBYTE *(INFO_FUNC)(REBINT opts, void *lib);
@@ -29,6 +29,7 @@
 //
 
 #include "sys-core.h"
+#include "sys-int-funcs.h" // REB_I64_MUL_OF for Modify_String()
 
 
 //
@@ -137,24 +138,25 @@ REBCNT Modify_Array(
 //
 //  Modify_String: C
 //
-// Returns new dst_idx.
+// Returns new dst_idx.  Positions and lengths are REBLEN-sized, so this
+// works on strings and binaries past 4GB in REB_LARGE_SERIES builds.
 //
-REBCNT Modify_String(
+REBLEN Modify_String(
     REBCNT action,          // INSERT, APPEND, CHANGE
     REBSER *dst_ser,        // target
-    REBCNT dst_idx,         // position
+    REBLEN dst_idx,         // position
     const REBVAL *src_val,  // source
     REBFLGS flags,          // AM_PART, AM_BINARY_SERIES
-    REBINT dst_len,         // length to remove
+    REBI64 dst_len,         // length to remove
     REBINT dups             // dup count
 ) {
     REBSER *src_ser = 0;
-    REBCNT src_idx = 0;
-    REBCNT src_len;
-    REBCNT tail  = SER_LEN(dst_ser);
-    REBINT size;        // total to insert
+    REBLEN src_idx = 0;
+    REBLEN src_len;
+    REBLEN tail  = SER_LEN(dst_ser);
+    REBI64 size;        // total to insert
     REBOOL needs_free;
-    REBINT limit;
+    REBI64 limit;
 
     // For INSERT/PART and APPEND/PART
     if (action != SYM_CHANGE && (flags & AM_PART))
@@ -193,8 +195,10 @@ REBCNT Modify_String(
             limit = -1;
         }
         else if (ANY_STRING(src_val)) {
+            FAIL_IF_LARGE_SERIES(VAL_SERIES(src_val)); // UTF-8 encode is REBCNT
+
             src_len = VAL_LEN_AT(src_val);
-            if (limit >= 0 && src_len > cast(REBCNT, limit))
+            if (limit >= 0 && src_len > cast(REBLEN, limit))
                 src_len = limit;
             src_ser = Make_UTF8_From_Any_String(src_val, src_len, 0);
             needs_free = TRUE;
@@ -240,7 +244,8 @@ REBCNT Modify_String(
     }
 
     // Total to insert:
-    size = dups * src_len;
+    if (REB_I64_MUL_OF(dups, cast(REBI64, src_len), &size))
+        fail (Error(RE_PAST_END));
 
     if (action != SYM_CHANGE) {
         // Always expand dst_ser for INSERT and APPEND actions:
@@ -56,7 +56,7 @@
 #define MM ((REBI64)1<<62)                  /* the modulus, 2^62 */
 #define mod_diff(x,y) (((x)-(y))&(MM-1))    /* subtraction mod MM */
 
-static REBI64 ran_x[KK];                    /* the generator state */
+static THREAD_LOCAL REBI64 ran_x[KK];                    /* the generator state */
 
 #if defined __STDC__ || defined __cplusplus
 void ran_array(REBI64 aa[], int n)
@@ -77,9 +77,9 @@ void ran_array(aa,n)    /* put n new random numbers in aa */
 /* after calling Set_Random, get new randoms by, e.g., "x=ran_arr_next()" */
 
 #define QUALITY 1009 /* recommended quality level for high-res use */
-static REBI64 ran_arr_buf[QUALITY];
-static REBI64 ran_arr_dummy=-1, ran_arr_started=-1;
-static REBI64 *ran_arr_ptr=&ran_arr_dummy;  /* the next random number, or -1 */
+static THREAD_LOCAL REBI64 ran_arr_buf[QUALITY];
+static THREAD_LOCAL REBI64 ran_arr_started=-1;
+static THREAD_LOCAL REBI64 *ran_arr_ptr=NULL; /* the next random number, or -1 (NULL until seeded) */
 
 #define TT  70      /* guaranteed separation between streams */
 #define is_odd(x)   ((x)&1)         /* units bit of x */
@@ -115,10 +115,10 @@ void Set_Random(REBI64 seed)
     ran_arr_ptr=&ran_arr_started;
 }
 
-#define ran_arr_next() (*ran_arr_ptr>=0? *ran_arr_ptr++: ran_arr_cycle())
+#define ran_arr_next() (ran_arr_ptr && *ran_arr_ptr>=0? *ran_arr_ptr++: ran_arr_cycle())
 static REBI64 ran_arr_cycle()
 {
-    if (ran_arr_ptr==&ran_arr_dummy)
+    if (ran_arr_ptr==NULL)
         Set_Random(314159L); /* the user forgot to initialize */
     ran_array(ran_arr_buf,QUALITY);
     ran_arr_buf[KK]=-1;
@@ -30,6 +30,7 @@
 
 #include "sys-core.h"
 #include "sys-deci-funcs.h"
+#include "sys-int-funcs.h" // REB_I64_ADD_OF for SKIP and AT
 
 #define THE_SIGN(v) ((v < 0) ? -1 : (v > 0) ? 1 : 0)
 
@@ -51,9 +52,12 @@ REBOOL Series_Common_Action_Returns(
     REBVAL *value = D_ARG(1);
     REBVAL *arg = D_ARGC > 1 ? D_ARG(2) : NULL;
 
-    REBINT index = cast(REBINT, VAL_INDEX(value));
-    REBINT tail = cast(REBINT, VAL_LEN_HEAD(value));
-    REBINT len = 0;
+    // Positions are kept signed and 64-bit, so they hold any REBLEN while
+    // still letting the range checks below test for negative results.
+    //
+    REBI64 index = cast(REBI64, VAL_INDEX(value));
+    REBI64 tail = cast(REBI64, VAL_LEN_HEAD(value));
+    REBI64 len = 0;
 
     switch (action) {
 
@@ -64,7 +68,7 @@ REBOOL Series_Common_Action_Returns(
         break;
 
     case SYM_TAIL:
-        VAL_INDEX(value) = (REBCNT)tail;
+        VAL_INDEX(value) = cast(REBLEN, tail);
         break;
 
     case SYM_HEAD_Q:
@@ -81,22 +85,27 @@ REBOOL Series_Common_Action_Returns(
 
     case SYM_SKIP:
     case SYM_AT:
-        len = Get_Num_From_Arg(arg);
+        if (IS_INTEGER(arg))
+            len = VAL_INT64(arg); // may reach past a 32-bit position
+        else
+            len = Get_Num_From_Arg(arg);
         {
-            REBI64 i = (REBI64)index + (REBI64)len;
+            REBI64 i;
+            if (REB_I64_ADD_OF(index, len, &i))
+                i = (len > 0) ? tail : 0;
             if (action == SYM_SKIP) {
                 if (IS_LOGIC(arg)) i--;
             } else { // A_AT
                 if (len > 0) i--;
             }
-            if (i > (REBI64)tail) i = (REBI64)tail;
+            if (i > tail) i = tail;
             else if (i < 0) i = 0;
-            VAL_INDEX(value) = (REBCNT)i;
+            VAL_INDEX(value) = cast(REBLEN, i);
         }
         break;
 
     case SYM_INDEX_OF:
-        SET_INTEGER(D_OUT, cast(REBI64, index) + 1);
+        SET_INTEGER(D_OUT, index + 1);
         *r = R_OUT;
         return TRUE; // handled
 
@@ -117,7 +126,7 @@ REBOOL Series_Common_Action_Returns(
 
         FAIL_IF_READ_ONLY_SERIES(VAL_SERIES(value));
         len = REF(part) ? Partial(value, 0, ARG(limit)) : 1;
-        index = cast(REBINT, VAL_INDEX(value));
+        index = cast(REBI64, VAL_INDEX(value));
         if (index < tail && len != 0)
             Remove_Series(VAL_SERIES(value), VAL_INDEX(value), len);
         break; }
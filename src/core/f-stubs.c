@@ -459,7 +459,7 @@ void Init_Any_Context_Core(REBVAL *out, enum Reb_Kind kind, REBCTX *c) {
 // position that negative limit would seek to...and save the length of
 // the span to get to the original index.
 //
-void Partial1(REBVAL *value, const REBVAL *limit, REBCNT *span)
+void Partial1(REBVAL *value, const REBVAL *limit, REBLEN *span)
 {
     REBOOL is_series = ANY_SERIES(value);
 
@@ -478,7 +478,7 @@ void Partial1(REBVAL *value, const REBVAL *limit, REBCNT *span)
 
     REBI64 len;
     if (IS_INTEGER(limit) || IS_DECIMAL(limit))
-        len = Int32(limit);
+        len = Int64(limit);
     else {
         if (
             !is_series
@@ -488,28 +488,31 @@ void Partial1(REBVAL *value, const REBVAL *limit, REBCNT *span)
             fail (Error(RE_INVALID_PART, limit));
         }
 
-        len = cast(REBINT, VAL_INDEX(limit)) - cast(REBINT, VAL_INDEX(value));
+        len = cast(REBI64, VAL_INDEX(limit)) - cast(REBI64, VAL_INDEX(value));
 
     }
 
     if (is_series) {
         // Restrict length to the size available:
         if (len >= 0) {
-            REBCNT maxlen = VAL_LEN_AT(value);
-            if (len > cast(REBINT, maxlen))
+            REBLEN maxlen = VAL_LEN_AT(value);
+            if (len > cast(REBI64, maxlen))
                 len = maxlen;
         }
         else {
-            len = -len;
-            if (len > cast(REBINT, VAL_INDEX(value)))
+            // Compare before negating, as -MIN_I64 doesn't fit in a REBI64
+            //
+            if (len < -cast(REBI64, VAL_INDEX(value)))
                 len = VAL_INDEX(value);
+            else
+                len = -len;
             assert(len >= 0);
-            VAL_INDEX(value) -= cast(REBCNT, len);
+            VAL_INDEX(value) -= cast(REBLEN, len);
         }
     }
 
     assert(len >= 0);
-    *span = cast(REBCNT, len);
+    *span = cast(REBLEN, len);
 }
 
 
@@ -529,11 +532,11 @@ void Partial1(REBVAL *value, const REBVAL *limit, REBCNT *span)
 // NOTE: Can modify the value's index!
 // The result can be negative. ???
 //
-REBINT Partial(REBVAL *aval, REBVAL *bval, REBVAL *lval)
+REBI64 Partial(REBVAL *aval, REBVAL *bval, REBVAL *lval)
 {
     REBVAL *val;
-    REBINT len;
-    REBINT maxlen;
+    REBI64 len;
+    REBI64 maxlen;
 
     // If lval is unset, use the current len of the target value:
     if (IS_VOID(lval)) {
@@ -543,7 +546,7 @@ REBINT Partial(REBVAL *aval, REBVAL *bval, REBVAL *lval)
     }
 
     if (IS_INTEGER(lval) || IS_DECIMAL(lval)) {
-        len = Int32(lval);
+        len = Int64(lval);
         val = bval;
     }
     else {
@@ -564,7 +567,7 @@ REBINT Partial(REBVAL *aval, REBVAL *bval, REBVAL *lval)
         else
             fail (Error(RE_INVALID_PART, lval));
 
-        len = cast(REBINT, VAL_INDEX(lval)) - cast(REBINT, VAL_INDEX(val));
+        len = cast(REBI64, VAL_INDEX(lval)) - cast(REBI64, VAL_INDEX(val));
     }
 
     if (!val) val = aval;
@@ -572,14 +575,15 @@ REBINT Partial(REBVAL *aval, REBVAL *bval, REBVAL *lval)
     // Restrict length to the size available
     //
     if (len >= 0) {
-        maxlen = (REBINT)VAL_LEN_AT(val);
+        maxlen = cast(REBI64, VAL_LEN_AT(val));
         if (len > maxlen) len = maxlen;
     }
     else {
-        len = -len;
-        if (len > cast(REBINT, VAL_INDEX(val)))
-            len = cast(REBINT, VAL_INDEX(val));
-        VAL_INDEX(val) -= (REBCNT)len;
+        if (len < -cast(REBI64, VAL_INDEX(val))) // -MIN_I64 would overflow
+            len = cast(REBI64, VAL_INDEX(val));
+        else
+            len = -len;
+        VAL_INDEX(val) -= cast(REBLEN, len);
     }
 
     return len;
@@ -1269,3 +1269,121 @@ REBNATIVE(scan_net_header)
     Init_Block(D_OUT, result);
     return R_OUT;
 }
+
+
+//
+//  dechunk: native [
+//      {Decode complete chunks of an HTTP/1.1 "chunked" transfer coding.}
+//
+//      return: [binary! blank!]
+//          {Trailer header bytes once the last chunk is seen, else blank}
+//      data [binary!]
+//          {Received bytes (decoded chunks are removed from its head)}
+//      out [binary!]
+//          {Buffer that chunk payloads are appended to}
+//  ]
+//
+REBNATIVE(dechunk)
+//
+// %prot-http.r formerly did this with PARSE on every network READ, which
+// re-scanned and copied the whole pending input each time.  Here each chunk
+// is appended to the output once, and only what was consumed is removed.
+// A partial chunk at the end is left in the data for the next call.
+{
+    INCLUDE_PARAMS_OF_DECHUNK;
+
+    REBSER *data = VAL_SERIES(ARG(data));
+    REBSER *out = VAL_SERIES(ARG(out));
+
+    if (data == out)
+        fail (Error_Invalid_Arg(ARG(out)));
+
+    FAIL_IF_READ_ONLY_SERIES(data);
+    FAIL_IF_READ_ONLY_SERIES(out);
+
+    REBYTE *head = VAL_BIN_AT(ARG(data));
+    REBYTE *end = head + VAL_LEN_AT(ARG(data));
+    REBYTE *cp = head;
+
+    SET_BLANK(D_OUT); // stays blank until the last-chunk is reached
+
+    while (TRUE) {
+        REBYTE *start = cp; // if incomplete, resume from here next time
+
+        // chunk-size is hex digits, optionally followed by extensions
+        // that are ignored, then CR LF.
+        //
+        REBCNT size = 0;
+        REBCNT digits = 0;
+        for (; cp < end; ++cp, ++digits) {
+            REBYTE nibble;
+            if (*cp >= '0' && *cp <= '9')
+                nibble = *cp - '0';
+            else if (*cp >= 'a' && *cp <= 'f')
+                nibble = *cp - 'a' + 10;
+            else if (*cp >= 'A' && *cp <= 'F')
+                nibble = *cp - 'A' + 10;
+            else
+                break;
+
+            if (size > (MAX_U32 >> 4))
+                fail (Error(RE_OVERFLOW));
+            size = (size << 4) | nibble;
+        }
+
+        if (cp == end) {
+            cp = start;
+            break; // size line not complete yet
+        }
+        if (digits == 0)
+            fail (Error(RE_INVALID_DATA, ARG(data)));
+
+        while (cp < end && *cp != LF)
+            ++cp; // skip chunk extensions (and the CR)
+        if (cp == end) {
+            cp = start;
+            break;
+        }
+        ++cp; // skip LF
+
+        if (size == 0) {
+            //
+            // last-chunk: optional trailer header fields, ending with an
+            // empty line.  Hand the trailer back for SCAN-NET-HEADER.
+            //
+            REBYTE *trailer = cp;
+            while (TRUE) {
+                REBYTE *line = cp;
+                while (cp < end && *cp != LF)
+                    ++cp;
+                if (cp == end) {
+                    cp = start;
+                    goto finished; // trailer not complete yet
+                }
+                ++cp;
+                if (cp - line == 1 || (cp - line == 2 && *line == CR)) {
+                    Init_Binary(
+                        D_OUT, Copy_Bytes(trailer, cast(REBINT, line - trailer))
+                    );
+                    goto finished;
+                }
+            }
+        }
+
+        if (end - cp < 2 || cast(REBCNT, end - cp - 2) < size) {
+            cp = start;
+            break; // payload and its CR LF not all received yet
+        }
+
+        Append_Series(out, cp, size);
+        cp += size;
+
+        if (cp[0] != CR || cp[1] != LF)
+            fail (Error(RE_INVALID_DATA, ARG(data)));
+        cp += 2;
+    }
+
+finished:
+    Remove_Series(data, VAL_INDEX(ARG(data)), cast(REBINT, cp - head));
+    return R_OUT;
+}
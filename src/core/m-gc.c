@@ -319,14 +319,12 @@ static void Queue_Mark_Opt_Value_Deep(const RELVAL *v)
         Mark_Rebser_Only(spelling);
 
         // A GC cannot run during a binding process--which is the only
-        // time a canon word's "index" field is allowed to be nonzero.
+        // time a canon word's binder index is allowed to be nonzero.  (The
+        // low half is the bind cache, see %sys-bind.h)
         //
         assert(
             NOT_SER_FLAG(spelling, STRING_FLAG_CANON)
-            || (
-                spelling->misc.bind_index.high == 0
-                && spelling->misc.bind_index.low == 0
-            )
+            || spelling->misc.bind_index.high == 0
         );
 
         if (GET_VAL_FLAG(v, WORD_FLAG_BOUND)) {
@@ -1013,6 +1011,24 @@ static void Mark_Guarded_Nodes(void)
 }
 
 
+//
+//  Mark_Reusable_Varlists: C
+//
+// Expired stack varlists waiting to be reused are not referenced by anything
+// else, but must not be swept.  Their content is meaningless until reuse (it
+// is overwritten then) so only the nodes themselves are marked.
+//
+static void Mark_Reusable_Varlists(void)
+{
+    REBCNT n;
+    for (n = 0; n < TG_Num_Reusable_Varlists; ++n) {
+        REBARR *varlist = TG_Reusable_Varlists[n];
+        assert(GET_SER_INFO(varlist, SERIES_INFO_INACCESSIBLE));
+        Mark_Rebser_Only(AS_SERIES(varlist));
+    }
+}
+
+
 //
 //  Mark_Frame_Stack_Deep: C
 //
@@ -1384,9 +1400,7 @@ REBCNT Recycle_Core(REBOOL shutdown, REBSER *sweeplist)
         return 0;
     }
 
-#if !defined(NDEBUG)
-    GC_Recycling = TRUE;
-#endif
+    GC_Recycling = TRUE; // also tells apart collected series, see %d-alloc.c
 
     ASSERT_NO_GC_MARKS_PENDING();
 
@@ -1424,6 +1438,8 @@ REBCNT Recycle_Core(REBOOL shutdown, REBSER *sweeplist)
 
         Mark_Frame_Stack_Deep();
 
+        Mark_Reusable_Varlists();
+
         // Mark potential error object from callback!
         if (!IS_BLANK_RAW(&Callback_Error)) {
             assert(NOT_VAL_FLAG(&Callback_Error, VALUE_FLAG_RELATIVE));
@@ -1441,6 +1457,9 @@ REBCNT Recycle_Core(REBOOL shutdown, REBSER *sweeplist)
 
     REBCNT count = 0;
 
+    Prune_Shape_Cache(); // weak references to keylists, see %c-context.c
+    Settle_Word_Table(); // canons are removed by the sweep, see %c-word.c
+
     if (sweeplist != NULL) {
     #if defined(NDEBUG)
         panic (sweeplist);
@@ -1503,9 +1522,10 @@ REBCNT Recycle_Core(REBOOL shutdown, REBSER *sweeplist)
 
     ASSERT_NO_GC_MARKS_PENDING();
 
-#if !defined(NDEBUG)
     GC_Recycling = FALSE;
-#endif
+
+    if (PG_Series_Profiling)
+        Series_Profile_Recycled();
 
     return count;
 }
@@ -320,7 +320,7 @@ void Init_Pools(REBINT scale)
     // organized to have some of the logic not in the pools file
 
 #if !defined(NDEBUG)
-    PG_Reb_Stats = ALLOC(REB_STATS);
+    PG_Reb_Stats = ALLOC_ZEROFILL(REB_STATS);
 #endif
 
     // Manually allocated series that GC is not responsible for (unless a
@@ -562,11 +562,11 @@ void Free_Node(REBCNT pool_id, void *pv)
 //
 static REBOOL Series_Data_Alloc(
     REBSER *s,
-    REBCNT length,
+    REBLEN length,
     REBYTE wide,
     REBCNT flags
 ) {
-    REBCNT size; // size of allocation (possibly bigger than we need)
+    size_t size; // size of allocation (possibly bigger than we need)
 
     REBCNT pool_num = FIND_POOL(length * wide);
 
@@ -601,7 +601,7 @@ static REBOOL Series_Data_Alloc(
 
         size = length * wide;
         if (flags & MKS_POWER_OF_2) {
-            REBCNT len = 2048;
+            size_t len = 2048;
             while(len < size)
                 len *= 2;
             size = len;
@@ -662,9 +662,15 @@ static REBOOL Series_Data_Alloc(
     //
     SET_SER_INFO(s, SERIES_INFO_HAS_DYNAMIC);
 
-    // See if allocation tripped our need to queue a garbage collection
+    // See if allocation tripped our need to queue a garbage collection.
+    // (With REB_LARGE_SERIES the size may not fit in the REBINT ballast.)
 
-    if ((GC_Ballast -= size) <= 0) SET_SIGNAL(SIG_RECYCLE);
+    if (cast(REBI64, size) >= GC_Ballast) {
+        GC_Ballast = 0;
+        SET_SIGNAL(SIG_RECYCLE);
+    }
+    else
+        GC_Ballast -= cast(REBINT, size);
 
 #if !defined(NDEBUG)
     if (pool_num >= SYSTEM_POOL)
@@ -673,7 +679,7 @@ static REBOOL Series_Data_Alloc(
 
     if (flags & MKS_ARRAY) {
 #if !defined(NDEBUG)
-        REBCNT n;
+        REBLEN n;
 
         PG_Reb_Stats->Blocks++;
 
@@ -833,12 +839,12 @@ REBSER *Try_Find_Containing_Series_Debug(const void *p)
 // Rather than pay for the cost on every series of an "actual allocation size",
 // the optimization choice is to only pay for a "rounded up to power of 2" bit.
 //
-REBCNT Series_Allocation_Unpooled(REBSER *series)
+size_t Series_Allocation_Unpooled(REBSER *series)
 {
-    REBCNT total = SER_TOTAL(series);
+    size_t total = SER_TOTAL(series);
 
     if (GET_SER_INFO(series, SERIES_INFO_POWER_OF_2)) {
-        REBCNT len = 2048;
+        size_t len = 2048;
         while(len < total)
             len *= 2;
         return len;
@@ -857,16 +863,18 @@ REBCNT Series_Allocation_Unpooled(REBSER *series)
 // Large series will be allocated from system memory.
 // The series will be zero length to start with.
 //
-REBSER *Make_Series(REBCNT capacity, REBYTE wide, REBCNT flags)
+REBSER *Make_Series(REBLEN capacity, REBYTE wide, REBCNT flags)
 {
     // PRESERVE flag only makes sense for Remake_Series, where there is
     // previous data to be kept.
     assert(!(flags & MKS_PRESERVE));
     assert(wide != 0 && capacity != 0); // not allowed
 
-    if (cast(REBU64, capacity) * wide > MAX_I32)
+    if (cast(REBU64, capacity) * wide > MAX_SERIES_BYTES)
         fail (Error_No_Memory(cast(REBU64, capacity) * wide));
 
+    ++PG_Series_Made;
+
 #if !defined(NDEBUG)
     PG_Reb_Stats->Series_Made++;
     PG_Reb_Stats->Series_Memory += capacity * wide;
@@ -967,6 +975,9 @@ REBSER *Make_Series(REBCNT capacity, REBYTE wide, REBCNT flags)
         ] = s;
     }
 
+    if (PG_Series_Profiling)
+        Series_Profile_Made(s);
+
     assert(s->info.bits & NODE_FLAG_END);
     assert(NOT(s->info.bits & NODE_FLAG_CELL));
     assert(SER_LEN(s) == 0);
@@ -1084,7 +1095,7 @@ void Swap_Underlying_Series_Data(REBSER *s1, REBSER *s2)
 // ahead to account for unused capacity at the head of the
 // allocation.  They also must know the total allocation size.
 //
-static void Free_Unbiased_Series_Data(REBYTE *unbiased, REBCNT size_unpooled)
+static void Free_Unbiased_Series_Data(REBYTE *unbiased, size_t size_unpooled)
 {
     REBCNT pool_num = FIND_POOL(size_unpooled);
     REBPOL *pool;
@@ -1153,14 +1164,22 @@ static void Free_Unbiased_Series_Data(REBYTE *unbiased, REBCNT size_unpooled)
 // WARNING: never use direct pointers into the series data, as the
 // series data can be relocated in memory.
 //
-void Expand_Series(REBSER *s, REBCNT index, REBCNT delta)
+void Expand_Series(REBSER *s, REBLEN index, REBLEN delta)
 {
     assert(index <= SER_LEN(s));
-    if (delta & 0x80000000) fail (Error(RE_PAST_END)); // 2GB max
+
+    // Also catches a "negative" delta computed by a caller in REBLEN
+    //
+    if (
+        (cast(REBU64, SER_LEN(s)) + cast(REBU64, delta)) * SER_WIDE(s)
+        > MAX_SERIES_BYTES
+    ){
+        fail (Error(RE_PAST_END));
+    }
 
     if (delta == 0) return;
 
-    REBCNT len_old = SER_LEN(s);
+    REBLEN len_old = SER_LEN(s);
 
     REBYTE wide = SER_WIDE(s);
     const REBOOL is_array = Is_Array_Series(s);
@@ -1196,9 +1215,9 @@ void Expand_Series(REBSER *s, REBCNT index, REBCNT delta)
 
     // Width adjusted variables:
 
-    REBCNT start = index * wide;
-    REBCNT extra = delta * wide;
-    REBCNT size = SER_LEN(s) * wide;
+    size_t start = index * wide;
+    size_t extra = delta * wide;
+    size_t size = SER_LEN(s) * wide;
 
     // + wide for terminator
     if ((size + extra + wide) <= SER_REST(s) * SER_WIDE(s)) {
@@ -1266,7 +1285,7 @@ void Expand_Series(REBSER *s, REBCNT index, REBCNT delta)
 
     // Have we recently expanded the same series?
 
-    REBCNT x = 1;
+    REBLEN x = 1;
     REBUPT n_available = 0;
     REBUPT n_found;
     for (n_found = 0; n_found < MAX_EXPAND_LIST; n_found++) {
@@ -1292,8 +1311,8 @@ void Expand_Series(REBSER *s, REBCNT index, REBCNT delta)
     // the REBSER node, so the content is extracted either way.
     //
     union Reb_Series_Content content_old;
-    REBINT bias_old;
-    REBCNT size_old;
+    REBLEN bias_old;
+    size_t size_old;
     REBYTE *data_old;
     if (was_dynamic) {
         data_old = s->content.dynamic.data;
@@ -1360,10 +1379,10 @@ void Expand_Series(REBSER *s, REBCNT index, REBCNT delta)
 // MKS_PRESERVE is passed in the flags.  The other flags are
 // handled the same as when passed to Make_Series.
 //
-void Remake_Series(REBSER *s, REBCNT units, REBYTE wide, REBCNT flags)
+void Remake_Series(REBSER *s, REBLEN units, REBYTE wide, REBCNT flags)
 {
     REBOOL is_array = Is_Array_Series(s);
-    REBCNT len_old = SER_LEN(s);
+    REBLEN len_old = SER_LEN(s);
     REBYTE wide_old = SER_WIDE(s);
 
 #if !defined(NDEBUG)
@@ -1377,8 +1396,8 @@ void Remake_Series(REBSER *s, REBCNT units, REBYTE wide, REBCNT flags)
 
     REBOOL was_dynamic = GET_SER_INFO(s, SERIES_INFO_HAS_DYNAMIC);
 
-    REBINT bias_old;
-    REBINT size_old;
+    REBLEN bias_old;
+    size_t size_old;
 
     // Extract the data pointer to take responsibility for it.  (The pointer
     // may have already been extracted if the caller is doing their own
@@ -1447,9 +1466,15 @@ void GC_Kill_Series(REBSER *s)
     assert(!IS_FREE_NODE(s));
     assert(NOT(s->header.bits & NODE_FLAG_CELL)); // use Free_Paired
 
+    if (PG_Series_Profiling)
+        Series_Profile_Killed(s);
+
     if (GET_SER_FLAG(s, SERIES_FLAG_UTF8_STRING))
         GC_Kill_Interning(s); // needs special handling to adjust canons
 
+    if (GET_SER_INFO(s, SERIES_INFO_DECODED))
+        Free_Decoded_Array(AS_ARRAY(s)); // evaluator's cache, see %c-eval.c
+
     // Remove series from expansion list, if found:
     REBCNT n;
     for (n = 1; n < MAX_EXPAND_LIST; n++) {
@@ -1457,10 +1482,10 @@ void GC_Kill_Series(REBSER *s)
     }
 
     if (GET_SER_INFO(s, SERIES_INFO_HAS_DYNAMIC)) {
-        REBCNT size = SER_TOTAL(s);
+        size_t size = SER_TOTAL(s);
 
         REBYTE wide = SER_WIDE(s);
-        REBCNT bias = SER_BIAS(s);
+        REBLEN bias = SER_BIAS(s);
         s->content.dynamic.data -= wide * bias;
         Free_Unbiased_Series_Data(
             s->content.dynamic.data,
@@ -1474,8 +1499,12 @@ void GC_Kill_Series(REBSER *s)
         // the GC watermarks interact with Alloc_Mem and the "higher
         // level" allocations.
 
-        if (REB_I32_ADD_OF(GC_Ballast, size, &GC_Ballast))
+        if (
+            size > MAX_I32
+            || REB_I32_ADD_OF(GC_Ballast, cast(REBINT, size), &GC_Ballast)
+        ){
             GC_Ballast = MAX_I32;
+        }
     }
     else {
         // Special GC processing for HANDLE! when the handle is implemented as
@@ -1602,15 +1631,15 @@ void Free_Series(REBSER *s)
 //
 void Widen_String(REBSER *s, REBOOL preserve)
 {
-    REBCNT len_old = SER_LEN(s);
+    REBLEN len_old = SER_LEN(s);
 
     REBYTE wide_old = SER_WIDE(s);
     assert(wide_old == 1);
 
     REBOOL was_dynamic = GET_SER_INFO(s, SERIES_INFO_HAS_DYNAMIC);
 
-    REBCNT bias_old;
-    REBCNT size_old;
+    REBLEN bias_old;
+    size_t size_old;
     REBYTE *data_old;
     union Reb_Series_Content content_old;
     if (was_dynamic) {
@@ -1644,7 +1673,7 @@ void Widen_String(REBSER *s, REBOOL preserve)
         REBYTE *bp = data_old;
         REBUNI *up = UNI_HEAD(s);
 
-        REBCNT n;
+        REBLEN n;
         for (n = 0; n <= len_old; n++) up[n] = bp[n]; // includes terminator
         s->content.dynamic.len = len_old;
     }
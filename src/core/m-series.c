@@ -39,9 +39,9 @@
 //
 // Extend a series at its end without affecting its tail index.
 //
-void Extend_Series(REBSER *s, REBCNT delta)
+void Extend_Series(REBSER *s, REBLEN delta)
 {
-    REBCNT len_old = SER_LEN(s);
+    REBLEN len_old = SER_LEN(s);
     EXPAND_SERIES_TAIL(s, delta);
     SET_SERIES_LEN(s, len_old);
 }
@@ -54,11 +54,11 @@ void Extend_Series(REBSER *s, REBCNT delta)
 // series at the given index.  Expand it if necessary.  Does
 // not add a terminator to tail.
 //
-REBCNT Insert_Series(
+REBLEN Insert_Series(
     REBSER *s,
-    REBCNT index,
+    REBLEN index,
     const REBYTE *data,
-    REBCNT len
+    REBLEN len
 ) {
     if (index > SER_LEN(s))
         index = SER_LEN(s);
@@ -84,9 +84,9 @@ REBCNT Insert_Series(
 // The new tail position will be returned as the result.
 // A terminator will be added to the end of the appended data.
 //
-void Append_Series(REBSER *s, const REBYTE *data, REBCNT len)
+void Append_Series(REBSER *s, const REBYTE *data, REBLEN len)
 {
-    REBCNT len_old = SER_LEN(s);
+    REBLEN len_old = SER_LEN(s);
     REBYTE wide = SER_WIDE(s);
 
     assert(!Is_Array_Series(s));
@@ -162,7 +162,7 @@ REBSER *Copy_Sequence(REBSER *original)
 // Use Copy_Array routines (which specify Shallow, Deep, etc.) for
 // greater detail needed when expressing intent for Rebol Arrays.
 //
-REBSER *Copy_Sequence_At_Len(REBSER *original, REBCNT index, REBCNT len)
+REBSER *Copy_Sequence_At_Len(REBSER *original, REBLEN index, REBLEN len)
 {
     REBSER *copy = Make_Series(len + 1, SER_WIDE(original), MKS_NONE);
 
@@ -198,21 +198,21 @@ REBSER *Copy_Sequence_At_Position(const REBVAL *position)
 // Remove a series of values (bytes, longs, reb-vals) from the
 // series at the given index.
 //
-void Remove_Series(REBSER *s, REBCNT index, REBINT len)
+void Remove_Series(REBSER *s, REBLEN index, REBI64 len)
 {
     if (len <= 0) return;
 
     REBOOL is_dynamic = GET_SER_INFO(s, SERIES_INFO_HAS_DYNAMIC);
-    REBCNT len_old = SER_LEN(s);
+    REBLEN len_old = SER_LEN(s);
 
-    REBCNT start = index * SER_WIDE(s);
+    size_t start = index * SER_WIDE(s);
 
     // Optimized case of head removal.  For a dynamic series this may just
     // add "bias" to the head...rather than move any bytes.
 
     if (is_dynamic && index == 0) {
-        if (cast(REBCNT, len) > len_old)
-            len = len_old;
+        if (cast(REBLEN, len) > len_old)
+            len = cast(REBI64, len_old);
 
         s->content.dynamic.len -= len;
         if (s->content.dynamic.len == 0) {
@@ -225,9 +225,7 @@ void Remove_Series(REBSER *s, REBCNT index, REBINT len)
         }
         else {
             // Add bias to head:
-            REBCNT bias = SER_BIAS(s);
-            if (REB_U32_ADD_OF(bias, len, &bias))
-                fail (Error(RE_OVERFLOW));
+            REBLEN bias = SER_BIAS(s) + len;
 
             if (bias > 0xffff) { //bias is 16-bit, so a simple SER_ADD_BIAS could overflow it
                 REBYTE *data = s->content.dynamic.data;
@@ -263,7 +261,7 @@ void Remove_Series(REBSER *s, REBCNT index, REBINT len)
 
     // Clip if past end and optimize the remove operation:
 
-    if (len + index >= len_old) {
+    if (cast(REBLEN, len) + index >= len_old) {
         SET_SERIES_LEN(s, index);
         TERM_SERIES(s);
         return;
@@ -273,12 +271,12 @@ void Remove_Series(REBSER *s, REBCNT index, REBINT len)
     // be implicit (e.g. there may not be a full SER_WIDE() worth of data
     // at the termination location).  Use TERM_SERIES() instead.
     //
-    REBCNT length = SER_LEN(s) * SER_WIDE(s);
-    SET_SERIES_LEN(s, len_old - cast(REBCNT, len));
-    len *= SER_WIDE(s);
+    size_t length = SER_LEN(s) * SER_WIDE(s);
+    SET_SERIES_LEN(s, len_old - cast(REBLEN, len));
+    size_t gap = cast(size_t, len) * SER_WIDE(s);
 
     REBYTE *data = SER_DATA_RAW(s) + start;
-    memmove(data, data + len, length - (start + len));
+    memmove(data, data + gap, length - (start + gap));
     TERM_SERIES(s);
 }
 
@@ -290,7 +288,7 @@ void Remove_Series(REBSER *s, REBCNT index, REBINT len)
 //
 void Unbias_Series(REBSER *s, REBOOL keep)
 {
-    REBCNT len = SER_BIAS(s);
+    REBLEN len = SER_BIAS(s);
     if (len == 0)
         return;
 
@@ -367,7 +365,7 @@ void Clear_Series(REBSER *s)
 // Reset series and expand it to required size.
 // The tail is reset to zero.
 //
-void Resize_Series(REBSER *s, REBCNT size)
+void Resize_Series(REBSER *s, REBLEN size)
 {
     if (GET_SER_INFO(s, SERIES_INFO_HAS_DYNAMIC)) {
         s->content.dynamic.len = 0;
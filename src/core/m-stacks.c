@@ -106,6 +106,8 @@ void Init_Stacks(REBCNT size)
     // up a `REBFRM` and calls Do_Core())  Singly linked.
     //
     TG_Frame_Stack = NULL;
+
+    TG_Num_Reusable_Varlists = 0;
 }
 
 
@@ -120,6 +122,11 @@ void Shutdown_Stacks(void)
 
     Free_Array(DS_Array);
 
+    // Reusable varlists are managed, so the shutdown GC will free them once
+    // they are no longer being kept alive from this list.
+    //
+    TG_Num_Reusable_Varlists = 0;
+
     assert(TG_Top_Chunk == cast(struct Reb_Chunk*, &TG_Root_Chunker->payload));
 
     // Because we always keep one chunker of headroom allocated, and the
@@ -342,9 +349,15 @@ REBFUN *Underlying_Function_Debug(
 //
 // If there's already a frame this will return it, otherwise create it.
 //
+// Stack contexts are just a singular node pointing at the chunk stack, so
+// the node of an expired frame nothing referenced can be reused for any
+// other function (see Drop_Function_Args_For_Frame_Core()).
+//
 void Reify_Frame_Context_Maybe_Fulfilling(REBFRM *f) {
     assert(Is_Any_Function_Frame(f)); // varargs reifies while still pending
 
+    REBOOL recycled = FALSE;
+
     if (f->varlist != NULL) {
         //
         // We have our function call's args in an array, but it is not yet
@@ -357,9 +370,30 @@ void Reify_Frame_Context_Maybe_Fulfilling(REBFRM *f) {
         assert(IS_TRASH_DEBUG(ARR_AT(f->varlist, 0))); // we fill this in
         assert(GET_SER_INFO(f->varlist, SERIES_INFO_HAS_DYNAMIC));
     }
+    else if (TG_Num_Reusable_Varlists != 0) {
+        f->varlist = TG_Reusable_Varlists[--TG_Num_Reusable_Varlists];
+
+        ASSERT_ARRAY_MANAGED(f->varlist);
+        assert(GET_SER_FLAG(f->varlist, ARRAY_FLAG_VARLIST));
+        assert(GET_SER_FLAG(f->varlist, CONTEXT_FLAG_STACK));
+        assert(NOT_SER_INFO(f->varlist, SERIES_INFO_FRAME_ESCAPED));
+        assert(AS_SERIES(f->varlist)->misc.f == NULL);
+
+        CLEAR_SER_INFO(f->varlist, SERIES_INFO_INACCESSIBLE);
+        CLEAR_SER_INFO(f->varlist, SERIES_INFO_RUNNING);
+        recycled = TRUE;
+
+    #if !defined(NDEBUG)
+        PG_Reb_Stats->Frames_Recycled++;
+    #endif
+    }
     else {
         f->varlist = Alloc_Singular_Array();
         SET_SER_FLAGS(f->varlist, ARRAY_FLAG_VARLIST | CONTEXT_FLAG_STACK);
+
+    #if !defined(NDEBUG)
+        PG_Reb_Stats->Frames_Reified++;
+    #endif
     }
 
     REBCTX *context = AS_CONTEXT(f->varlist);
@@ -397,7 +431,8 @@ void Reify_Frame_Context_Maybe_Fulfilling(REBFRM *f) {
     if (f->flags.bits & DO_FLAG_NATIVE_HOLD)
         SET_SER_INFO(CTX_VARLIST(context), SERIES_INFO_RUNNING);
 
-    MANAGE_ARRAY(f->varlist);
+    if (NOT(recycled))
+        MANAGE_ARRAY(f->varlist);
 
 #if !defined(NDEBUG)
     //
@@ -755,6 +755,10 @@ REBNATIVE(hijack)
 
     victim->extra.binding = NULL; // old exit binding extracted for proxy
 
+    // The hijacker may keep its arguments (see FUNC_FLAG_ARGS_DONT_ESCAPE)
+    //
+    CLEAR_VAL_FLAG(victim, FUNC_FLAG_ARGS_DONT_ESCAPE);
+
     *ARR_HEAD(VAL_FUNC_PARAMLIST(victim)) = *victim; // update rootparam
 
     // Update the meta information on the function to indicate it's hijacked
@@ -892,7 +896,7 @@ REBNATIVE(tighten)
     //
     REBARR *body_holder = Alloc_Singular_Array();
     AS_SERIES(body_holder)->misc.dispatcher = FUNC_DISPATCHER(original);
-    /* AS_SERIES(body_holder)->link not used at this time */
+    AS_SERIES(body_holder)->link.calls = 0; // see Tier_Up_If_Hot()
 
     RELVAL *body = ARR_HEAD(body_holder);
 
@@ -72,6 +72,41 @@ const void *r3_libtcc1_symbols[];
 #define CHAR_HEAD(x) cs_cast(BIN_HEAD(x))
 
 
+//
+//  Add_Symbols_To_TCC: C
+//
+// It is technically possible for ELF binaries to "--export-dynamic" (or
+// -rdynamic in CMake) and make executables embed symbols for functions
+// in them "like a DLL".  However, we would like to make API symbols for
+// Rebol available to the dynamically loaded code on all platforms, so
+// this uses `tcc_add_symbol()` to work the same way on Windows/Linux/OSX.
+//
+// Symbols in libtcc1 are added too, to avoid bundling with libtcc1.a
+//
+REBOOL Add_Symbols_To_TCC(void *state)
+{
+    const void **sym = &rebol_symbols[0];
+    for (; *sym != NULL; sym += 2) {
+        if (tcc_add_symbol(
+            cast(TCCState*, state), cast(const char*, *sym), *(sym + 1)
+        ) < 0){
+            return FALSE;
+        }
+    }
+
+    sym = &r3_libtcc1_symbols[0];
+    for (; *sym != NULL; sym += 2) {
+        if (tcc_add_symbol(
+            cast(TCCState*, state), cast(const char*, *sym), *(sym + 1)
+        ) < 0){
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+
 static void tcc_error_report(void *ignored, const char *msg)
 {
     assert(ignored == NULL); // !!! is this to tunnel an arbitrary pointer?
@@ -568,24 +603,8 @@ REBNATIVE(compile)
 
     Free_Series(combined_src);
 
-    // It is technically possible for ELF binaries to "--export-dynamic" (or
-    // -rdynamic in CMake) and make executables embed symbols for functions
-    // in them "like a DLL".  However, we would like to make API symbols for
-    // Rebol available to the dynamically loaded code on all platforms, so
-    // this uses `tcc_add_symbol()` to work the same way on Windows/Linux/OSX
-    //
-    const void **sym = &rebol_symbols[0];
-    for (; *sym != NULL; sym += 2) {
-        if (tcc_add_symbol(state, cast(const char*, *sym), *(sym + 1)) < 0)
-            fail (Error(RE_TCC_RELOCATE));
-    }
-
-    // Add symbols in libtcc1, to avoid bundling with libtcc1.a
-    sym = &r3_libtcc1_symbols[0];
-    for (; *sym != NULL; sym += 2) {
-        if (tcc_add_symbol(state, cast(const char*, *sym), *(sym + 1)) < 0)
-            fail (Error(RE_TCC_RELOCATE));
-    }
+    if (!Add_Symbols_To_TCC(state))
+        fail (Error(RE_TCC_RELOCATE));
 
     if ((err = add_path(
         state, libdir, tcc_add_library_path, RE_TCC_LIBRARY_PATH
@@ -72,6 +72,49 @@
     #endif
 #endif
 
+#if !defined(SHA256_DEFINED) && defined(HAS_SHA256)
+    #ifdef __cplusplus
+    extern "C" {
+    #endif
+
+    void SHA256_Init(void *c);
+    void SHA256_Update(void *c, REBYTE *data, REBCNT len);
+    void SHA256_Final(REBYTE *md, void *c);
+    int  SHA256_CtxSize(void);
+
+    void SHA512_Init(void *c);
+    void SHA512_Update(void *c, REBYTE *data, REBCNT len);
+    void SHA512_Final(REBYTE *md, void *c);
+    int  SHA512_CtxSize(void);
+
+    void SHA384_Init(void *c);
+    void SHA384_Final(REBYTE *md, void *c);
+
+    #ifdef __cplusplus
+    }
+    #endif
+#endif
+
+#if !defined(BLAKE2_DEFINED) && defined(HAS_BLAKE2)
+    #ifdef __cplusplus
+    extern "C" {
+    #endif
+
+    void BLAKE2B_Init(void *c);
+    void BLAKE2B_Update(void *c, REBYTE *data, REBCNT len);
+    void BLAKE2B_Final(REBYTE *md, void *c);
+    int  BLAKE2B_CtxSize(void);
+
+    void BLAKE2S_Init(void *c);
+    void BLAKE2S_Update(void *c, REBYTE *data, REBCNT len);
+    void BLAKE2S_Final(REBYTE *md, void *c);
+    int  BLAKE2S_CtxSize(void);
+
+    #ifdef __cplusplus
+    }
+    #endif
+#endif
+
 #ifdef HAS_MD4
     REBYTE *MD4(REBYTE *, REBCNT, REBYTE *);
 
@@ -90,6 +133,11 @@
 #endif
 
 
+// Largest digest[].len and digest[].hmacblock, for stack buffers
+//
+#define MAX_DIGEST_LEN 64
+#define MAX_HMAC_BLOCK 128
+
 // Table of has functions and parameters:
 static struct {
     REBYTE *(*digest)(REBYTE *, REBCNT, REBYTE *);
@@ -106,6 +154,32 @@ static struct {
     {SHA1, SHA1_Init, SHA1_Update, SHA1_Final, SHA1_CtxSize, SYM_SHA1, 20, 64},
 #endif
 
+#ifdef HAS_SHA256
+    {
+        SHA256, SHA256_Init, SHA256_Update, SHA256_Final, SHA256_CtxSize,
+        SYM_SHA256, 32, 64
+    },
+    {
+        SHA384, SHA384_Init, SHA512_Update, SHA384_Final, SHA512_CtxSize,
+        SYM_SHA384, 48, 128
+    },
+    {
+        SHA512, SHA512_Init, SHA512_Update, SHA512_Final, SHA512_CtxSize,
+        SYM_SHA512, 64, 128
+    },
+#endif
+
+#ifdef HAS_BLAKE2
+    {
+        BLAKE2B, BLAKE2B_Init, BLAKE2B_Update, BLAKE2B_Final, BLAKE2B_CtxSize,
+        SYM_BLAKE2B, 64, 128
+    },
+    {
+        BLAKE2S, BLAKE2S_Init, BLAKE2S_Update, BLAKE2S_Final, BLAKE2S_CtxSize,
+        SYM_BLAKE2S, 32, 64
+    },
+#endif
+
 #ifdef HAS_MD4
     {MD4, MD4_Init, MD4_Update, MD4_Final, MD4_CtxSize, SYM_MD4, 16, 64},
 #endif
@@ -119,6 +193,79 @@ static struct {
 };
 
 
+//
+//  Find_Digest: C
+//
+// Index into digests[] for a method word, or -1 if not a digest.
+//
+static REBINT Find_Digest(REBSYM sym)
+{
+    REBCNT i;
+    for (i = 0; i < sizeof(digests) / sizeof(digests[0]); i++) {
+        if (SAME_SYM_NONZERO(digests[i].sym, sym))
+            return i;
+    }
+    return -1;
+}
+
+
+//
+//  Hmac_Init: C
+//
+// HMAC (RFC 2104) is H((K ^ opad) + H((K ^ ipad) + data)), with the key
+// first hashed if longer than the block and then zero padded to the block
+// size.  This starts the inner hash in `ctx`, and fills in the `opad`
+// block (MAX_HMAC_BLOCK bytes) which Hmac_Final() needs.
+//
+static void Hmac_Init(
+    REBCNT i,
+    void *ctx,
+    REBYTE *opad,
+    REBYTE *key,
+    REBCNT keylen
+){
+    REBCNT blocklen = digests[i].hmacblock;
+
+    REBYTE keydigest[MAX_DIGEST_LEN];
+    if (keylen > blocklen) {
+        digests[i].digest(key, keylen, keydigest);
+        key = keydigest;
+        keylen = digests[i].len;
+    }
+
+    REBYTE ipad[MAX_HMAC_BLOCK];
+    memset(ipad, 0, blocklen);
+    memcpy(ipad, key, keylen);
+
+    memset(opad, 0, blocklen);
+    memcpy(opad, key, keylen);
+
+    REBCNT j;
+    for (j = 0; j < blocklen; j++) {
+        ipad[j] ^= 0x36; // the RFC's "ipad" byte, repeated
+        opad[j] ^= 0x5c; // the RFC's "opad" byte, repeated
+    }
+
+    digests[i].init(ctx);
+    digests[i].update(ctx, ipad, blocklen);
+}
+
+
+//
+//  Hmac_Final: C
+//
+static void Hmac_Final(REBCNT i, void *ctx, REBYTE *opad, REBYTE *out)
+{
+    REBYTE inner[MAX_DIGEST_LEN];
+    digests[i].final(inner, ctx);
+
+    digests[i].init(ctx);
+    digests[i].update(ctx, opad, digests[i].hmacblock);
+    digests[i].update(ctx, inner, digests[i].len);
+    digests[i].final(out, ctx);
+}
+
+
 //
 //  ajoin: native [
 //
@@ -202,10 +349,10 @@ REBNATIVE(spelling_of)
 //      /method
 //          "Method to use"
 //      word [word!]
-//          "Methods: SHA1 MD5 CRC32"
+//          "Methods: SHA1 SHA256 SHA384 SHA512 BLAKE2B BLAKE2S MD5 CRC32"
 //      /key
 //          "Returns keyed HMAC value"
-//      key-value [any-string!]
+//      key-value [any-string! binary!]
 //          "Key to use"
 //  ]
 //
@@ -216,7 +363,7 @@ REBNATIVE(checksum)
     REBVAL *arg = ARG(data);
     REBYTE *data = VAL_RAW_DATA_AT(arg);
     REBCNT wide = SER_WIDE(VAL_SERIES(arg));
-    REBCNT len = 0;
+    REBLEN len = 0;
 
     UNUSED(REF(part)); // checked by if limit is void
     Partial1(arg, ARG(limit), &len);
@@ -260,65 +407,31 @@ REBNATIVE(checksum)
             return R_OUT;
         }
 
-        REBCNT i;
-        for (i = 0; i < sizeof(digests) / sizeof(digests[0]); i++) {
-            if (!SAME_SYM_NONZERO(digests[i].sym, sym))
-                continue;
-
-            REBSER *digest = Make_Series(
-                digests[i].len + 1, sizeof(char), MKS_NONE
-            );
-
-            if (NOT(REF(key)))
-                digests[i].digest(data, len, BIN_HEAD(digest));
-            else {
-                REBVAL *key = ARG(key_value);
-
-                int blocklen = digests[i].hmacblock;
-
-                REBYTE tmpdigest[20]; // size must be max of all digest[].len
-                REBYTE *keycp = VAL_BIN_AT(key);
-                int keylen = VAL_LEN_AT(key);
-                if (keylen > blocklen) {
-                    digests[i].digest(keycp,keylen,tmpdigest);
-                    keycp = tmpdigest;
-                    keylen = digests[i].len;
-                }
-
-                REBYTE ipad[64]; // size must be max of all digest[].hmacblock
-                memset(ipad, 0, blocklen);
-                memcpy(ipad, keycp, keylen);
-
-                REBYTE opad[64]; // size must be max of all digest[].hmacblock
-                memset(opad, 0, blocklen);
-                memcpy(opad, keycp, keylen);
-
-                REBINT j;
-                for (j = 0; j < blocklen; j++) {
-                    ipad[j] ^= 0x36; // !!! why do people write this kind of
-                    opad[j] ^= 0x5c; // thing without a comment? !!! :-(
-                }
-
-                char *ctx = ALLOC_N(char, digests[i].ctxsize());
-                digests[i].init(ctx);
-                digests[i].update(ctx,ipad,blocklen);
-                digests[i].update(ctx, data, len);
-                digests[i].final(tmpdigest,ctx);
-                digests[i].init(ctx);
-                digests[i].update(ctx,opad,blocklen);
-                digests[i].update(ctx,tmpdigest,digests[i].len);
-                digests[i].final(BIN_HEAD(digest),ctx);
-
-                FREE_N(char, digests[i].ctxsize(), ctx);
-            }
+        REBINT i = Find_Digest(sym);
+        if (i < 0)
+            fail (Error_Invalid_Arg(ARG(word)));
 
-            TERM_BIN_LEN(digest, digests[i].len);
-            Init_Binary(D_OUT, digest);
+        REBSER *digest = Make_Series(
+            digests[i].len + 1, sizeof(char), MKS_NONE
+        );
 
-            return R_OUT;
+        if (NOT(REF(key)))
+            digests[i].digest(data, len, BIN_HEAD(digest));
+        else {
+            REBVAL *key = ARG(key_value);
+
+            REBYTE opad[MAX_HMAC_BLOCK];
+            char *ctx = ALLOC_N(char, digests[i].ctxsize());
+            Hmac_Init(i, ctx, opad, VAL_BIN_AT(key), VAL_LEN_AT(key));
+            digests[i].update(ctx, data, len);
+            Hmac_Final(i, ctx, opad, BIN_HEAD(digest));
+            FREE_N(char, digests[i].ctxsize(), ctx);
         }
 
-        fail (Error_Invalid_Arg(ARG(word)));
+        TERM_BIN_LEN(digest, digests[i].len);
+        Init_Binary(D_OUT, digest);
+
+        return R_OUT;
     }
     else if (REF(tcp)) {
         REBINT ipc = Compute_IPC(data, len);
@@ -341,6 +454,150 @@ REBNATIVE(checksum)
 }
 
 
+// State behind the HANDLE! from CHECKSUM-OPEN.  The digest's own context
+// is a separate allocation, as its size comes from digests[].ctxsize().
+//
+typedef struct {
+    REBCNT index; // into digests[]
+    REBOOL hmac;
+    REBOOL closed;
+    char *ctx;
+    REBYTE opad[MAX_HMAC_BLOCK];
+} REB_CHECKSUM_STATE;
+
+static void cleanup_checksum_state(const REBVAL *v)
+{
+    REB_CHECKSUM_STATE *state = cast(
+        REB_CHECKSUM_STATE*, VAL_HANDLE_POINTER(v)
+    );
+    FREE_N(char, digests[state->index].ctxsize(), state->ctx);
+    FREE(REB_CHECKSUM_STATE, state);
+}
+
+static REB_CHECKSUM_STATE *Checksum_State(REBVAL *handle)
+{
+    if (VAL_HANDLE_CLEANER(handle) != cleanup_checksum_state)
+        fail (Error_Invalid_Arg(handle));
+
+    REB_CHECKSUM_STATE *state = cast(
+        REB_CHECKSUM_STATE*, VAL_HANDLE_POINTER(handle)
+    );
+    if (state->closed)
+        fail (Error_Invalid_Arg(handle));
+    return state;
+}
+
+
+//
+//  checksum-open: native [
+//
+//  {Start an incremental secure hash, for data too large to hold at once.}
+//
+//      return: [handle!]
+//          "Feed it with CHECKSUM-UPDATE, get the result with CHECKSUM-CLOSE"
+//      method [word!]
+//          "SHA1 SHA256 SHA384 SHA512 BLAKE2B BLAKE2S MD5"
+//      /key
+//          "Compute a keyed HMAC value"
+//      key-value [any-string! binary!]
+//          "Key to use"
+//  ]
+//
+REBNATIVE(checksum_open)
+{
+    INCLUDE_PARAMS_OF_CHECKSUM_OPEN;
+
+    REBINT i = Find_Digest(VAL_WORD_SYM(ARG(method)));
+    if (i < 0)
+        fail (Error_Invalid_Arg(ARG(method)));
+
+    REB_CHECKSUM_STATE *state = ALLOC(REB_CHECKSUM_STATE);
+    state->index = i;
+    state->closed = FALSE;
+    state->ctx = ALLOC_N(char, digests[i].ctxsize());
+
+    if (REF(key)) {
+        REBVAL *key = ARG(key_value);
+        state->hmac = TRUE;
+        Hmac_Init(i, state->ctx, state->opad, VAL_BIN_AT(key), VAL_LEN_AT(key));
+    }
+    else {
+        state->hmac = FALSE;
+        digests[i].init(state->ctx);
+    }
+
+    Init_Handle_Managed(D_OUT, state, 0, &cleanup_checksum_state);
+    return R_OUT;
+}
+
+
+//
+//  checksum-update: native [
+//
+//  {Add data to an incremental hash from CHECKSUM-OPEN.}
+//
+//      return: [handle!]
+//      state [handle!]
+//      data [binary! string!]
+//          "If string, it will be UTF8 encoded"
+//      /part
+//      limit
+//          "Length of data (elements)"
+//  ]
+//
+REBNATIVE(checksum_update)
+{
+    INCLUDE_PARAMS_OF_CHECKSUM_UPDATE;
+
+    REB_CHECKSUM_STATE *state = Checksum_State(ARG(state));
+
+    REBLEN len;
+    UNUSED(REF(part)); // checked by if limit is void
+    Partial1(ARG(data), ARG(limit), &len);
+
+    if (IS_BINARY(ARG(data)))
+        digests[state->index].update(state->ctx, VAL_BIN_AT(ARG(data)), len);
+    else {
+        REBSER *utf8 = Make_UTF8_From_Any_String(ARG(data), len, 0);
+        digests[state->index].update(state->ctx, BIN_HEAD(utf8), BIN_LEN(utf8));
+        Free_Series(utf8);
+    }
+
+    *D_OUT = *ARG(state);
+    return R_OUT;
+}
+
+
+//
+//  checksum-close: native [
+//
+//  {Finish an incremental hash and return the digest.}
+//
+//      return: [binary!]
+//      state [handle!]
+//          "From CHECKSUM-OPEN (cannot be updated afterward)"
+//  ]
+//
+REBNATIVE(checksum_close)
+{
+    INCLUDE_PARAMS_OF_CHECKSUM_CLOSE;
+
+    REB_CHECKSUM_STATE *state = Checksum_State(ARG(state));
+    REBCNT i = state->index;
+
+    REBSER *digest = Make_Binary(digests[i].len);
+    if (state->hmac)
+        Hmac_Final(i, state->ctx, state->opad, BIN_HEAD(digest));
+    else
+        digests[i].final(BIN_HEAD(digest), state->ctx);
+    state->closed = TRUE;
+
+    TERM_BIN_LEN(digest, digests[i].len);
+    Init_Binary(D_OUT, digest);
+    return R_OUT;
+}
+
+
 //
 //  compress: native [
 //
@@ -356,20 +613,46 @@ REBNATIVE(checksum)
 //          "Use GZIP checksum"
 //      /only
 //          {Do not store header or envelope information ("raw")}
+//      /level
+//      lvl [integer!]
+//          "0 (store only) to 9 (smallest), -1 is the default (6)"
+//      /strategy
+//      strat [word!]
+//          "DEFAULT, FILTERED, HUFFMAN-ONLY, RLE, or FIXED"
+//      /parallel
+//      workers [integer!]
+//          "Deflate 128K blocks on this many threads (same output for any)"
 //  ]
 //
 REBNATIVE(compress)
 {
     INCLUDE_PARAMS_OF_COMPRESS;
 
-    REBCNT len;
+    REBLEN len;
     UNUSED(PAR(part)); // checked by if limit is void
     Partial1(ARG(data), ARG(limit), &len);
 
     REBCNT index;
     REBSER *ser = Temp_Bin_Str_Managed(ARG(data), &index, &len);
 
-    Init_Binary(D_OUT, Compress(ser, index, len, REF(gzip), REF(only)));
+    REBINT level = REF(level) ? Int32(ARG(lvl)) : -1;
+    const REBVAL *strategy = REF(strategy) ? ARG(strat) : NULL;
+
+    if (REF(parallel))
+        Init_Binary(D_OUT, Compress_Parallel(
+            ser,
+            index,
+            len,
+            REF(gzip),
+            REF(only),
+            level,
+            strategy,
+            Int32(ARG(workers))
+        ));
+    else
+        Init_Binary(D_OUT, Compress(
+            ser, index, len, REF(gzip), REF(only), level, strategy
+        ));
 
     return R_OUT;
 }
@@ -410,7 +693,7 @@ REBNATIVE(decompress)
     else
         max = -1;
 
-    REBCNT len;
+    REBLEN len;
     assert(PAR(part) != NULL);
     Partial1(data, ARG(lim), &len);
 
@@ -433,6 +716,157 @@ REBNATIVE(decompress)
 }
 
 
+//
+//  compress-open: native [
+//
+//  {Start an incremental compression, for data too large to hold at once.}
+//
+//      return: [handle!]
+//          "Feed it with COMPRESS-UPDATE, end it with COMPRESS-CLOSE"
+//      /gzip
+//          "Use GZIP checksum"
+//      /only
+//          {Do not store header or envelope information ("raw")}
+//      /level
+//      lvl [integer!]
+//          "0 (store only) to 9 (smallest), -1 is the default (6)"
+//      /strategy
+//      strat [word!]
+//          "DEFAULT, FILTERED, HUFFMAN-ONLY, RLE, or FIXED"
+//  ]
+//
+REBNATIVE(compress_open)
+{
+    INCLUDE_PARAMS_OF_COMPRESS_OPEN;
+
+    Init_Zstream(
+        D_OUT,
+        FALSE,
+        REF(gzip),
+        REF(only),
+        REF(level) ? Int32(ARG(lvl)) : -1,
+        REF(strategy) ? ARG(strat) : NULL
+    );
+    return R_OUT;
+}
+
+
+//
+//  compress-update: native [
+//
+//  {Compress more data, returning any output that is ready (may be empty).}
+//
+//      return: [binary!]
+//      stream [handle!]
+//          "From COMPRESS-OPEN"
+//      data [binary! string!]
+//          "If string, it will be UTF8 encoded"
+//      /part
+//      limit
+//          "Length of data (elements)"
+//  ]
+//
+REBNATIVE(compress_update)
+{
+    INCLUDE_PARAMS_OF_COMPRESS_UPDATE;
+
+    REBLEN len;
+    UNUSED(PAR(part)); // checked by if limit is void
+    Partial1(ARG(data), ARG(limit), &len);
+
+    REBCNT index;
+    REBSER *ser = Temp_Bin_Str_Managed(ARG(data), &index, &len);
+
+    Init_Binary(D_OUT, Zstream_Update(
+        ARG(stream), FALSE, BIN_AT(ser, index), len, FALSE
+    ));
+    return R_OUT;
+}
+
+
+//
+//  compress-close: native [
+//
+//  {Finish an incremental compression, returning the rest of the output.}
+//
+//      return: [binary!]
+//      stream [handle!]
+//          "From COMPRESS-OPEN (cannot be updated afterward)"
+//  ]
+//
+REBNATIVE(compress_close)
+{
+    INCLUDE_PARAMS_OF_COMPRESS_CLOSE;
+
+    Init_Binary(D_OUT, Zstream_Update(ARG(stream), FALSE, NULL, 0, TRUE));
+    return R_OUT;
+}
+
+
+//
+//  decompress-open: native [
+//
+//  {Start an incremental decompression, for data too large to hold at once.}
+//
+//      return: [handle!]
+//          "Feed it with DECOMPRESS-UPDATE, end it with DECOMPRESS-CLOSE"
+//      /gzip
+//          "Use GZIP checksum"
+//      /only
+//          {Do not look for header or envelope information ("raw")}
+//  ]
+//
+REBNATIVE(decompress_open)
+{
+    INCLUDE_PARAMS_OF_DECOMPRESS_OPEN;
+
+    Init_Zstream(D_OUT, TRUE, REF(gzip), REF(only), 0, NULL);
+    return R_OUT;
+}
+
+
+//
+//  decompress-update: native [
+//
+//  {Decompress more data, returning any output that is ready (may be empty).}
+//
+//      return: [binary!]
+//      stream [handle!]
+//          "From DECOMPRESS-OPEN"
+//      data [binary!]
+//          "Next chunk of compressed data (can split anywhere)"
+//  ]
+//
+REBNATIVE(decompress_update)
+{
+    INCLUDE_PARAMS_OF_DECOMPRESS_UPDATE;
+
+    Init_Binary(D_OUT, Zstream_Update(
+        ARG(stream), TRUE, VAL_BIN_AT(ARG(data)), VAL_LEN_AT(ARG(data)), FALSE
+    ));
+    return R_OUT;
+}
+
+
+//
+//  decompress-close: native [
+//
+//  {Finish an incremental decompression, failing if data was incomplete.}
+//
+//      return: [binary!]
+//      stream [handle!]
+//          "From DECOMPRESS-OPEN"
+//  ]
+//
+REBNATIVE(decompress_close)
+{
+    INCLUDE_PARAMS_OF_DECOMPRESS_CLOSE;
+
+    Init_Binary(D_OUT, Zstream_Update(ARG(stream), TRUE, NULL, 0, TRUE));
+    return R_OUT;
+}
+
+
 //
 //  debase: native [
 //
@@ -197,6 +197,8 @@ REBNATIVE(recycle)
 //          "Returns profiler object"
 //      /timer
 //          "High resolution time difference from start"
+//      /boot
+//          "Time spent in each part of startup (decompress, load, ...)"
 //      /evals
 //          "Number of values evaluated by interpreter"
 //      /dump-series
@@ -215,6 +217,27 @@ REBNATIVE(stats)
         return R_OUT;
     }
 
+    if (REF(boot)) {
+        static const char *names[BOOT_TIME_MAX] = {
+            "decompress", "load", "init", "bind", "run"
+        };
+
+        REBARR *a = Make_Array(BOOT_TIME_MAX * 2);
+        REBCNT n;
+        for (n = 0; n < BOOT_TIME_MAX; ++n) {
+            Init_Word(
+                Alloc_Tail_Array(a),
+                Intern_UTF8_Managed(cb_cast(names[n]), strlen(names[n]))
+            );
+
+            RELVAL *v = Alloc_Tail_Array(a);
+            VAL_RESET_HEADER(v, REB_TIME);
+            VAL_TIME(v) = PG_Boot_Times[n] * 1000; // usec to nsec
+        }
+        Init_Block(D_OUT, a);
+        return R_OUT;
+    }
+
     if (REF(evals)) {
         REBI64 n = Eval_Cycles + Eval_Dose - Eval_Count;
         SET_INTEGER(D_OUT, n);
@@ -256,6 +279,11 @@ REBNATIVE(stats)
 
             stats++;
             SET_INTEGER(stats, PG_Reb_Stats->Recycle_Counter);
+
+            stats++;
+            SET_INTEGER(stats, PG_Reb_Stats->Frames_Reified);
+            stats++;
+            SET_INTEGER(stats, PG_Reb_Stats->Frames_Recycled);
         }
 
         return R_OUT;
@@ -435,6 +463,10 @@ REBNATIVE(check)
 //      action [word!]
 //          "Decode, encode, identify"
 //      data [binary! image! string!]
+//      /scale
+//          "Decode an image at reduced size, if the codec can (JPEG can)"
+//      denom [integer!]
+//          "1, 2, 4 or 8 (for 1/2, 1/4 or 1/8 of the width and height)"
 //  ]
 //
 REBNATIVE(do_codec)
@@ -474,6 +506,13 @@ REBNATIVE(do_codec)
         codi.data = VAL_BIN_AT(val);
         codi.len  = VAL_LEN_AT(val);
 
+        if (REF(scale)) {
+            REBINT denom = VAL_INT32(ARG(denom));
+            if (denom != 1 && denom != 2 && denom != 4 && denom != 8)
+                fail (Error(RE_INVALID_ARG, ARG(denom)));
+            codi.scale = denom;
+        }
+
         REBINT result = fun(CODI_ACT_DECODE, &codi);
         assert(result != CODI_CHECK);
 
@@ -57,7 +57,7 @@
 
 #include "sys-core.h"
 
-REBREQ *req;        //!!! move this global
+THREAD_LOCAL REBREQ *req;        //!!! move this global
 
 #define EVENTS_LIMIT 0xFFFF //64k
 #define EVENTS_CHUNK 128
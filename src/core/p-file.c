@@ -32,9 +32,7 @@
 
 // For reference to port/state series that holds the file structure:
 #define AS_FILE(s) ((REBREQ*)VAL_BIN(s))
-#define READ_MAX ((REBCNT)(-1))
 #define HL64(v) (v##l + (v##h << 32))
-#define MAX_READ_MASK 0x7FFFFFFF // max size per chunk
 
 
 //
@@ -165,7 +163,7 @@ static void Read_File_Port(
     REBREQ *file,
     REBVAL *path,
     REBFLGS flags,
-    REBCNT len
+    REBLEN len
 ) {
     assert(IS_FILE(path));
     assert(flags == 0); // currently not used
@@ -187,7 +185,7 @@ static void Read_File_Port(
 //
 //  Write_File_Port: C
 //
-static void Write_File_Port(REBREQ *file, REBVAL *data, REBCNT len, REBOOL lines)
+static void Write_File_Port(REBREQ *file, REBVAL *data, REBLEN len, REBOOL lines)
 {
     REBSER *ser;
 
@@ -223,25 +221,27 @@ static void Write_File_Port(REBREQ *file, REBVAL *data, REBCNT len, REBOOL lines
 //
 //  Set_Length: C
 //
-// Note: converts 64bit number to 32bit. The requested size
-// can never be greater than 4GB.  If limit isn't negative it
-// constrains the size of the requested read.
+// Converts the 64-bit remaining size to a series length.  Files larger than
+// a series can hold are only read in part (unless REB_LARGE_SERIES, they
+// stop at 2GB).  If limit isn't negative it constrains the size of the
+// requested read.
 //
-static REBCNT Set_Length(const REBREQ *file, REBI64 limit)
+static REBLEN Set_Length(const REBREQ *file, REBI64 limit)
 {
     REBI64 len;
 
     // Compute and bound bytes remaining:
     len = file->special.file.size - file->special.file.index; // already read
     if (len < 0) return 0;
-    len &= MAX_READ_MASK; // limit the size
+    if (cast(REBU64, len) >= MAX_SERIES_BYTES)
+        len = MAX_SERIES_BYTES - 1; // leave room for the terminator
 
     // Return requested length:
-    if (limit < 0) return (REBCNT)len;
+    if (limit < 0) return cast(REBLEN, len);
 
     // Limit size of requested read:
-    if (limit > len) return cast(REBCNT, len);
-    return cast(REBCNT, limit);
+    if (limit > len) return cast(REBLEN, len);
+    return cast(REBLEN, limit);
 }
 
 
@@ -320,7 +320,7 @@ static REB_R File_Actor(REBFRM *frame_, REBCTX *port, REBSYM action)
         if (REF(seek))
             Set_Seek(file, ARG(index));
 
-        REBCNT len = Set_Length(file, REF(part) ? VAL_INT64(ARG(limit)) : -1);
+        REBLEN len = Set_Length(file, REF(part) ? VAL_INT64(ARG(limit)) : -1);
         Read_File_Port(D_OUT, port, file, path, flags, len);
 
         if (opened) {
@@ -382,10 +382,12 @@ static REB_R File_Actor(REBFRM *frame_, REBCTX *port, REBSYM action)
             Set_Seek(file, ARG(index));
 
         // Determine length. Clip /PART to size of string if needed.
-        REBCNT len = VAL_LEN_AT(data);
+        REBLEN len = VAL_LEN_AT(data);
         if (REF(part)) {
-            REBCNT n = Int32s(ARG(limit), 0);
-            if (n <= len) len = n;
+            REBI64 n = VAL_INT64(ARG(limit));
+            if (n < 0)
+                n = 0;
+            if (cast(REBU64, n) <= len) len = cast(REBLEN, n);
         }
 
         Write_File_Port(file, data, len, REF(lines));
@@ -440,7 +442,7 @@ static REB_R File_Actor(REBFRM *frame_, REBCTX *port, REBSYM action)
         if (!IS_OPEN(file))
             fail (Error(RE_NOT_OPEN, path)); // !!! wrong msg
 
-        REBCNT len = Set_Length(file, REF(part) ? VAL_INT64(ARG(limit)) : -1);
+        REBLEN len = Set_Length(file, REF(part) ? VAL_INT64(ARG(limit)) : -1);
         REBFLGS flags = 0;
         Read_File_Port(D_OUT, port, file, path, flags, len);
         return R_OUT; }
@@ -141,6 +141,13 @@ static REB_R Transport_Actor(
         case SYM_OPEN: {
             REBVAL *arg = Obj_Value(spec, STD_PORT_SPEC_NET_HOST);
             REBVAL *val = Obj_Value(spec, STD_PORT_SPEC_NET_PORT_ID);
+            REBVAL *size = Obj_Value(spec, STD_PORT_SPEC_NET_BUFFER_SIZE);
+
+            // Optional OS socket buffer size, which also bounds how much
+            // data one READ or WRITE step moves (see %dev-net.c)
+            //
+            if (size && IS_INTEGER(size))
+                sock->special.net.buffer_size = Int32s(size, 1);
 
             if (OS_DO_DEVICE(sock, RDC_OPEN))
                 fail (Error_On_Port(RE_CANNOT_OPEN, port, -12));
@@ -241,20 +248,24 @@ static REB_R Transport_Actor(
             fail (Error_On_Port(RE_NOT_CONNECTED, port, -15));
         }
 
-        // Setup the read buffer (allocate a buffer if needed):
+        // Setup the read buffer (allocate a buffer if needed).  The device
+        // receives straight into its tail, and the amount it takes per call
+        // grows with throughput--so the buffer is kept at least that big.
         //
+        REBCNT want = MAX(NET_BUF_SIZE, sock->special.net.transfer_size);
+
         REBVAL *port_data = CTX_VAR(port, STD_PORT_DATA);
         REBSER *buffer;
         if (!IS_STRING(port_data) && !IS_BINARY(port_data)) {
-            buffer = Make_Binary(NET_BUF_SIZE);
+            buffer = Make_Binary(want);
             Init_Binary(port_data, buffer);
         }
         else {
             buffer = VAL_SERIES(port_data);
             assert(BYTE_SIZE(buffer));
 
-            if (SER_AVAIL(buffer) < NET_BUF_SIZE/2)
-                Extend_Series(buffer, NET_BUF_SIZE);
+            if (SER_AVAIL(buffer) < want / 2)
+                Extend_Series(buffer, want);
         }
 
         sock->length = SER_AVAIL(buffer);
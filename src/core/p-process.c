@@ -0,0 +1,358 @@
+//
+//  File: %p-process.c
+//  Summary: "child process port interface"
+//  Section: ports
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2017 Rebol Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// CALL runs a process to completion (or detaches from it), collecting all of
+// its output in one series.  A process port instead starts the child on
+// OPEN and exchanges data with it incrementally, so many children can be
+// serviced from one WAIT, and output of any size can be handled in pieces:
+//
+//     p: open [scheme: 'process command: "make all"]
+//     p/awake: func [event] [
+//         switch event/type [
+//             read [
+//                 write-stdout to string! event/port/data
+//                 clear event/port/data
+//                 read event/port
+//                 false
+//             ]
+//             close [true] ;-- output finished and the process has exited
+//         ]
+//     ]
+//     read p
+//     wait p
+//     print ["exit code:" (query p)/exit-code]
+//     close p
+//
+// CLOSE returns at once.  A child that doesn't exit on its own once its pipes
+// are closed is sent SIGTERM (and then SIGKILL) during later WAITs.
+//
+// COMMAND is a STRING! for the shell, or a BLOCK! of a program and its
+// arguments (STRING! or FILE!) to run directly.
+//
+// Like the serial port, a port has one request, so a READ issued while a
+// WRITE is still pending replaces it.  Writes that don't fit in the pipe
+// should wait for their WROTE event before reading.
+//
+
+#include "sys-core.h"
+
+#ifdef HAS_PROCESS_PORT
+
+#define PROCESS_READ_SIZE 65536
+
+
+//
+//  Open_Process_Port: C
+//
+static void Open_Process_Port(REBCTX *port, REBREQ *req, REBVAL *spec)
+{
+    REBVAL *command = Obj_Value(spec, STD_PORT_SPEC_PROCESS_COMMAND);
+    REBVAL *merge = Obj_Value(spec, STD_PORT_SPEC_PROCESS_MERGE_ERROR);
+
+    req->special.process.merge_error = LOGICAL(IS_CONDITIONAL_TRUE(merge));
+    req->special.process.command = NULL;
+    req->special.process.argv = NULL;
+
+    // The OS strings only need to live until the child has been started.
+    // (The device is POSIX, where REBCHR is UTF-8 `char`.)
+    //
+    REBSER *cmd_ser = NULL;
+    REBSER *argv_ser = NULL;
+    REBSER *saved_sers = NULL;
+    REBCNT argc = 0;
+    REBCNT i;
+
+    if (IS_STRING(command)) {
+        req->special.process.command = cast(
+            char*, Val_Str_To_OS_Managed(&cmd_ser, command)
+        );
+        PUSH_GUARD_SERIES(cmd_ser);
+    }
+    else if (IS_BLOCK(command)) {
+        argc = VAL_LEN_AT(command);
+        if (argc == 0)
+            fail (Error(RE_INVALID_SPEC, command));
+
+        argv_ser = Make_Series(argc + 1, sizeof(char*), MKS_NONE);
+        saved_sers = Make_Series(argc, sizeof(REBSER*), MKS_NONE);
+        char **argv = SER_HEAD(char*, argv_ser);
+
+        for (i = 0; i < argc; ++i) {
+            RELVAL *arg = VAL_ARRAY_AT_HEAD(command, VAL_INDEX(command) + i);
+            REBSER *ser;
+            if (IS_STRING(arg))
+                argv[i] = cast(char*, Val_Str_To_OS_Managed(&ser, KNOWN(arg)));
+            else if (IS_FILE(arg)) {
+                ser = Value_To_OS_Path(KNOWN(arg), FALSE);
+                MANAGE_SERIES(ser);
+                argv[i] = SER_HEAD(char, ser);
+            }
+            else {
+                // Guards pushed so far must be dropped before failing
+                //
+                while (i != 0)
+                    DROP_GUARD_SERIES(*SER_AT(REBSER*, saved_sers, --i));
+                Free_Series(saved_sers);
+                Free_Series(argv_ser);
+                fail (Error_Invalid_Arg_Core(arg, VAL_SPECIFIER(command)));
+            }
+            PUSH_GUARD_SERIES(ser);
+            *SER_AT(REBSER*, saved_sers, i) = ser;
+        }
+        argv[argc] = NULL;
+        req->special.process.argv = argv;
+    }
+    else
+        fail (Error(RE_INVALID_SPEC, command));
+
+    REBINT result = OS_DO_DEVICE(req, RDC_OPEN);
+
+    if (saved_sers) {
+        for (i = argc; i != 0; --i) // most recently guarded first
+            DROP_GUARD_SERIES(*SER_AT(REBSER*, saved_sers, i - 1));
+        Free_Series(saved_sers);
+        Free_Series(argv_ser);
+    }
+    if (cmd_ser)
+        DROP_GUARD_SERIES(cmd_ser);
+
+    req->special.process.command = NULL;
+    req->special.process.argv = NULL;
+
+    if (result < 0)
+        fail (Error_On_Port(RE_CANNOT_OPEN, port, req->error));
+}
+
+
+//
+//  Ret_Query_Process: C
+//
+static void Ret_Query_Process(REBCTX *port, REBREQ *req, REBVAL *out)
+{
+    REBVAL *std_info = In_Object(port, STD_PORT_SCHEME, STD_SCHEME_INFO, 0);
+    if (!std_info || !IS_OBJECT(std_info))
+        fail (Error_On_Port(RE_INVALID_SPEC, port, -10));
+
+    REBCTX *info = Copy_Context_Shallow(VAL_CONTEXT(std_info));
+
+    SET_INTEGER(CTX_VAR(info, STD_PROCESS_INFO_PID), req->special.process.pid);
+    if (req->special.process.exited)
+        SET_INTEGER(
+            CTX_VAR(info, STD_PROCESS_INFO_EXIT_CODE),
+            req->special.process.exit_code
+        );
+    else
+        SET_BLANK(CTX_VAR(info, STD_PROCESS_INFO_EXIT_CODE));
+
+    Init_Object(out, info);
+}
+
+
+//
+//  Process_Actor: C
+//
+static REB_R Process_Actor(REBFRM *frame_, REBCTX *port, REBSYM action)
+{
+    REBVAL *spec = CTX_VAR(port, STD_PORT_SPEC);
+    if (!IS_OBJECT(spec))
+        fail (Error(RE_INVALID_PORT));
+
+    REBREQ *req = cast(REBREQ*,
+        Use_Port_State(port, RDI_PROCESS, sizeof(REBREQ))
+    );
+
+    *D_OUT = *D_ARG(1);
+
+    if (!IS_OPEN(req)) {
+        switch (action) {
+        case SYM_OPEN:
+            // The request is still in use while the last child is closing
+            //
+            if (GET_FLAG(req->flags, RRF_PENDING))
+                fail (Error_On_Port(RE_CANNOT_OPEN, port, -12));
+            Open_Process_Port(port, req, spec);
+            return R_OUT;
+
+        case SYM_CLOSE:
+            return R_OUT;
+
+        case SYM_OPEN_Q:
+            return R_FALSE;
+
+        case SYM_QUERY:
+            if (req->special.process.pid == 0)
+                return R_BLANK; // never opened
+            Ret_Query_Process(port, req, D_OUT);
+            return R_OUT;
+
+        case SYM_UPDATE: // allowed after a close
+            return R_BLANK;
+
+        default:
+            fail (Error_On_Port(RE_NOT_OPEN, port, -12));
+        }
+    }
+
+    switch (action) {
+    case SYM_READ: {
+        INCLUDE_PARAMS_OF_READ;
+
+        UNUSED(PAR(source));
+        if (REF(part)) {
+            assert(!IS_VOID(ARG(limit)));
+            fail (Error(RE_BAD_REFINES));
+        }
+        if (REF(seek)) {
+            assert(!IS_VOID(ARG(index)));
+            fail (Error(RE_BAD_REFINES));
+        }
+        UNUSED(PAR(string)); // handled in dispatcher
+        UNUSED(PAR(lines)); // handled in dispatcher
+
+        // Output is appended to the port's data buffer, which the awake
+        // handler may consume (e.g. with CLEAR) to keep it small.
+        //
+        REBVAL *data = CTX_VAR(port, STD_PORT_DATA);
+        if (!IS_BINARY(data))
+            Init_Binary(data, Make_Binary(PROCESS_READ_SIZE));
+
+        REBSER *ser = VAL_SERIES(data);
+        if (SER_AVAIL(ser) < PROCESS_READ_SIZE / 2)
+            Extend_Series(ser, PROCESS_READ_SIZE);
+
+        req->common.data = BIN_TAIL(ser);
+        req->length = SER_AVAIL(ser);
+        req->actual = 0;
+
+        if (OS_DO_DEVICE(req, RDC_READ) < 0)
+            fail (Error_On_Port(RE_READ_ERROR, port, req->error));
+
+        *D_OUT = *data;
+        return R_OUT; }
+
+    case SYM_WRITE: {
+        INCLUDE_PARAMS_OF_WRITE;
+
+        UNUSED(PAR(destination));
+        if (REF(seek) || REF(append) || REF(allow) || REF(lines))
+            fail (Error(RE_BAD_REFINES));
+
+        REBVAL *data = ARG(data);
+        if (!IS_BINARY(data))
+            fail (Error_Invalid_Arg(data));
+
+        REBCNT len = VAL_LEN_AT(data);
+        if (REF(part)) {
+            REBCNT n = Int32s(ARG(limit), 0);
+            if (n <= len)
+                len = n;
+        }
+
+        // Keep the data GC safe until the write finishes
+        //
+        *CTX_VAR(port, STD_PORT_DATA) = *data;
+        req->common.data = VAL_BIN_AT(data);
+        req->length = len;
+        req->actual = 0;
+
+        if (OS_DO_DEVICE(req, RDC_WRITE) < 0)
+            fail (Error_On_Port(RE_WRITE_ERROR, port, req->error));
+        return R_OUT; }
+
+    case SYM_UPDATE: {
+        // Update the port object after a READ or WRITE operation.
+        // This is normally called by the WAKE-UP function.
+        //
+        REBVAL *data = CTX_VAR(port, STD_PORT_DATA);
+        if (req->command == RDC_READ) {
+            if (IS_BINARY(data))
+                SET_SERIES_LEN(
+                    VAL_SERIES(data), VAL_LEN_HEAD(data) + req->actual
+                );
+            req->actual = 0; // events may be queued, don't count it twice
+        }
+        else if (req->command == RDC_WRITE)
+            SET_BLANK(data); // write is done
+        return R_BLANK; }
+
+    case SYM_MODIFY: {
+        INCLUDE_PARAMS_OF_MODIFY;
+
+        UNUSED(PAR(target));
+
+        // `modify port 'input _` closes the child's standard input
+        //
+        if (
+            !IS_WORD(ARG(field))
+            || VAL_WORD_SYM(ARG(field)) != SYM_INPUT
+            || !IS_BLANK(ARG(value))
+        ){
+            fail (Error(RE_BAD_REFINES));
+        }
+
+        // Any modify completes at once, detaching a pending read or write
+        // from the device...so reissue that afterward.
+        //
+        REBOOL pending = GET_FLAG(req->flags, RRF_PENDING);
+        REBINT command = req->command;
+
+        OS_DO_DEVICE(req, RDC_MODIFY);
+
+        if (pending && OS_DO_DEVICE(req, command) < 0)
+            fail (Error_On_Port(RE_READ_ERROR, port, req->error));
+        return R_TRUE; }
+
+    case SYM_QUERY:
+        Ret_Query_Process(port, req, D_OUT);
+        return R_OUT;
+
+    case SYM_OPEN_Q:
+        return R_TRUE;
+
+    case SYM_CLOSE:
+        OS_DO_DEVICE(req, RDC_CLOSE);
+        return R_OUT;
+
+    case SYM_OPEN:
+        fail (Error(RE_ALREADY_OPEN, D_ARG(1)));
+
+    default:
+        fail (Error_Illegal_Action(REB_PORT, action));
+    }
+}
+
+
+//
+//  Init_Process_Scheme: C
+//
+void Init_Process_Scheme(void)
+{
+    Register_Scheme(Canon(SYM_PROCESS), Process_Actor);
+}
+
+#endif // HAS_PROCESS_PORT
@@ -193,7 +193,7 @@ static REB_R Serial_Actor(REBFRM *frame_, REBCTX *port, REBSYM action)
         //if (SER_LEN(ser) == 0)
         req->actual = 0;  // Actual for THIS read, not for total.
 #ifdef DEBUG_SERIAL
-        printf("(max read length %d)", req->length);
+        printf("(max read length %d)", cast(int, req->length));
 #endif
         result = OS_DO_DEVICE(req, RDC_READ); // recv can happen immediately
         if (result < 0) fail (Error_On_Port(RE_READ_ERROR, port, req->error));
@@ -40,7 +40,7 @@
 #define PRZCRC   0x864cfb   /* PRZ's 24-bit CRC generator polynomial */
 #define CRCINIT  0xB704CE   /* Init value for CRC accumulator */
 
-static REBCNT *CRC_Table;
+static THREAD_LOCAL REBCNT *CRC_Table;
 
 //
 //  Generate_CRC: C
@@ -169,7 +169,7 @@ REBINT Hash_Word(const REBYTE *str, REBCNT len)
     return hash;
 }
 
-static u32 *crc32_table = 0;
+static THREAD_LOCAL u32 *crc32_table = 0;
 
 static void Make_CRC32_Table(void);
 
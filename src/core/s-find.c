@@ -42,9 +42,9 @@
 //
 REBINT Compare_Binary_Vals(const RELVAL *v1, const RELVAL *v2)
 {
-    REBCNT l1 = VAL_LEN_AT(v1);
-    REBCNT l2 = VAL_LEN_AT(v2);
-    REBCNT len = MIN(l1, l2);
+    REBLEN l1 = VAL_LEN_AT(v1);
+    REBLEN l2 = VAL_LEN_AT(v2);
+    REBLEN len = MIN(l1, l2);
     REBINT n;
 
     if (IS_IMAGE(v1)) len *= 4;
@@ -61,7 +61,7 @@ REBINT Compare_Binary_Vals(const RELVAL *v1, const RELVAL *v2)
 
     if (n != 0) return n;
 
-    return l1 - l2;
+    return (l1 > l2) ? 1 : (l1 < l2) ? -1 : 0; // difference may not fit
 }
 
 
@@ -72,7 +72,7 @@ REBINT Compare_Binary_Vals(const RELVAL *v1, const RELVAL *v2)
 //
 // Uncase: compare is case-insensitive.
 //
-REBINT Compare_Bytes(const REBYTE *b1, const REBYTE *b2, REBCNT len, REBOOL uncase)
+REBINT Compare_Bytes(const REBYTE *b1, const REBYTE *b2, REBLEN len, REBOOL uncase)
 {
     REBINT d;
 
@@ -154,7 +154,7 @@ REBOOL Match_Sub_Path(REBSER *s1, REBSER *s2)
 //
 // Uncase: compare is case-insensitive.
 //
-REBINT Compare_Uni_Byte(REBUNI *u1, REBYTE *b2, REBCNT len, REBOOL uncase)
+REBINT Compare_Uni_Byte(REBUNI *u1, REBYTE *b2, REBLEN len, REBOOL uncase)
 {
     REBINT d;
     REBUNI c1;
@@ -184,7 +184,7 @@ REBINT Compare_Uni_Byte(REBUNI *u1, REBYTE *b2, REBCNT len, REBOOL uncase)
 //
 // Uncase: compare is case-insensitive.
 //
-REBINT Compare_Uni_Str(REBUNI *u1, REBUNI *u2, REBCNT len, REBOOL uncase)
+REBINT Compare_Uni_Str(REBUNI *u1, REBUNI *u2, REBLEN len, REBOOL uncase)
 {
     REBINT d;
     REBUNI c1;
@@ -218,9 +218,9 @@ REBINT Compare_Uni_Str(REBUNI *u1, REBUNI *u2, REBCNT len, REBOOL uncase)
 //
 REBINT Compare_String_Vals(const RELVAL *v1, const RELVAL *v2, REBOOL uncase)
 {
-    REBCNT l1  = VAL_LEN_AT(v1);
-    REBCNT l2  = VAL_LEN_AT(v2);
-    REBCNT len = MIN(l1, l2);
+    REBLEN l1  = VAL_LEN_AT(v1);
+    REBLEN l2  = VAL_LEN_AT(v2);
+    REBLEN len = MIN(l1, l2);
     REBINT n;
 
     if (IS_BINARY(v1) || IS_BINARY(v2)) uncase = FALSE;
@@ -239,7 +239,7 @@ REBINT Compare_String_Vals(const RELVAL *v1, const RELVAL *v2, REBOOL uncase)
     }
 
     if (n != 0) return n;
-    return l1 - l2;
+    return (l1 > l2) ? 1 : (l1 < l2) ? -1 : 0; // difference may not fit
 }
 
 
@@ -306,13 +306,13 @@ REBINT Compare_UTF8(const REBYTE *s1, const REBYTE *s2, REBCNT l2)
 //
 // NOTE: Series tail must be > index.
 //
-REBCNT Find_Byte_Str(REBSER *series, REBCNT index, REBYTE *b2, REBCNT l2, REBOOL uncase, REBOOL match)
+REBLEN Find_Byte_Str(REBSER *series, REBLEN index, REBYTE *b2, REBLEN l2, REBOOL uncase, REBOOL match)
 {
     REBYTE *b1;
     REBYTE *e1;
-    REBCNT l1;
+    REBLEN l1;
     REBYTE c;
-    REBCNT n;
+    REBLEN n;
 
     // The pattern empty or is longer than the target:
     if (l2 == 0 || (l2 + index) > SER_LEN(series)) return NOT_FOUND;
@@ -367,12 +367,12 @@ REBCNT Find_Byte_Str(REBSER *series, REBCNT index, REBYTE *b2, REBCNT l2, REBOOL
 //
 // Flags are set according to ALL_FIND_REFS
 //
-REBCNT Find_Str_Str(REBSER *ser1, REBCNT head, REBCNT index, REBCNT tail, REBINT skip, REBSER *ser2, REBCNT index2, REBCNT len, REBCNT flags)
+REBLEN Find_Str_Str(REBSER *ser1, REBLEN head, REBLEN index, REBLEN tail, REBINT skip, REBSER *ser2, REBLEN index2, REBLEN len, REBCNT flags)
 {
     REBUNI c1;
     REBUNI c2;
     REBUNI c3;
-    REBCNT n = 0;
+    REBLEN n = 0;
     REBOOL uncase = NOT(flags & AM_FIND_CASE); // case insenstive
 
     c2 = GET_ANY_CHAR(ser2, index2); // starting char
@@ -420,11 +420,11 @@ REBCNT Find_Str_Str(REBSER *ser1, REBCNT head, REBCNT index, REBCNT tail, REBINT
 // index is unsigned and it tries to use a comparison crossing zero.  This
 // is handled by the new version, and will be vetted separately.
 //
-static REBCNT Find_Str_Char_Old(
+static REBLEN Find_Str_Char_Old(
     REBSER *ser,
-    REBCNT head,
-    REBCNT index,
-    REBCNT tail,
+    REBLEN head,
+    REBLEN index,
+    REBLEN tail,
     REBINT skip,
     REBUNI c2,
     REBCNT flags
@@ -471,20 +471,21 @@ static REBCNT Find_Str_Char_Old(
 // routine is run in parallel as a debug check to ensure the same result
 // is coming from the optimized code.
 //
-REBCNT Find_Str_Char(
+REBLEN Find_Str_Char(
     REBUNI uni,         // character to look for
     REBSER *series,     // series with width sizeof(REBYTE) or sizeof(REBUNI)
-    REBCNT lowest,      // lowest return index
-    REBCNT index_orig,  // first index to examine (if out of range, NOT_FOUND)
-    REBCNT highest,     // *one past* highest return result (e.g. SER_LEN)
+    REBLEN lowest,      // lowest return index
+    REBLEN index_orig,  // first index to examine (if out of range, NOT_FOUND)
+    REBLEN highest,     // *one past* highest return result (e.g. SER_LEN)
     REBINT skip,        // step amount while searching, can be negative!
     REBFLGS flags       // AM_FIND_CASE, AM_FIND_MATCH
 ) {
     // Because the skip may be negative, and we don't check before we step
     // and may "cross zero", it's necessary to use a signed index to be
-    // able to notice that crossing.
+    // able to notice that crossing.  (64-bit so that REB_LARGE_SERIES
+    // indices fit.)
     //
-    REBINT index;
+    REBI64 index;
 
     // We establish an array of two potential cases we are looking for.
     // If there aren't actually two, this array sets both to be the same (vs.
@@ -519,7 +520,7 @@ REBCNT Find_Str_Char(
 
     // Past this point we'll be using the signed index.
     //
-    index = cast(REBINT, index_orig);
+    index = cast(REBI64, index_orig);
 
     // /MATCH only does one check at the current position for the character
     // and then returns.  It basically subverts any optimization we might
@@ -610,7 +611,7 @@ REBCNT Find_Str_Char(
                     index += strcspn(
                         cast(char*, bp + index), cast(char*, breakset)
                     );
-                    if (index >= cast(REBINT, highest))
+                    if (index >= cast(REBI64, highest))
                         goto return_not_found;
 
                     goto return_index;
@@ -626,8 +627,8 @@ REBCNT Find_Str_Char(
                         goto return_index;
 
                     index += skip;
-                    if (index < cast(REBINT, lowest)) break;
-                    if (index >= cast(REBINT, highest)) break;
+                    if (index < cast(REBI64, lowest)) break;
+                    if (index >= cast(REBI64, highest)) break;
                 }
             }
         }
@@ -647,8 +648,8 @@ REBCNT Find_Str_Char(
                 goto return_index;
 
             index += skip;
-            if (index < cast(REBINT, lowest)) break;
-            if (index >= cast(REBINT, highest)) break;
+            if (index < cast(REBI64, lowest)) break;
+            if (index >= cast(REBI64, highest)) break;
         }
     }
 
@@ -664,13 +665,13 @@ return_not_found:
 return_index:
 
 #if !defined(NDEBUG)
-    assert(cast(REBCNT, index) == Find_Str_Char_Old(
+    assert(cast(REBLEN, index) == Find_Str_Char_Old(
         series, lowest, index_orig, highest, skip, uni, flags
     ));
 #endif
 
     assert(index >= 0);
-    return cast(REBCNT, index);
+    return cast(REBLEN, index);
 }
 
 
@@ -686,11 +687,11 @@ return_index:
 //
 // Flags are set according to ALL_FIND_REFS
 //
-REBCNT Find_Str_Bitset(
+REBLEN Find_Str_Bitset(
     REBSER *ser,
-    REBCNT head,
-    REBCNT index,
-    REBCNT tail,
+    REBLEN head,
+    REBLEN index,
+    REBLEN tail,
     REBINT skip,
     REBSER *bset,
     REBCNT flags
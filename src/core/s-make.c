@@ -37,7 +37,7 @@
 // Make a binary string series. For byte, C, and UTF8 strings.
 // Add 1 extra for terminator.
 //
-REBSER *Make_Binary(REBCNT length)
+REBSER *Make_Binary(REBLEN length)
 {
     REBSER *series = Make_Series(length + 1, sizeof(REBYTE), MKS_NONE);
 
@@ -58,7 +58,7 @@ REBSER *Make_Binary(REBCNT length)
 // Make a unicode string series. Used for internal strings.
 // Add 1 extra for terminator.
 //
-REBSER *Make_Unicode(REBCNT length)
+REBSER *Make_Unicode(REBLEN length)
 {
     REBSER *series = Make_Series(length + 1, sizeof(REBUNI), MKS_NONE);
 
@@ -185,15 +185,15 @@ void Insert_Char(REBSER *dst, REBCNT index, REBCNT chr)
 //
 void Insert_String(
     REBSER *dst,
-    REBCNT idx,
+    REBLEN idx,
     REBSER *src,
-    REBCNT pos,
-    REBCNT len,
+    REBLEN pos,
+    REBLEN len,
     REBOOL no_expand
 ) {
     REBUNI *up;
     REBYTE *bp;
-    REBCNT n;
+    REBLEN n;
 
     assert(idx <= SER_LEN(dst));
 
@@ -243,7 +243,7 @@ cp_same:
 // see if they could fit in a byte-size series.  The string will be
 // "slimmed" if possible.
 //
-REBSER *Copy_String_Slimming(REBSER *src, REBCNT index, REBINT length)
+REBSER *Copy_String_Slimming(REBSER *src, REBLEN index, REBI64 length)
 {
     REBYTE wide = 1;
 
@@ -254,7 +254,7 @@ REBSER *Copy_String_Slimming(REBSER *src, REBCNT index, REBINT length)
     if (!BYTE_SIZE(src)) {
         REBUNI *up = UNI_AT(src, index);
 
-        REBINT n;
+        REBI64 n;
         for (n = 0; n < length; n++)
             if (up[n] > 0xff)
                 break;
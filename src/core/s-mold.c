@@ -48,11 +48,11 @@ enum REB_Punct {
     PUNCT_MAX
 };
 
-REBYTE *Char_Escapes;
+THREAD_LOCAL REBYTE *Char_Escapes;
 #define MAX_ESC_CHAR (0x60-1) // size of escape table
 #define IS_CHR_ESC(c) ((c) <= MAX_ESC_CHAR && Char_Escapes[c])
 
-REBYTE *URL_Escapes;
+THREAD_LOCAL REBYTE *URL_Escapes;
 #define MAX_URL_CHAR (0x80-1)
 #define IS_URL_ESC(c)  ((c) <= MAX_URL_CHAR && (URL_Escapes[c] & ESC_URL))
 #define IS_FILE_ESC(c) ((c) <= MAX_URL_CHAR && (URL_Escapes[c] & ESC_FILE))
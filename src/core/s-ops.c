@@ -704,8 +704,8 @@ REBSER *Detab_Unicode(REBUNI *bp, REBCNT index, REBCNT len, REBINT tabsize)
 //
 void Change_Case(REBVAL *out, REBVAL *val, REBVAL *part, REBOOL upper)
 {
-    REBCNT len;
-    REBCNT n;
+    REBLEN len;
+    REBLEN n;
 
     *out = *val;
 
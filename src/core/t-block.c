@@ -247,10 +247,10 @@ void TO_Array(REBVAL *out, enum Reb_Kind kind, const REBVAL *arg) {
 // match - sequence
 // SELECT - (value that follows)
 //
-REBCNT Find_In_Array(
+REBLEN Find_In_Array(
     REBARR *array,
-    REBCNT index,
-    REBCNT end,
+    REBLEN index,
+    REBLEN end,
     const RELVAL *target,
     REBCNT len,
     REBFLGS flags,
@@ -259,7 +259,7 @@ REBCNT Find_In_Array(
     RELVAL *value;
     RELVAL *val;
     REBCNT cnt;
-    REBCNT start = index;
+    REBLEN start = index;
 
     if (flags & (AM_FIND_REVERSE | AM_FIND_LAST)) {
         skip = -1;
@@ -454,7 +454,7 @@ static void Sort_Block(
     }
 
     // Determine length of sort:
-    REBCNT len;
+    REBLEN len;
     Partial1(block, part, &len);
     if (len <= 1)
         return;
@@ -484,9 +484,9 @@ static void Sort_Block(
 //
 void Shuffle_Block(REBVAL *value, REBOOL secure)
 {
-    REBCNT n;
-    REBCNT k;
-    REBCNT idx = VAL_INDEX(value);
+    REBLEN n;
+    REBLEN k;
+    REBLEN idx = VAL_INDEX(value);
     RELVAL *data = VAL_ARRAY_HEAD(value);
 
     // Rare case where RELVAL bit copying is okay...between spots in the
@@ -495,7 +495,7 @@ void Shuffle_Block(REBVAL *value, REBOOL secure)
     RELVAL swap;
 
     for (n = VAL_LEN_AT(value); n > 1;) {
-        k = idx + (REBCNT)Random_Int(secure) % n;
+        k = idx + cast(REBLEN, Random_Int(secure)) % n;
         n--;
         swap = data[k];
         data[k] = data[n + idx];
@@ -530,12 +530,12 @@ REBINT PD_Array(REBPVS *pvs)
         n = Int32(pvs->selector) + VAL_INDEX(pvs->value) - 1;
     }
     else if (IS_WORD(pvs->selector)) {
-        n = Find_Word_In_Array(
+        REBLEN i = Find_Word_In_Array(
             VAL_ARRAY(pvs->value),
             VAL_INDEX(pvs->value),
             VAL_WORD_CANON(pvs->selector)
         );
-        if (cast(REBCNT, n) != NOT_FOUND) n++;
+        n = (i == NOT_FOUND) ? -1 : cast(REBINT, i) + 1;
     }
     else {
         // other values:
@@ -623,7 +623,7 @@ REBTYPE(Array)
     // NOTE: Partial1() used below can mutate VAL_INDEX(value), be aware :-/
     //
     REBARR *array = VAL_ARRAY(value);
-    REBCNT index = VAL_INDEX(value);
+    REBLEN index = VAL_INDEX(value);
     REBSPC *specifier = VAL_SPECIFIER(value);
 
     switch (action) {
@@ -657,11 +657,12 @@ REBTYPE(Array)
         if (REF(deep))
             fail (Error(RE_BAD_REFINES));
 
-        REBCNT len;
+        REBLEN len;
 
         FAIL_IF_READ_ONLY_ARRAY(array);
 
         if (REF(part)) {
+            FAIL_IF_LARGE_SERIES(AS_SERIES(array)); // copy takes REBCNT
             Partial1(value, ARG(limit), &len);
             if (len == 0)
                 goto return_empty_block;
@@ -705,7 +706,7 @@ REBTYPE(Array)
 
         REBINT len = ANY_ARRAY(arg) ? VAL_ARRAY_LEN_AT(arg) : 1;
 
-        REBCNT limit;
+        REBLEN limit;
         if (REF(part))
             Partial1(value, ARG(limit), &limit);
         else
@@ -721,7 +722,7 @@ REBTYPE(Array)
 
         REBCNT skip = REF(skip) ? Int32s(ARG(size), 1) : 1;
 
-        REBCNT ret = Find_In_Array(
+        REBLEN ret = Find_In_Array(
             array, index, limit, arg, len, flags, skip
         );
 
@@ -761,9 +762,13 @@ REBTYPE(Array)
         UNUSED(PAR(series));
         UNUSED(PAR(value));
 
+        FAIL_IF_LARGE_SERIES(AS_SERIES(array)); // Modify_Array() is REBCNT
+        if (ANY_ARRAY(arg))
+            FAIL_IF_LARGE_SERIES(VAL_SERIES(arg));
+
         // Length of target (may modify index): (arg can be anything)
         //
-        REBCNT len;
+        REBLEN len;
         Partial1(
             (action == SYM_CHANGE)
                 ? value
@@ -801,7 +806,7 @@ REBTYPE(Array)
             if (index == 0) Reset_Array(array);
             else {
                 SET_END(ARR_AT(array, index));
-                SET_SERIES_LEN(VAL_SERIES(value), cast(REBCNT, index));
+                SET_SERIES_LEN(VAL_SERIES(value), index);
             }
         }
         *D_OUT = *value;
@@ -815,8 +820,10 @@ REBTYPE(Array)
 
         UNUSED(PAR(value));
 
+        FAIL_IF_LARGE_SERIES(AS_SERIES(array)); // copy takes REBCNT
+
         REBU64 types = 0;
-        REBCNT tail = 0;
+        REBLEN tail = 0;
         index = VAL_INDEX(value);
 
         UNUSED(REF(part));
@@ -863,6 +870,8 @@ REBTYPE(Array)
             fail (Error(RE_BAD_REFINES));
         }
 
+        FAIL_IF_LARGE_SERIES(AS_SERIES(array)); // `end` is a REBINT
+
         RELVAL *head = ARR_HEAD(array);
         REBCNT out = index;
         REBINT end = ARR_LEN(array);
@@ -924,7 +933,7 @@ REBTYPE(Array)
     }
 
     case SYM_REVERSE: {
-        REBCNT len;
+        REBLEN len;
         Partial1(value, D_ARG(3), &len);
 
         FAIL_IF_READ_ONLY_ARRAY(array);
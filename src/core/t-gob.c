@@ -125,7 +125,7 @@ static REBOOL Set_Pair(REBXYF *pair, const REBVAL *val)
 // Find a target GOB within the pane of another gob.
 // Return the index, or a -1 if not found.
 //
-static REBCNT Find_Gob(REBGOB *gob, REBGOB *target)
+static REBLEN Find_Gob(REBGOB *gob, REBGOB *target)
 {
     REBCNT len;
     REBCNT n;
@@ -150,7 +150,7 @@ static REBCNT Find_Gob(REBGOB *gob, REBGOB *target)
 static void Detach_Gob(REBGOB *gob)
 {
     REBGOB *par;
-    REBCNT i;
+    REBLEN i;
 
     par = GOB_PARENT(gob);
     if (par && GOB_PANE(par) && (i = Find_Gob(par, gob)) != NOT_FOUND) {
@@ -1144,8 +1144,9 @@ REBTYPE(Gob)
 
     case SYM_FIND:
         if (IS_GOB(arg)) {
-            index = Find_Gob(gob, VAL_GOB(arg));
-            if (index == NOT_FOUND) goto is_blank;
+            REBLEN found = Find_Gob(gob, VAL_GOB(arg));
+            if (found == NOT_FOUND) goto is_blank;
+            index = cast(REBCNT, found);
             goto set_index;
         }
         goto is_blank;
@@ -28,13 +28,6 @@
 //=////////////////////////////////////////////////////////////////////////=//
 //
 
-// lodepng uses the C++ iostream fail, but in the standard namespace, which
-// interferes with Ren-C's definition of the fail() macro.  It has to be
-// included before %sys-core.h.  See REBNATIVE(to_png) below for the only
-// usage of lodepng (added by Saphirion, due to bugs in the existing PNG code)
-//
-#include "png/lodepng.h"
-
 #include "sys-core.h"
 
 #define CLEAR_IMAGE(p, x, y) memset(p, 0, x * y * sizeof(u32))
@@ -1407,19 +1400,19 @@ REBINT PD_Image(REBPVS *pvs)
 }
 
 
-// !!! This didn't really have anywhere to go.  It came from %host-core.c,
-// and it's not part of the historical PNG code, but apparently Saphirion
-// found a problem with that in terms of saving (saving only?) which they
-// added in lodepng for.  This is unfortunate as lodepng repeats deflate
-// code already available in Zlib.
-
 //
 //  to-png: native [
 //
 //  "Save an image to PNG format"
 //
 //      image [image!]
-// ]
+//      /level
+//      lvl [integer!]
+//          "0 (store only) to 9 (smallest), -1 is the default (6)"
+//      /parallel
+//      workers [integer!]
+//          "Filter and deflate rows on this many threads (same output for any)"
+//  ]
 //
 REBNATIVE(to_png)
 {
@@ -1427,47 +1420,85 @@ REBNATIVE(to_png)
 
     REBVAL *image = ARG(image);
 
-    LodePNGState state;
-    lodepng_state_init(&state);
+    REBINT w = VAL_IMAGE_WIDE(image);
+    REBINT h = VAL_IMAGE_HIGH(image);
+    if (w == 0 || h == 0)
+        fail (Error_Invalid_Arg(image)); // PNG has no empty images
 
-    // "disable autopilot"
-    state.encoder.auto_convert = LAC_NO;
+    Init_Binary(D_OUT, Encode_PNG(
+        VAL_IMAGE_BITS(image),
+        w,
+        h,
+        Image_Has_Alpha(image),
+        REF(level) ? Int32(ARG(lvl)) : -1,
+        REF(parallel) ? Int32(ARG(workers)) : 1
+    ));
+    return R_OUT;
+}
 
-    // input format
-    state.info_raw.colortype = LCT_RGBA;
-    state.info_raw.bitdepth = 8;
 
-    // output format
-    state.info_png.color.colortype = LCT_RGBA;
-    state.info_png.color.bitdepth = 8;
+//
+//  decode-png-open: native [
+//
+//  {Start decoding a PNG whose data arrives in pieces (e.g. from a port).}
+//
+//      return: [handle!]
+//          "Feed it with DECODE-PNG-UPDATE, end it with DECODE-PNG-CLOSE"
+//  ]
+//
+REBNATIVE(decode_png_open)
+{
+    INCLUDE_PARAMS_OF_DECODE_PNG_OPEN;
 
-    size_t buffersize;
-    REBYTE *buffer = NULL;
+    Init_PNG_Stream(D_OUT);
+    return R_OUT;
+}
 
-    REBINT w = VAL_IMAGE_WIDE(image);
-    REBINT h = VAL_IMAGE_HIGH(image);
 
-    unsigned error = lodepng_encode(
-        &buffer, // freed with free()...so must be allocated via malloc() ?
-        &buffersize,
-        SER_DATA_RAW(VAL_SERIES(image)),
-        w,
-        h,
-        &state
+//
+//  decode-png-update: native [
+//
+//  {Decode more of a PNG, returning any rows that are complete.}
+//
+//      return: [image! blank!]
+//          {Full width image of just the new rows (interlaced PNGs give all
+//          rows at once, when the last pass is done)}
+//      stream [handle!]
+//          "From DECODE-PNG-OPEN"
+//      data [binary!]
+//          "Next part of the file (can split anywhere)"
+//  ]
+//
+REBNATIVE(decode_png_update)
+{
+    INCLUDE_PARAMS_OF_DECODE_PNG_UPDATE;
+
+    PNG_Stream_Update(
+        D_OUT,
+        ARG(stream),
+        VAL_BIN_AT(ARG(data)),
+        VAL_LEN_AT(ARG(data)),
+        FALSE
     );
+    return R_OUT;
+}
 
-    lodepng_state_cleanup(&state);
-
-    if (error != 0) {
-        if (buffer != NULL) free(buffer);
-        return R_BLANK;
-    }
 
-    REBSER *binary = Make_Binary(buffersize);
-    memcpy(SER_DATA_RAW(binary), buffer, buffersize);
-    SET_SERIES_LEN(binary, buffersize);
-    free(buffer);
+//
+//  decode-png-close: native [
+//
+//  {Finish decoding a PNG, failing if the data was incomplete.}
+//
+//      return: [image! blank!]
+//          "Always blank, as rows are returned as soon as they are ready"
+//      stream [handle!]
+//          "From DECODE-PNG-OPEN"
+//  ]
+//
+REBNATIVE(decode_png_close)
+{
+    INCLUDE_PARAMS_OF_DECODE_PNG_CLOSE;
 
-    Init_Binary(D_OUT, binary);
+    PNG_Stream_Update(D_OUT, ARG(stream), NULL, 0, TRUE);
     return R_OUT;
 }
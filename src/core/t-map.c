@@ -582,7 +582,7 @@ REBTYPE(Map)
     REBVAL *arg = D_ARGC > 1 ? D_ARG(2) : NULL;
     REBINT n;
     REBMAP *map = VAL_MAP(val);
-    REBCNT tail;
+    REBLEN tail;
 
     switch (action) {
 
@@ -562,6 +562,11 @@ REBNATIVE(set_meta)
         AS_SERIES(VAL_FUNC_PARAMLIST(value))->link.meta = meta;
     else {
         assert(ANY_CONTEXT(value));
+
+        // The keylist holding the meta may be shared by other objects of
+        // the same shape, so this object needs its own.
+        //
+        Ensure_Keylist_Unique_Invalidated(VAL_CONTEXT(value));
         INIT_CONTEXT_META(VAL_CONTEXT(value), meta);
     }
 
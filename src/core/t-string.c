@@ -55,7 +55,7 @@ REBINT CT_String(const RELVAL *a, const RELVAL *b, REBINT mode)
 ***********************************************************************/
 
 // !!! "STRING value to CHAR value (save some code space)" <-- what?
-static void str_to_char(REBVAL *out, REBVAL *val, REBCNT idx)
+static void str_to_char(REBVAL *out, REBVAL *val, REBLEN idx)
 {
     // Note: out may equal val, do assignment in two steps
     REBUNI codepoint = GET_ANY_CHAR(VAL_SERIES(val), idx);
@@ -81,10 +81,10 @@ static void swap_chars(REBVAL *val1, REBVAL *val2)
 }
 
 
-static void reverse_string(REBVAL *value, REBCNT len)
+static void reverse_string(REBVAL *value, REBLEN len)
 {
-    REBCNT n;
-    REBCNT m;
+    REBLEN n;
+    REBLEN m;
     REBUNI c;
 
     if (VAL_BYTE_SIZE(value)) {
@@ -108,12 +108,12 @@ static void reverse_string(REBVAL *value, REBCNT len)
 }
 
 
-static REBCNT find_string(
+static REBLEN find_string(
     REBSER *series,
-    REBCNT index,
-    REBCNT end,
+    REBLEN index,
+    REBLEN end,
     REBVAL *target,
-    REBCNT target_len,
+    REBLEN target_len,
     REBCNT flags,
     REBINT skip
 ) {
@@ -122,7 +122,7 @@ static REBCNT find_string(
     if (target_len > end - index) // series not long enough to have target
         return NOT_FOUND;
 
-    REBCNT start = index;
+    REBLEN start = index;
 
     if (flags & (AM_FIND_REVERSE | AM_FIND_LAST)) {
         skip = -1;
@@ -276,6 +276,19 @@ static REBSER *Make_Binary_BE64(const REBVAL *arg)
 }
 
 
+// The capacity given to MAKE BINARY! or MAKE STRING!, which may be past 4GB
+// in REB_LARGE_SERIES builds.  Checked here before it is narrowed to REBLEN,
+// so an oversized request fails instead of allocating a truncated size.
+//
+static REBLEN Make_Size_From_Arg(const REBVAL *arg)
+{
+    REBI64 size = Int64s(arg, 0);
+    if (cast(REBU64, size) >= MAX_SERIES_BYTES)
+        fail (Error_No_Memory(cast(REBU64, size)));
+    return cast(REBLEN, size);
+}
+
+
 static REBSER *make_binary(const REBVAL *arg, REBOOL make)
 {
     REBSER *ser;
@@ -284,7 +297,7 @@ static REBSER *make_binary(const REBVAL *arg, REBOOL make)
     switch (VAL_TYPE(arg)) {
     case REB_INTEGER:
     case REB_DECIMAL:
-        if (make) ser = Make_Binary(Int32s(arg, 0));
+        if (make) ser = Make_Binary(Make_Size_From_Arg(arg));
         else ser = Make_Binary_BE64(arg);
         break;
 
@@ -354,7 +367,7 @@ void MAKE_String(REBVAL *out, enum Reb_Kind kind, const REBVAL *def) {
         // !!! R3-Alpha tolerated decimal, e.g. `make string! 3.14`, which
         // is semantically nebulous (round up, down?) and generally bad.
         //
-        ser = Make_Binary(Int32s(def, 0));
+        ser = Make_Binary(Make_Size_From_Arg(def));
         Init_Any_Series(out, kind, ser);
         return;
     }
@@ -749,9 +762,9 @@ REBTYPE(String)
 {
     REBVAL  *value = D_ARG(1);
     REBVAL  *arg = D_ARGC > 1 ? D_ARG(2) : NULL;
-    REBINT  index;
-    REBINT  tail;
-    REBINT  len;
+    REBI64  index;
+    REBI64  tail;
+    REBI64  len;
     REBSER  *ser;
     enum Reb_Kind type;
 
@@ -763,8 +776,8 @@ REBTYPE(String)
     }
 
     // Common setup code for all actions:
-    index = cast(REBINT, VAL_INDEX(value));
-    tail = cast(REBINT, VAL_LEN_HEAD(value));
+    index = cast(REBI64, VAL_INDEX(value));
+    tail = cast(REBI64, VAL_LEN_HEAD(value));
 
     switch (action) {
 
@@ -783,7 +796,9 @@ REBTYPE(String)
             // !!! Doesn't pay attention...all string appends are /ONLY
         }
 
-        Partial1((action == SYM_CHANGE) ? value : arg, ARG(limit), cast(REBCNT*, &len));
+        REBLEN span;
+        Partial1((action == SYM_CHANGE) ? value : arg, ARG(limit), &span);
+        len = span;
         index = VAL_INDEX(value);
 
         REBFLGS flags = 0;
@@ -856,15 +871,15 @@ REBTYPE(String)
 
         REBCNT skip;
         if (REF(skip))
-            skip = Partial(value, 0, ARG(size));
+            skip = cast(REBCNT, Partial(value, 0, ARG(size)));
         else
             skip = 1;
 
-        REBCNT ret = find_string(
+        REBLEN ret = find_string(
             VAL_SERIES(value), index, tail, arg, len, flags, skip
         );
 
-        if (ret >= (REBCNT)tail)
+        if (ret >= cast(REBLEN, tail))
             return R_BLANK;
 
         if (REF(only))
@@ -877,7 +892,7 @@ REBTYPE(String)
         }
         else {
             ret++;
-            if (ret >= (REBCNT)tail) return R_BLANK;
+            if (ret >= cast(REBLEN, tail)) return R_BLANK;
             if (IS_BINARY(value)) {
                 SET_INTEGER(value, *BIN_AT(VAL_SERIES(value), ret));
             }
@@ -890,10 +905,13 @@ REBTYPE(String)
     case SYM_POKE:
         FAIL_IF_READ_ONLY_SERIES(VAL_SERIES(value));
     case SYM_PICK:
-        len = Get_Num_From_Arg(arg); // Position
+        if (IS_INTEGER(arg))
+            len = VAL_INT64(arg); // Position, may be past 32 bits
+        else
+            len = Get_Num_From_Arg(arg);
         //if (len > 0) index--;
-        if (REB_I32_SUB_OF(len, 1, &len)
-            || REB_I32_ADD_OF(index, len, &index)
+        if (REB_I64_SUB_OF(len, 1, &len)
+            || REB_I64_ADD_OF(index, len, &index)
             || index < 0 || index >= tail) {
             if (action == SYM_PICK) return R_BLANK;
             fail (Error_Out_Of_Range(arg));
@@ -991,7 +1009,7 @@ pick_it:
             if (index == 0)
                 Reset_Sequence(VAL_SERIES(value));
             else
-                TERM_SEQUENCE_LEN(VAL_SERIES(value), cast(REBCNT, index));
+                TERM_SEQUENCE_LEN(VAL_SERIES(value), cast(REBLEN, index));
         }
         break;
 
@@ -1021,6 +1039,9 @@ pick_it:
     case SYM_XOR_T:
         if (!IS_BINARY(arg)) fail (Error_Invalid_Arg(arg));
 
+        FAIL_IF_LARGE_SERIES(VAL_SERIES(value)); // Xandor_Binary() is REBCNT
+        FAIL_IF_LARGE_SERIES(VAL_SERIES(arg));
+
         if (VAL_INDEX(value) > VAL_LEN_HEAD(value))
             VAL_INDEX(value) = VAL_LEN_HEAD(value);
 
@@ -1032,6 +1053,7 @@ pick_it:
 
     case SYM_COMPLEMENT:
         if (!IS_BINARY(value)) fail (Error_Invalid_Arg(value));
+        FAIL_IF_LARGE_SERIES(VAL_SERIES(value));
         ser = Complement_Binary(value);
         goto ser_exit;
 
@@ -1044,6 +1066,7 @@ pick_it:
         UNUSED(PAR(series));
 
         ser = VAL_SERIES(value);
+        FAIL_IF_LARGE_SERIES(ser); // trim routines take REBCNT positions
 
         if (REF(all) || REF(with)) {
             if (REF(head) || REF(tail) || REF(lines) || REF(auto))
@@ -1094,6 +1117,7 @@ pick_it:
         INCLUDE_PARAMS_OF_SORT;
 
         FAIL_IF_READ_ONLY_SERIES(VAL_SERIES(value));
+        FAIL_IF_LARGE_SERIES(VAL_SERIES(value)); // Sort_String() is REBCNT
 
         UNUSED(PAR(series));
         UNUSED(REF(skip));
@@ -1140,9 +1164,12 @@ pick_it:
 
         if (REF(only)) {
             if (index >= tail) return R_BLANK;
-            index += (REBCNT)Random_Int(REF(secure)) % (tail - index);
+            index += cast(REBI64,
+                cast(REBU64, Random_Int(REF(secure))) % (tail - index)
+            );
             goto pick_it;
         }
+        FAIL_IF_LARGE_SERIES(VAL_SERIES(value)); // Shuffle_String() too
         Shuffle_String(value, REF(secure));
         break; }
 
@@ -0,0 +1,369 @@
+//
+//  File: %u-blake2.c
+//  Summary: "BLAKE2b and BLAKE2s hash functions (RFC 7693)"
+//  Section: utility
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2017 Rebol Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// BLAKE2b (64-bit words, up to 64 byte digests) is faster than SHA-2 in
+// portable code on 64-bit machines, and BLAKE2s (32-bit words, up to 32
+// bytes) is the better choice on 32-bit ones.  Only the unkeyed, full
+// length variants are wired into CHECKSUM; keyed use goes through the
+// same HMAC path as the other digests.
+//
+// The block buffer is kept full until more data arrives, because the last
+// block has to be compressed with the finalization flag set.
+//
+
+#include "sys-core.h"
+
+#define BLAKE2_DEFINED
+
+#define BLAKE2B_BLOCK_LENGTH 128
+#define BLAKE2B_DIGEST_LENGTH 64
+#define BLAKE2S_BLOCK_LENGTH 64
+#define BLAKE2S_DIGEST_LENGTH 32
+
+typedef struct {
+    u64 h[8];
+    u64 t[2]; // total bytes hashed, as a 128-bit counter
+    REBYTE buffer[BLAKE2B_BLOCK_LENGTH];
+    REBCNT used;
+} BLAKE2B_CTX;
+
+typedef struct {
+    u32 h[8];
+    u32 t[2]; // total bytes hashed, as a 64-bit counter
+    REBYTE buffer[BLAKE2S_BLOCK_LENGTH];
+    REBCNT used;
+} BLAKE2S_CTX;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void BLAKE2B_Init(void *c);
+void BLAKE2B_Update(void *c, REBYTE *data, REBCNT len);
+void BLAKE2B_Final(REBYTE *md, void *c);
+int BLAKE2B_CtxSize(void);
+
+void BLAKE2S_Init(void *c);
+void BLAKE2S_Update(void *c, REBYTE *data, REBCNT len);
+void BLAKE2S_Final(REBYTE *md, void *c);
+int BLAKE2S_CtxSize(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+
+static const REBYTE blake2_sigma[12][16] = {
+    { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 },
+    { 14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3 },
+    { 11, 8, 12, 0, 5, 2, 15, 13, 10, 14, 3, 6, 7, 1, 9, 4 },
+    { 7, 9, 3, 1, 13, 12, 11, 14, 2, 6, 5, 10, 4, 0, 15, 8 },
+    { 9, 0, 5, 7, 2, 4, 10, 15, 14, 1, 11, 12, 6, 8, 3, 13 },
+    { 2, 12, 6, 10, 0, 11, 8, 3, 4, 13, 7, 5, 15, 14, 1, 9 },
+    { 12, 5, 1, 15, 14, 13, 4, 10, 0, 7, 6, 3, 9, 2, 8, 11 },
+    { 13, 11, 7, 14, 12, 1, 3, 9, 5, 0, 15, 4, 8, 6, 2, 10 },
+    { 6, 15, 14, 9, 11, 3, 0, 8, 12, 2, 13, 7, 1, 4, 10, 5 },
+    { 10, 2, 8, 4, 7, 6, 1, 5, 15, 11, 9, 14, 3, 12, 13, 0 },
+    { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 },
+    { 14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3 }
+};
+
+
+//=//// BLAKE2b ///////////////////////////////////////////////////////////=//
+
+static const u64 blake2b_iv[8] = {
+    0x6a09e667f3bcc908ULL, 0xbb67ae8584caa73bULL,
+    0x3c6ef372fe94f82bULL, 0xa54ff53a5f1d36f1ULL,
+    0x510e527fade682d1ULL, 0x9b05688c2b3e6c1fULL,
+    0x1f83d9abfb41bd6bULL, 0x5be0cd19137e2179ULL
+};
+
+#define ROTR64(x,n) (((x) >> (n)) | ((x) << (64 - (n))))
+
+#define B2B_G(a,b,c,d,x,y) \
+    do { \
+        v[a] = v[a] + v[b] + (x); v[d] = ROTR64(v[d] ^ v[a], 32); \
+        v[c] = v[c] + v[d];       v[b] = ROTR64(v[b] ^ v[c], 24); \
+        v[a] = v[a] + v[b] + (y); v[d] = ROTR64(v[d] ^ v[a], 16); \
+        v[c] = v[c] + v[d];       v[b] = ROTR64(v[b] ^ v[c], 63); \
+    } while (0)
+
+
+static void BLAKE2B_Compress(BLAKE2B_CTX *c, const REBYTE *block, REBOOL last)
+{
+    u64 v[16];
+    u64 m[16];
+    int i, j;
+
+    for (i = 0; i < 16; i++) {
+        m[i] = 0;
+        for (j = 7; j >= 0; j--)
+            m[i] = (m[i] << 8) | block[i * 8 + j];
+    }
+
+    for (i = 0; i < 8; i++) {
+        v[i] = c->h[i];
+        v[i + 8] = blake2b_iv[i];
+    }
+    v[12] ^= c->t[0];
+    v[13] ^= c->t[1];
+    if (last)
+        v[14] = ~v[14];
+
+    for (i = 0; i < 12; i++) {
+        const REBYTE *s = blake2_sigma[i];
+        B2B_G(0, 4, 8, 12, m[s[0]], m[s[1]]);
+        B2B_G(1, 5, 9, 13, m[s[2]], m[s[3]]);
+        B2B_G(2, 6, 10, 14, m[s[4]], m[s[5]]);
+        B2B_G(3, 7, 11, 15, m[s[6]], m[s[7]]);
+        B2B_G(0, 5, 10, 15, m[s[8]], m[s[9]]);
+        B2B_G(1, 6, 11, 12, m[s[10]], m[s[11]]);
+        B2B_G(2, 7, 8, 13, m[s[12]], m[s[13]]);
+        B2B_G(3, 4, 9, 14, m[s[14]], m[s[15]]);
+    }
+
+    for (i = 0; i < 8; i++)
+        c->h[i] ^= v[i] ^ v[i + 8];
+}
+
+
+void BLAKE2B_Init(void *c_opaque)
+{
+    BLAKE2B_CTX *c = cast(BLAKE2B_CTX*, c_opaque);
+    int i;
+
+    for (i = 0; i < 8; i++)
+        c->h[i] = blake2b_iv[i];
+
+    // parameter block: digest length, no key, fanout 1, depth 1
+    //
+    c->h[0] ^= 0x01010000 ^ BLAKE2B_DIGEST_LENGTH;
+
+    c->t[0] = 0;
+    c->t[1] = 0;
+    c->used = 0;
+}
+
+
+void BLAKE2B_Update(void *c_opaque, REBYTE *data, REBCNT len)
+{
+    BLAKE2B_CTX *c = cast(BLAKE2B_CTX*, c_opaque);
+
+    while (len > 0) {
+        if (c->used == BLAKE2B_BLOCK_LENGTH) { // more is coming, not last
+            c->t[0] += BLAKE2B_BLOCK_LENGTH;
+            if (c->t[0] < BLAKE2B_BLOCK_LENGTH)
+                c->t[1]++;
+            BLAKE2B_Compress(c, c->buffer, FALSE);
+            c->used = 0;
+        }
+
+        REBCNT n = BLAKE2B_BLOCK_LENGTH - c->used;
+        if (n > len)
+            n = len;
+        memcpy(c->buffer + c->used, data, n);
+        c->used += n;
+        data += n;
+        len -= n;
+    }
+}
+
+
+void BLAKE2B_Final(REBYTE *md, void *c_opaque)
+{
+    BLAKE2B_CTX *c = cast(BLAKE2B_CTX*, c_opaque);
+    int i;
+
+    c->t[0] += c->used;
+    if (c->t[0] < c->used)
+        c->t[1]++;
+
+    memset(c->buffer + c->used, 0, BLAKE2B_BLOCK_LENGTH - c->used);
+    BLAKE2B_Compress(c, c->buffer, TRUE);
+
+    for (i = 0; i < BLAKE2B_DIGEST_LENGTH; i++)
+        md[i] = cast(REBYTE, c->h[i / 8] >> (8 * (i % 8)));
+}
+
+
+int BLAKE2B_CtxSize(void) {
+    return sizeof(BLAKE2B_CTX);
+}
+
+
+//
+//  BLAKE2B: C
+//
+REBYTE *BLAKE2B(REBYTE *d, REBCNT n, REBYTE *md)
+{
+    BLAKE2B_CTX c;
+    static REBYTE m[BLAKE2B_DIGEST_LENGTH];
+
+    if (md == NULL)
+        md = m;
+    BLAKE2B_Init(&c);
+    BLAKE2B_Update(&c, d, n);
+    BLAKE2B_Final(md, &c);
+    memset(&c, 0, sizeof(c)); // security consideration
+    return md;
+}
+
+
+//=//// BLAKE2s ///////////////////////////////////////////////////////////=//
+
+static const u32 blake2s_iv[8] = {
+    0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A,
+    0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19
+};
+
+#define ROTR32(x,n) (((x) >> (n)) | ((x) << (32 - (n))))
+
+#define B2S_G(a,b,c,d,x,y) \
+    do { \
+        v[a] = v[a] + v[b] + (x); v[d] = ROTR32(v[d] ^ v[a], 16); \
+        v[c] = v[c] + v[d];       v[b] = ROTR32(v[b] ^ v[c], 12); \
+        v[a] = v[a] + v[b] + (y); v[d] = ROTR32(v[d] ^ v[a], 8); \
+        v[c] = v[c] + v[d];       v[b] = ROTR32(v[b] ^ v[c], 7); \
+    } while (0)
+
+
+static void BLAKE2S_Compress(BLAKE2S_CTX *c, const REBYTE *block, REBOOL last)
+{
+    u32 v[16];
+    u32 m[16];
+    int i;
+
+    for (i = 0; i < 16; i++)
+        m[i] = cast(u32, block[i * 4])
+            | (cast(u32, block[i * 4 + 1]) << 8)
+            | (cast(u32, block[i * 4 + 2]) << 16)
+            | (cast(u32, block[i * 4 + 3]) << 24);
+
+    for (i = 0; i < 8; i++) {
+        v[i] = c->h[i];
+        v[i + 8] = blake2s_iv[i];
+    }
+    v[12] ^= c->t[0];
+    v[13] ^= c->t[1];
+    if (last)
+        v[14] = ~v[14];
+
+    for (i = 0; i < 10; i++) {
+        const REBYTE *s = blake2_sigma[i];
+        B2S_G(0, 4, 8, 12, m[s[0]], m[s[1]]);
+        B2S_G(1, 5, 9, 13, m[s[2]], m[s[3]]);
+        B2S_G(2, 6, 10, 14, m[s[4]], m[s[5]]);
+        B2S_G(3, 7, 11, 15, m[s[6]], m[s[7]]);
+        B2S_G(0, 5, 10, 15, m[s[8]], m[s[9]]);
+        B2S_G(1, 6, 11, 12, m[s[10]], m[s[11]]);
+        B2S_G(2, 7, 8, 13, m[s[12]], m[s[13]]);
+        B2S_G(3, 4, 9, 14, m[s[14]], m[s[15]]);
+    }
+
+    for (i = 0; i < 8; i++)
+        c->h[i] ^= v[i] ^ v[i + 8];
+}
+
+
+void BLAKE2S_Init(void *c_opaque)
+{
+    BLAKE2S_CTX *c = cast(BLAKE2S_CTX*, c_opaque);
+    int i;
+
+    for (i = 0; i < 8; i++)
+        c->h[i] = blake2s_iv[i];
+    c->h[0] ^= 0x01010000 ^ BLAKE2S_DIGEST_LENGTH;
+
+    c->t[0] = 0;
+    c->t[1] = 0;
+    c->used = 0;
+}
+
+
+void BLAKE2S_Update(void *c_opaque, REBYTE *data, REBCNT len)
+{
+    BLAKE2S_CTX *c = cast(BLAKE2S_CTX*, c_opaque);
+
+    while (len > 0) {
+        if (c->used == BLAKE2S_BLOCK_LENGTH) {
+            c->t[0] += BLAKE2S_BLOCK_LENGTH;
+            if (c->t[0] < BLAKE2S_BLOCK_LENGTH)
+                c->t[1]++;
+            BLAKE2S_Compress(c, c->buffer, FALSE);
+            c->used = 0;
+        }
+
+        REBCNT n = BLAKE2S_BLOCK_LENGTH - c->used;
+        if (n > len)
+            n = len;
+        memcpy(c->buffer + c->used, data, n);
+        c->used += n;
+        data += n;
+        len -= n;
+    }
+}
+
+
+void BLAKE2S_Final(REBYTE *md, void *c_opaque)
+{
+    BLAKE2S_CTX *c = cast(BLAKE2S_CTX*, c_opaque);
+    int i;
+
+    c->t[0] += c->used;
+    if (c->t[0] < c->used)
+        c->t[1]++;
+
+    memset(c->buffer + c->used, 0, BLAKE2S_BLOCK_LENGTH - c->used);
+    BLAKE2S_Compress(c, c->buffer, TRUE);
+
+    for (i = 0; i < BLAKE2S_DIGEST_LENGTH; i++)
+        md[i] = cast(REBYTE, c->h[i / 4] >> (8 * (i % 4)));
+}
+
+
+int BLAKE2S_CtxSize(void) {
+    return sizeof(BLAKE2S_CTX);
+}
+
+
+//
+//  BLAKE2S: C
+//
+REBYTE *BLAKE2S(REBYTE *d, REBCNT n, REBYTE *md)
+{
+    BLAKE2S_CTX c;
+    static REBYTE m[BLAKE2S_DIGEST_LENGTH];
+
+    if (md == NULL)
+        md = m;
+    BLAKE2S_Init(&c);
+    BLAKE2S_Update(&c, d, n);
+    BLAKE2S_Final(md, &c);
+    memset(&c, 0, sizeof(c)); // security consideration
+    return md;
+}
@@ -42,14 +42,19 @@
 //
 // Options are offered for using zlib envelope, gzip envelope, or raw deflate.
 //
-// !!! Technically zlib is designed to do "streaming" compression.  Those
-// features are not exposed by this interface, although they are implemented
-// in the zlib code.
+// COMPRESS and DECOMPRESS work on a whole series at once.  For data that is
+// larger than memory (or arriving from a port), Init_Zstream() wraps a zlib
+// stream in a HANDLE! which Zstream_Update() feeds with one chunk at a time,
+// returning whatever output zlib had ready for that chunk.
 //
 
 #include "sys-core.h"
 #include "sys-zlib.h"
 
+#ifdef HAS_PTHREADS
+    #include <pthread.h>
+#endif
+
 
 //
 //  REBCNT_To_Bytes: C
@@ -131,6 +136,64 @@ static REBCTX *Error_Compression(const z_stream *strm, int ret)
 }
 
 
+//
+//  Window_Bits: C
+//
+static int Window_Bits(REBOOL gzip, REBOOL raw)
+{
+    return raw
+        ? (gzip ? window_bits_gzip_raw : window_bits_zlib_raw)
+        : (gzip ? window_bits_gzip : window_bits_zlib);
+}
+
+
+//
+//  Zlib_Level: C
+//
+// Compression level can be a value from 0 (store only) to 9, or -1 for
+// Z_DEFAULT_COMPRESSION, which picks what the library author considers the
+// "worth it" tradeoff of time and size (currently 6).
+//
+static int Zlib_Level(REBINT level)
+{
+    if (level < Z_DEFAULT_COMPRESSION || level > Z_BEST_COMPRESSION) {
+        REBVAL arg;
+        SET_INTEGER(&arg, level);
+        fail (Error_Out_Of_Range(&arg));
+    }
+    return level;
+}
+
+
+//
+//  Zlib_Strategy: C
+//
+// Map a strategy WORD! (or NULL) to zlib's tuning constants.  FILTERED suits
+// data from a predictor (e.g. PNG rows), HUFFMAN-ONLY and RLE trade ratio for
+// speed, and FIXED avoids dynamic Huffman tables for very small inputs.
+//
+static int Zlib_Strategy(const REBVAL *word)
+{
+    if (word == NULL)
+        return Z_DEFAULT_STRATEGY;
+
+    switch (VAL_WORD_SYM(word)) {
+    case SYM_DEFAULT:
+        return Z_DEFAULT_STRATEGY;
+    case SYM_FILTERED:
+        return Z_FILTERED;
+    case SYM_HUFFMAN_ONLY:
+        return Z_HUFFMAN_ONLY;
+    case SYM_RLE:
+        return Z_RLE;
+    case SYM_FIXED:
+        return Z_FIXED;
+    default:
+        fail (Error_Invalid_Arg(word));
+    }
+}
+
+
 //
 //  Compress: C
 //
@@ -143,16 +206,14 @@ REBSER *Compress(
     REBINT index,
     REBCNT len,
     REBOOL gzip,
-    REBOOL raw
+    REBOOL raw,
+    REBINT level,
+    const REBVAL *strategy
 ) {
     int ret;
 
     assert(BYTE_SIZE(input)); // must be BINARY!
 
-    // compression level can be a value from 1 to 9, or Z_DEFAULT_COMPRESSION
-    // if you want it to pick what the library author considers the "worth it"
-    // tradeoff of time to generally suggest.
-    //
     z_stream strm;
     strm.zalloc = Z_NULL;
     strm.zfree = Z_NULL;
@@ -160,13 +221,11 @@ REBSER *Compress(
 
     ret = deflateInit2(
         &strm,
-        Z_DEFAULT_COMPRESSION,
+        Zlib_Level(level),
         Z_DEFLATED,
-        raw
-            ? (gzip ? window_bits_gzip_raw : window_bits_zlib_raw)
-            : (gzip ? window_bits_gzip : window_bits_zlib),
+        Window_Bits(gzip, raw),
         8,
-        Z_DEFAULT_STRATEGY
+        Zlib_Strategy(strategy)
     );
 
     if (ret != Z_OK)
@@ -233,6 +292,366 @@ REBSER *Compress(
 }
 
 
+//
+// Parallel compression follows the approach of Mark Adler's pigz: the input
+// is cut into fixed-size blocks which are deflated independently, each one
+// primed with the last 32K of the block before it (so matches can still
+// reach back across the cut, and the ratio stays close to a serial run).
+// Every block but the last ends with a Z_SYNC_FLUSH, which pads to a byte
+// boundary without setting the "final block" bit, so the raw outputs can
+// simply be concatenated.  Checksums of the blocks are merged afterward with
+// crc32_combine() or adler32_combine().
+//
+// Because the cut points don't depend on the number of workers, the output
+// is the same for any worker count (and on builds without threads, where
+// the calling thread does all the blocks itself).
+//
+// Workers must not touch Rebol memory or call fail(), so block outputs are
+// malloc()'d and errors are left in the block for the caller to report.
+//
+
+#define DEFLATE_BLOCK_SIZE (128 * 1024) // pigz's default
+#define DEFLATE_DICT_SIZE (32 * 1024) // largest window deflate can use
+
+typedef struct {
+    const REBYTE *data;
+    REBCNT len;
+    REBCNT dict_len; // bytes just before `data` to prime the window with
+    REBOOL last;
+    REBOOL gzip; // CRC-32 if true, else Adler-32
+
+    REBYTE *out; // malloc()'d
+    REBCNT out_len;
+    uLong check;
+    int ret; // Z_OK, or the failing zlib code
+} REB_DEFLATE_BLOCK;
+
+typedef struct {
+    REB_DEFLATE_BLOCK *blocks;
+    REBCNT num_blocks;
+    REBCNT first; // this worker does first, first + stride, ...
+    REBCNT stride;
+    int level;
+    int strategy;
+} REB_DEFLATE_WORK;
+
+
+//
+//  Deflate_Block: C
+//
+static void Deflate_Block(REB_DEFLATE_BLOCK *b, int level, int strategy)
+{
+    z_stream strm;
+    strm.zalloc = Z_NULL;
+    strm.zfree = Z_NULL;
+    strm.opaque = Z_NULL;
+
+    b->out = NULL;
+    b->out_len = 0;
+    b->check = b->gzip
+        ? crc32(crc32(0L, Z_NULL, 0), b->data, b->len)
+        : adler32(adler32(0L, Z_NULL, 0), b->data, b->len);
+
+    b->ret = deflateInit2(
+        &strm, level, Z_DEFLATED, window_bits_zlib_raw, 8, strategy
+    );
+    if (b->ret != Z_OK)
+        return;
+
+    if (b->dict_len != 0) {
+        b->ret = deflateSetDictionary(
+            &strm, b->data - b->dict_len, b->dict_len
+        );
+        if (b->ret != Z_OK)
+            goto done;
+    }
+
+    // deflateBound() doesn't count the empty stored block written by the
+    // sync flush, so leave a little extra (the loop grows it if needed).
+    //
+    REBCNT size = deflateBound(&strm, b->len) + 16;
+    b->out = cast(REBYTE*, malloc(size));
+    if (b->out == NULL) {
+        b->ret = Z_MEM_ERROR;
+        goto done;
+    }
+
+    strm.next_in = b->data;
+    strm.avail_in = b->len;
+
+    int flush = b->last ? Z_FINISH : Z_SYNC_FLUSH;
+    while (TRUE) {
+        strm.next_out = b->out + b->out_len;
+        strm.avail_out = size - b->out_len;
+
+        int ret = deflate(&strm, flush);
+        b->out_len = size - strm.avail_out;
+
+        if (ret != Z_OK && ret != Z_STREAM_END && ret != Z_BUF_ERROR) {
+            b->ret = ret;
+            goto done;
+        }
+        if (strm.avail_out != 0)
+            break; // flush is complete (Z_STREAM_END if Z_FINISH)
+
+        REBYTE *bigger = cast(REBYTE*, realloc(b->out, size * 2));
+        if (bigger == NULL) {
+            b->ret = Z_MEM_ERROR;
+            goto done;
+        }
+        b->out = bigger;
+        size *= 2;
+    }
+
+done:
+    deflateEnd(&strm);
+}
+
+
+//
+//  Deflate_Worker: C
+//
+static void *Deflate_Worker(void *p)
+{
+    REB_DEFLATE_WORK *work = cast(REB_DEFLATE_WORK*, p);
+
+    REBCNT n;
+    for (n = work->first; n < work->num_blocks; n += work->stride)
+        Deflate_Block(&work->blocks[n], work->level, work->strategy);
+
+    return NULL;
+}
+
+
+//
+//  Run_Workers: C
+//
+// Call `worker` once for each of the `workers` argument structs at `args`
+// (which are `size` bytes apart), on separate threads where the build has
+// them.  The calling thread does the first one itself, along with any whose
+// thread couldn't be started, so this always returns with all of them done.
+//
+// The workers must not touch Rebol memory or call fail().
+//
+void Run_Workers(
+    void *(*worker)(void *),
+    void *args,
+    size_t size,
+    REBINT workers
+) {
+    assert(workers >= 1 && workers <= MAX_DEFLATE_WORKERS);
+
+    REBYTE *arg = cast(REBYTE*, args);
+
+#ifdef HAS_PTHREADS
+    pthread_t threads[MAX_DEFLATE_WORKERS];
+    REBOOL started[MAX_DEFLATE_WORKERS];
+    REBINT w;
+    for (w = 1; w < workers; ++w)
+        started[w] = LOGICAL(
+            pthread_create(&threads[w], NULL, worker, arg + w * size) == 0
+        );
+
+    (*worker)(arg);
+
+    for (w = 1; w < workers; ++w) {
+        if (started[w])
+            pthread_join(threads[w], NULL);
+        else
+            (*worker)(arg + w * size);
+    }
+#else
+    REBINT w;
+    for (w = 0; w < workers; ++w)
+        (*worker)(arg + w * size);
+#endif
+}
+
+
+//
+//  Deflate_Parallel: C
+//
+// Deflate `len` bytes on up to `workers` threads, in gzip or zlib format (or
+// neither, if `raw`).  Unlike Compress_Parallel() this takes zlib's own
+// level and strategy constants, and never adds Rebol's length envelope, so
+// it suits formats which embed a plain zlib stream (e.g. PNG's IDAT data).
+//
+// The result has 4 bytes of spare capacity, for callers that want to add
+// the envelope themselves.
+//
+REBSER *Deflate_Parallel(
+    const REBYTE *data,
+    REBCNT len,
+    REBOOL gzip,
+    REBOOL raw,
+    int zlevel,
+    int zstrategy,
+    REBINT workers
+) {
+    if (workers < 1 || workers > MAX_DEFLATE_WORKERS) {
+        REBVAL arg;
+        SET_INTEGER(&arg, workers);
+        fail (Error_Out_Of_Range(&arg));
+    }
+
+    REBCNT num_blocks = (len + DEFLATE_BLOCK_SIZE - 1) / DEFLATE_BLOCK_SIZE;
+    if (num_blocks == 0)
+        num_blocks = 1; // still need the final (empty) block
+    if (cast(REBCNT, workers) > num_blocks)
+        workers = num_blocks;
+
+    REB_DEFLATE_BLOCK *blocks = ALLOC_N(REB_DEFLATE_BLOCK, num_blocks);
+    REBCNT n;
+    for (n = 0; n < num_blocks; ++n) {
+        REB_DEFLATE_BLOCK *b = &blocks[n];
+        REBCNT offset = n * DEFLATE_BLOCK_SIZE;
+        b->data = data + offset;
+        b->len = MIN(len - offset, DEFLATE_BLOCK_SIZE);
+        b->dict_len = MIN(offset, DEFLATE_DICT_SIZE);
+        b->last = LOGICAL(n == num_blocks - 1);
+        b->gzip = gzip;
+    }
+
+    REB_DEFLATE_WORK work[MAX_DEFLATE_WORKERS];
+    REBINT w;
+    for (w = 0; w < workers; ++w) {
+        work[w].blocks = blocks;
+        work[w].num_blocks = num_blocks;
+        work[w].first = w;
+        work[w].stride = workers;
+        work[w].level = zlevel;
+        work[w].strategy = zstrategy;
+    }
+
+    Run_Workers(&Deflate_Worker, work, sizeof(REB_DEFLATE_WORK), workers);
+
+    // Report the first error only after every block's memory is released,
+    // since fail() will not come back here.
+    //
+    int ret = Z_OK;
+    REBCNT out_len = 0;
+    for (n = 0; n < num_blocks; ++n) {
+        if (blocks[n].ret != Z_OK && ret == Z_OK)
+            ret = blocks[n].ret;
+        out_len += blocks[n].out_len;
+    }
+
+    if (ret != Z_OK) {
+        for (n = 0; n < num_blocks; ++n)
+            free(blocks[n].out);
+        FREE_N(REB_DEFLATE_BLOCK, num_blocks, blocks);
+
+        z_stream strm;
+        strm.msg = NULL;
+        fail (Error_Compression(&strm, ret));
+    }
+
+    // gzip header is 10 bytes and trailer 8, the zlib ones are 2 and 4 (+4
+    // for Rebol's length).
+    //
+    REBSER *output = Make_Binary(out_len + 18);
+    REBYTE *bp = BIN_HEAD(output);
+
+    // XFL and FLEVEL describe the level, as zlib itself would set them
+    //
+    REBCNT speed;
+    if (zlevel == Z_DEFAULT_COMPRESSION)
+        zlevel = 6;
+    if (zstrategy >= Z_HUFFMAN_ONLY || zlevel < 2)
+        speed = 0; // fastest
+    else if (zlevel < 6)
+        speed = 1;
+    else if (zlevel == 6)
+        speed = 2;
+    else
+        speed = 3; // best
+
+    if (gzip && !raw) {
+        const REBYTE gz_header[10] = {
+            0x1F, 0x8B, // magic number
+            Z_DEFLATED,
+            0, // flags (no name, comment, etc.)
+            0, 0, 0, 0, // modification time (none)
+            cast(REBYTE, zlevel == 9 ? 2 : (speed == 0 ? 4 : 0)), // XFL
+            3 // OS (zlib uses 3 for Unix, and this is informational only)
+        };
+        memcpy(bp, gz_header, 10);
+        bp += 10;
+    }
+    else if (!raw) {
+        REBCNT header = (0x78 << 8) | (speed << 6); // 32K window, deflate
+        header += 31 - (header % 31); // FCHECK
+        *bp++ = cast(REBYTE, header >> 8);
+        *bp++ = cast(REBYTE, header);
+    }
+
+    uLong check = gzip ? crc32(0L, Z_NULL, 0) : adler32(0L, Z_NULL, 0);
+    for (n = 0; n < num_blocks; ++n) {
+        memcpy(bp, blocks[n].out, blocks[n].out_len);
+        bp += blocks[n].out_len;
+        free(blocks[n].out);
+
+        check = gzip
+            ? crc32_combine(check, blocks[n].check, blocks[n].len)
+            : adler32_combine(check, blocks[n].check, blocks[n].len);
+    }
+    FREE_N(REB_DEFLATE_BLOCK, num_blocks, blocks);
+
+    if (gzip && !raw) {
+        REBCNT_To_Bytes(bp, cast(REBCNT, check));
+        REBCNT_To_Bytes(bp + 4, len);
+        bp += 8;
+    }
+    else if (!raw) {
+        *bp++ = cast(REBYTE, check >> 24); // Adler-32 is big endian
+        *bp++ = cast(REBYTE, check >> 16);
+        *bp++ = cast(REBYTE, check >> 8);
+        *bp++ = cast(REBYTE, check);
+    }
+
+    TERM_BIN_LEN(output, bp - BIN_HEAD(output));
+    return output;
+}
+
+
+//
+//  Compress_Parallel: C
+//
+// Same output format as Compress() (and decompressible by it, or by any
+// gzip tool if `gzip`), but deflated in blocks on up to `workers` threads.
+//
+REBSER *Compress_Parallel(
+    REBSER *input,
+    REBINT index,
+    REBCNT len,
+    REBOOL gzip,
+    REBOOL raw,
+    REBINT level,
+    const REBVAL *strategy,
+    REBINT workers
+) {
+    assert(BYTE_SIZE(input)); // must be BINARY!
+
+    REBSER *output = Deflate_Parallel(
+        BIN_HEAD(input) + index,
+        len,
+        gzip,
+        raw,
+        Zlib_Level(level),
+        Zlib_Strategy(strategy),
+        workers
+    );
+
+    if (!gzip && !raw) {
+        REBYTE *bp = BIN_TAIL(output);
+        REBCNT_To_Bytes(bp, len); // Rebol's envelope, see Compress()
+        TERM_BIN_LEN(output, BIN_LEN(output) + 4);
+    }
+
+    return output;
+}
+
+
 //
 //  Decompress: C
 //
@@ -307,12 +726,7 @@ REBSER *Decompress(
 
     // !!! Zlib can detect decompression...use window_bits_detect_zlib_gzip?
     //
-    ret = inflateInit2(
-        &strm,
-        raw
-            ? (gzip ? window_bits_gzip_raw : window_bits_zlib_raw)
-            : (gzip ? window_bits_gzip : window_bits_zlib)
-    );
+    ret = inflateInit2(&strm, Window_Bits(gzip, raw));
     if (ret != Z_OK)
         fail (Error_Compression(&strm, ret));
 
@@ -418,3 +832,185 @@ REBSER *Decompress(
 
     return output;
 }
+
+
+// State behind the HANDLE! made by Init_Zstream().  The z_stream holds
+// pointers to zlib's own allocations, so it is freed by the handle's cleaner
+// (which also means a FAIL in the middle of an update does not leak it).
+//
+typedef struct {
+    z_stream strm;
+    REBOOL inflating;
+    REBOOL envelope; // Rebol's 32-bit length follows the zlib stream
+    REBOOL finished; // Z_STREAM_END has been reached
+    REBCNT trailer; // bytes seen after the end (only legal for envelope)
+} REB_ZSTREAM;
+
+static void cleanup_zstream(const REBVAL *v)
+{
+    REB_ZSTREAM *z = cast(REB_ZSTREAM*, VAL_HANDLE_POINTER(v));
+    if (z->inflating)
+        inflateEnd(&z->strm);
+    else
+        deflateEnd(&z->strm);
+    FREE(REB_ZSTREAM, z);
+}
+
+
+//
+//  Init_Zstream: C
+//
+// Make a HANDLE! for an incremental compression (or, if `inflating`, a
+// decompression).  The envelope options are the same as for Compress() and
+// Decompress().  `level` and `strategy` are ignored when inflating.
+//
+void Init_Zstream(
+    REBVAL *out,
+    REBOOL inflating,
+    REBOOL gzip,
+    REBOOL raw,
+    REBINT level,
+    const REBVAL *strategy
+) {
+    // Validate before allocating, as these can fail()
+    //
+    int zlevel = inflating ? 0 : Zlib_Level(level);
+    int zstrategy = inflating ? 0 : Zlib_Strategy(strategy);
+
+    REB_ZSTREAM *z = ALLOC_ZEROFILL(REB_ZSTREAM);
+    z->strm.zalloc = Z_NULL;
+    z->strm.zfree = Z_NULL;
+    z->strm.opaque = Z_NULL;
+    z->inflating = inflating;
+    z->envelope = NOT(gzip) && NOT(raw);
+
+    int ret;
+    if (inflating)
+        ret = inflateInit2(&z->strm, Window_Bits(gzip, raw));
+    else
+        ret = deflateInit2(
+            &z->strm, zlevel, Z_DEFLATED, Window_Bits(gzip, raw), 8, zstrategy
+        );
+
+    if (ret != Z_OK) {
+        REBCTX *error = Error_Compression(&z->strm, ret);
+        FREE(REB_ZSTREAM, z);
+        fail (error);
+    }
+
+    Init_Handle_Managed(out, z, 0, &cleanup_zstream);
+}
+
+
+//
+//  Zstream_Update: C
+//
+// Push `len` bytes through a stream from Init_Zstream() (which must have been
+// made with the same `inflating` setting), returning the
+// output zlib produces for them as a new BINARY! series (which may be
+// empty, as deflate buffers input until it has enough to emit a block).
+//
+// If `finish` is set then all pending output is flushed.  For compression
+// this writes the end of the stream (and the envelope's length or gzip's
+// trailer), after which the stream may not be updated again.  For
+// decompression it is an error if the data seen so far was incomplete.
+//
+REBSER *Zstream_Update(
+    REBVAL *handle,
+    REBOOL inflating,
+    const REBYTE *data,
+    REBCNT len,
+    REBOOL finish
+) {
+    if (VAL_HANDLE_CLEANER(handle) != cleanup_zstream)
+        fail (Error_Invalid_Arg(handle));
+
+    REB_ZSTREAM *z = cast(REB_ZSTREAM*, VAL_HANDLE_POINTER(handle));
+    if (z->inflating != inflating)
+        fail (Error_Invalid_Arg(handle));
+
+    if (z->finished) {
+        //
+        // Compressed streams are closed by `finish`.  Decompressed streams
+        // in Rebol's envelope have 4 bytes of length after the zlib data,
+        // which can't be told apart from garbage until they are seen.
+        //
+        if (!z->inflating || z->trailer + len > sizeof(REBCNT))
+            fail (Error_Invalid_Arg(handle));
+        z->trailer += len;
+        return Make_Binary(0);
+    }
+
+    // Guess at the output size, growing below if the guess was too small.
+    // (See notes in Decompress() about typical ratios.)
+    //
+    REBCNT buf_size = z->inflating ? len * 3 + 256 : len / 2 + 256;
+    REBSER *output = Make_Binary(buf_size);
+    REBCNT used = 0;
+
+    z->strm.next_in = data;
+    z->strm.avail_in = len;
+
+    int flush = (finish && !z->inflating) ? Z_FINISH : Z_NO_FLUSH;
+
+    while (TRUE) {
+        z->strm.next_out = BIN_HEAD(output) + used;
+        z->strm.avail_out = buf_size - used;
+
+        int ret = z->inflating
+            ? inflate(&z->strm, flush)
+            : deflate(&z->strm, flush);
+
+        used = buf_size - z->strm.avail_out;
+
+        if (ret == Z_STREAM_END) {
+            z->finished = TRUE;
+            if (z->inflating) {
+                z->trailer = z->strm.avail_in;
+                if (z->trailer > (z->envelope ? sizeof(REBCNT) : 0)) {
+                    REBVAL arg;
+                    Init_String(&arg, Make_UTF8_May_Fail(
+                        "data after end of compressed stream"
+                    ));
+                    fail (Error(RE_BAD_COMPRESSION, &arg));
+                }
+            }
+            else if (z->envelope) {
+                //
+                // Same trailing length as Compress() would add, which like
+                // gzip's is only the length modulo 2^32 for big streams.
+                //
+                TERM_BIN_LEN(output, used);
+                REBYTE out_size[sizeof(REBCNT)];
+                REBCNT_To_Bytes(out_size, cast(REBCNT, z->strm.total_in));
+                Append_Series(output, out_size, sizeof(REBCNT));
+                return output;
+            }
+            break;
+        }
+
+        if (ret == Z_BUF_ERROR && z->strm.avail_out != 0)
+            break; // no progress possible: needs more input
+
+        if (ret != Z_OK && ret != Z_BUF_ERROR)
+            fail (Error_Compression(&z->strm, ret));
+
+        if (z->strm.avail_out != 0 && z->strm.avail_in == 0 && !finish)
+            break; // consumed all input, and nothing more pending
+
+        if (z->strm.avail_out == 0) {
+            SET_SERIES_LEN(output, used); // Extend_Series() keeps the tail
+            Extend_Series(output, buf_size);
+            buf_size *= 2;
+        }
+    }
+
+    if (finish && z->inflating && !z->finished) {
+        REBVAL arg;
+        Init_String(&arg, Make_UTF8_May_Fail("incomplete compressed stream"));
+        fail (Error(RE_BAD_COMPRESSION, &arg));
+    }
+
+    TERM_BIN_LEN(output, used);
+    return output;
+}
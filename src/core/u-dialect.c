@@ -54,8 +54,8 @@ enum {
     RDIA_MAX
 };
 
-static REBINT Delect_Debug = 0;
-static REBINT Total_Missed = 0;
+static THREAD_LOCAL REBINT Delect_Debug = 0;
+static THREAD_LOCAL REBINT Total_Missed = 0;
 static const char *Dia_Fmt = "DELECT - cmd: %s length: %d missed: %d total: %d";
 
 
@@ -237,7 +237,19 @@ jpeg_series_src (j_decompress_ptr cinfo, JOCTET *buffer, size_t nbytes )
   src->pub.next_input_byte = NULL; /* until buffer loaded */
 }
 
-void jpeg_info( char *buffer, int nbytes, int *w, int *h )
+/*
+ * Set up for decoding at 1/scale size (scale is 1, 2, 4 or 8; anything
+ * else is rounded down to one of those).  The IDCT then produces the
+ * smaller blocks directly, so the later stages only see the reduced image.
+ */
+static void jpeg_set_scale( j_decompress_ptr cinfo, int scale )
+{
+  cinfo->scale_num = 1;
+  cinfo->scale_denom = scale < 1 ? 1 : scale;
+  jpeg_calc_output_dimensions(cinfo);
+}
+
+void jpeg_info( char *buffer, int nbytes, int scale, int *w, int *h )
 {
   struct jpeg_decompress_struct cinfo;
   struct jpeg_error_mgr jerr;
@@ -251,18 +263,19 @@ void jpeg_info( char *buffer, int nbytes, int *w, int *h )
 
   /* Read file header, set default decompression parameters */
   (void) jpeg_read_header(&cinfo, TRUE);
-  *w = cinfo.image_width;
-  *h = cinfo.image_height;
+  jpeg_set_scale(&cinfo, scale);
+  *w = cinfo.output_width;
+  *h = cinfo.output_height;
 
   jpeg_destroy_decompress(&cinfo);
 }
 
-void jpeg_load( char *buffer, int nbytes, char *output )
+void jpeg_load( char *buffer, int nbytes, int scale, char *output )
 {
   struct jpeg_decompress_struct cinfo;
   struct jpeg_error_mgr jerr;
-  JSAMPROW  array[ 4 ];
-  unsigned int  i, j;
+  JSAMPARRAY rows;
+  unsigned int  j;
 
   /* Initialize the JPEG decompression object with default error handling. */
   cinfo.err = jpeg_std_error(&jerr);
@@ -274,46 +287,41 @@ void jpeg_load( char *buffer, int nbytes, char *output )
   /* Read file header, set default decompression parameters */
   (void) jpeg_read_header(&cinfo, TRUE);
 
+  /* Ask for image pixels directly, where the color space allows. */
+  if (cinfo.jpeg_color_space == JCS_YCbCr
+      || cinfo.jpeg_color_space == JCS_GRAYSCALE
+      || cinfo.jpeg_color_space == JCS_RGB)
+    cinfo.out_color_space = JCS_PIXEL;
+  jpeg_set_scale(&cinfo, scale);
+
   /* Start decompressor */
   (void) jpeg_start_decompress(&cinfo);
 
-  /* Process data */
-  while (cinfo.output_scanline < cinfo.output_height) {
-    array[ 0 ] = (JSAMPROW)(output + cinfo.output_scanline * cinfo.image_width * 4);
-    array[ 1 ] = array[ 0 ] + cinfo.image_width * 4;
-    array[ 2 ] = array[ 1 ] + cinfo.image_width * 4;
-    array[ 3 ] = array[ 2 ] + cinfo.image_width * 4;
-    jpeg_read_scanlines(&cinfo, array, 4 );
-  }
-
-  if (cinfo.out_color_space != JCS_GRAYSCALE)
-  // convert 3 byte values into four byte ones
-  for ( i=0; i<cinfo.image_height; i++ ) {
-    unsigned char   *cp;
-    uinteger32  *dp;
-
-    cp = (unsigned char *)(output + cinfo.image_width * 3);
-    dp = ( uinteger32 * )output + cinfo.image_width;
-    output = ( char * )dp;
-    for ( j=0; j<cinfo.image_width; j++ ) {
-        cp -= 3;
-        *--dp = TO_PIXEL_COLOR(cp[ 0 ], cp[ 1 ], cp[ 2 ], 0xff);
+  if (cinfo.out_color_space == JCS_PIXEL) {
+    rows = (JSAMPARRAY) (*cinfo.mem->alloc_small) ((j_common_ptr) &cinfo, JPOOL_IMAGE,
+                cinfo.rec_outbuf_height * SIZEOF(JSAMPROW));
+    while (cinfo.output_scanline < cinfo.output_height) {
+      for (j = 0; j < (unsigned int) cinfo.rec_outbuf_height; j++)
+        rows[j] = (JSAMPROW)(output
+          + (cinfo.output_scanline + j) * cinfo.output_width * 4);
+      jpeg_read_scanlines(&cinfo, rows, cinfo.rec_outbuf_height);
     }
   }
-  else
-  // convert 1 byte value into four byte ones
-    for ( i=0; i<cinfo.image_height; i++ ) {
-      unsigned char *cp;
-      uinteger32    *dp, c;
-
-      cp = (unsigned char *)(output + cinfo.image_width);
-      dp = ( uinteger32 * )output + cinfo.image_width;
-      output = ( char * )dp;
-      for ( j=0; j<cinfo.image_width; j++ ) {
-        c = *--cp;
-        *--dp = TO_PIXEL_COLOR(c, c, c, 0xff);
+  else {
+    // Other color spaces (CMYK, YCCK): take the first three components
+    rows = (*cinfo.mem->alloc_sarray) ((j_common_ptr) &cinfo, JPOOL_IMAGE,
+                cinfo.output_width * cinfo.output_components, 1);
+    while (cinfo.output_scanline < cinfo.output_height) {
+      unsigned char *cp = rows[0];
+      uinteger32 *dp = ( uinteger32 * )output
+          + cinfo.output_scanline * cinfo.output_width;
+      jpeg_read_scanlines(&cinfo, rows, 1);
+      for ( j=0; j<cinfo.output_width; j++ ) {
+        *dp++ = TO_PIXEL_COLOR(cp[ 0 ], cp[ 1 ], cp[ 2 ], 0xff);
+        cp += cinfo.output_components;
       }
     }
+  }
 
   /* Finish decompression and release memory.
    * I must do it in this order because output module has allocated memory
@@ -1179,6 +1187,7 @@ jpeg_calc_output_dimensions (j_decompress_ptr cinfo)
     break;
   case JCS_CMYK:
   case JCS_YCCK:
+  case JCS_PIXEL:
     cinfo->out_color_components = 4;
     break;
   default:          /* else must be same colorspace as in file */
@@ -5599,6 +5608,10 @@ start_pass (j_decompress_ptr cinfo)
 #ifdef DCT_ISLOW_SUPPORTED
       case JDCT_ISLOW:
     method_ptr = jpeg_idct_islow;
+#ifdef JPEG_SIMD
+    if (jpeg_simd_avx2())
+      method_ptr = jpeg_idct_islow_avx2;
+#endif
     method = JDCT_ISLOW;
     break;
 #endif
@@ -6750,6 +6763,645 @@ jpeg_idct_islow (j_decompress_ptr cinfo, jpeg_component_info * compptr,
 }
 
 #endif /* DCT_ISLOW_SUPPORTED */
+/*
+ * jidctred.c
+ *
+ * Copyright (C) 1994-1998, Thomas G. Lane.
+ * This file is part of the Independent JPEG Group's software.
+ * For conditions of distribution and use, see the accompanying README file.
+ *
+ * This file contains inverse-DCT routines that produce reduced-size output:
+ * either 4x4, 2x2, or 1x1 pixels from an 8x8 DCT block.
+ *
+ * The implementation is based on the Loeffler, Ligtenberg and Moschytz (LL&M)
+ * algorithm used in jidctint.c.  We simply replace each 8-to-8 1-D IDCT step
+ * with an 8-to-4 step that produces the four averages of two adjacent outputs
+ * (or an 8-to-2 step producing two averages of four outputs, for 2x2 output).
+ * These steps were derived by computing the corresponding values at the end
+ * of the normal LL&M code, then simplifying as much as possible.
+ *
+ * 1x1 is trivial: just take the DC coefficient divided by 8.
+ *
+ * See jidctint.c for additional comments.
+ */
+
+#define JPEG_INTERNALS
+//#include "jinclude.h"
+//#include "jpeglib.h"
+//#include "jdct.h"     /* Private declarations for DCT subsystem */
+
+#ifdef IDCT_SCALING_SUPPORTED
+
+
+/*
+ * This module is specialized to the case DCTSIZE = 8.
+ */
+
+#if DCTSIZE != 8
+  Sorry, this code only copes with 8x8 DCTs. /* deliberate syntax err */
+#endif
+
+
+/* Scaling is the same as in jidctint.c. */
+
+#undef CONST_BITS
+#if BITS_IN_JSAMPLE == 8
+#define CONST_BITS  13
+#define PASS1_BITS  2
+#else
+#define CONST_BITS  13
+#define PASS1_BITS  1       /* lose a little precision to avoid overflow */
+#endif
+
+/* Some C compilers fail to reduce "FIX(constant)" at compile time, thus
+ * causing a lot of useless floating-point operations at run time.
+ * To get around this we use the following pre-calculated constants.
+ * If you change CONST_BITS you may want to add appropriate values.
+ * (With a reasonable C compiler, you can just rely on the FIX() macro...)
+ */
+
+#if CONST_BITS == 13
+#define FIX_0_211164243  ((INT32)  1730)    /* FIX(0.211164243) */
+#define FIX_0_509795579  ((INT32)  4176)    /* FIX(0.509795579) */
+#define FIX_0_601344887  ((INT32)  4926)    /* FIX(0.601344887) */
+#define FIX_0_720959822  ((INT32)  5906)    /* FIX(0.720959822) */
+#define FIX_0_765366865  ((INT32)  6270)    /* FIX(0.765366865) */
+#define FIX_0_850430095  ((INT32)  6967)    /* FIX(0.850430095) */
+#define FIX_0_899976223  ((INT32)  7373)    /* FIX(0.899976223) */
+#define FIX_1_061594337  ((INT32)  8697)    /* FIX(1.061594337) */
+#define FIX_1_272758580  ((INT32)  10426)   /* FIX(1.272758580) */
+#define FIX_1_451774981  ((INT32)  11893)   /* FIX(1.451774981) */
+#define FIX_1_847759065  ((INT32)  15137)   /* FIX(1.847759065) */
+#define FIX_2_172734803  ((INT32)  17799)   /* FIX(2.172734803) */
+#define FIX_2_562915447  ((INT32)  20995)   /* FIX(2.562915447) */
+#define FIX_3_624509785  ((INT32)  29692)   /* FIX(3.624509785) */
+#else
+#define FIX_0_211164243  FIX(0.211164243)
+#define FIX_0_509795579  FIX(0.509795579)
+#define FIX_0_601344887  FIX(0.601344887)
+#define FIX_0_720959822  FIX(0.720959822)
+#define FIX_0_765366865  FIX(0.765366865)
+#define FIX_0_850430095  FIX(0.850430095)
+#define FIX_0_899976223  FIX(0.899976223)
+#define FIX_1_061594337  FIX(1.061594337)
+#define FIX_1_272758580  FIX(1.272758580)
+#define FIX_1_451774981  FIX(1.451774981)
+#define FIX_1_847759065  FIX(1.847759065)
+#define FIX_2_172734803  FIX(2.172734803)
+#define FIX_2_562915447  FIX(2.562915447)
+#define FIX_3_624509785  FIX(3.624509785)
+#endif
+
+
+/* Multiply an INT32 variable by an INT32 constant to yield an INT32 result.
+ * For 8-bit samples with the recommended scaling, all the variable
+ * and constant values involved are no more than 16 bits wide, so a
+ * 16x16->32 bit multiply can be used instead of a full 32x32 multiply.
+ * For 12-bit samples, a full 32-bit multiplication will be needed.
+ */
+
+#if BITS_IN_JSAMPLE == 8
+#define jictr_MULTIPLY(var,const)  MULTIPLY16C16(var,const)
+#else
+#define jictr_MULTIPLY(var,const)  ((var) * (const))
+#endif
+
+
+/* Dequantize a coefficient by multiplying it by the multiplier-table
+ * entry; produce an int result.  In this module, both inputs and result
+ * are 16 bits or less, so either int or short multiply will work.
+ */
+
+#define jictr_DEQUANTIZE(coef,quantval)  (((ISLOW_MULT_TYPE) (coef)) * (quantval))
+
+
+/*
+ * Perform dequantization and inverse DCT on one block of coefficients,
+ * producing a reduced-size 4x4 output block.
+ */
+
+GLOBAL(void)
+jpeg_idct_4x4 (j_decompress_ptr cinfo, jpeg_component_info * compptr,
+           JCOEFPTR coef_block,
+           JSAMPARRAY output_buf, JDIMENSION output_col)
+{
+  INT32 tmp0, tmp2, tmp10, tmp12;
+  INT32 z1, z2, z3, z4;
+  JCOEFPTR inptr;
+  ISLOW_MULT_TYPE * quantptr;
+  int * wsptr;
+  JSAMPROW outptr;
+  JSAMPLE *range_limit = IDCT_range_limit(cinfo);
+  int ctr;
+  int workspace[DCTSIZE*4]; /* buffers data between passes */
+  SHIFT_TEMPS
+
+  /* Pass 1: process columns from input, store into work array. */
+
+  inptr = coef_block;
+  quantptr = (ISLOW_MULT_TYPE *) compptr->dct_table;
+  wsptr = workspace;
+  for (ctr = DCTSIZE; ctr > 0; inptr++, quantptr++, wsptr++, ctr--) {
+    /* Don't bother to process column 4, because second pass won't use it */
+    if (ctr == DCTSIZE-4)
+      continue;
+    if (inptr[DCTSIZE*1] == 0 && inptr[DCTSIZE*2] == 0 &&
+    inptr[DCTSIZE*3] == 0 && inptr[DCTSIZE*5] == 0 &&
+    inptr[DCTSIZE*6] == 0 && inptr[DCTSIZE*7] == 0) {
+      /* AC terms all zero; we need not examine term 4 for 4x4 output */
+      int dcval = jictr_DEQUANTIZE(inptr[DCTSIZE*0], quantptr[DCTSIZE*0]) << PASS1_BITS;
+
+      wsptr[DCTSIZE*0] = dcval;
+      wsptr[DCTSIZE*1] = dcval;
+      wsptr[DCTSIZE*2] = dcval;
+      wsptr[DCTSIZE*3] = dcval;
+
+      continue;
+    }
+
+    /* Even part */
+
+    tmp0 = jictr_DEQUANTIZE(inptr[DCTSIZE*0], quantptr[DCTSIZE*0]);
+    tmp0 <<= (CONST_BITS+1);
+
+    z2 = jictr_DEQUANTIZE(inptr[DCTSIZE*2], quantptr[DCTSIZE*2]);
+    z3 = jictr_DEQUANTIZE(inptr[DCTSIZE*6], quantptr[DCTSIZE*6]);
+
+    tmp2 = jictr_MULTIPLY(z2, FIX_1_847759065) + jictr_MULTIPLY(z3, - FIX_0_765366865);
+
+    tmp10 = tmp0 + tmp2;
+    tmp12 = tmp0 - tmp2;
+
+    /* Odd part */
+
+    z1 = jictr_DEQUANTIZE(inptr[DCTSIZE*7], quantptr[DCTSIZE*7]);
+    z2 = jictr_DEQUANTIZE(inptr[DCTSIZE*5], quantptr[DCTSIZE*5]);
+    z3 = jictr_DEQUANTIZE(inptr[DCTSIZE*3], quantptr[DCTSIZE*3]);
+    z4 = jictr_DEQUANTIZE(inptr[DCTSIZE*1], quantptr[DCTSIZE*1]);
+
+    tmp0 = jictr_MULTIPLY(z1, - FIX_0_211164243) /* sqrt(2) * (c3-c1) */
+     + jictr_MULTIPLY(z2, FIX_1_451774981) /* sqrt(2) * (c3+c7) */
+     + jictr_MULTIPLY(z3, - FIX_2_172734803) /* sqrt(2) * (-c1-c5) */
+     + jictr_MULTIPLY(z4, FIX_1_061594337); /* sqrt(2) * (c5+c7) */
+
+    tmp2 = jictr_MULTIPLY(z1, - FIX_0_509795579) /* sqrt(2) * (c7-c5) */
+     + jictr_MULTIPLY(z2, - FIX_0_601344887) /* sqrt(2) * (c5-c1) */
+     + jictr_MULTIPLY(z3, FIX_0_899976223) /* sqrt(2) * (c3-c7) */
+     + jictr_MULTIPLY(z4, FIX_2_562915447); /* sqrt(2) * (c1+c3) */
+
+    /* Final output stage */
+
+    wsptr[DCTSIZE*0] = (int) DESCALE(tmp10 + tmp2, CONST_BITS-PASS1_BITS+1);
+    wsptr[DCTSIZE*3] = (int) DESCALE(tmp10 - tmp2, CONST_BITS-PASS1_BITS+1);
+    wsptr[DCTSIZE*1] = (int) DESCALE(tmp12 + tmp0, CONST_BITS-PASS1_BITS+1);
+    wsptr[DCTSIZE*2] = (int) DESCALE(tmp12 - tmp0, CONST_BITS-PASS1_BITS+1);
+  }
+
+  /* Pass 2: process 4 rows from work array, store into output array. */
+
+  wsptr = workspace;
+  for (ctr = 0; ctr < 4; ctr++) {
+    outptr = output_buf[ctr] + output_col;
+    /* It's not clear whether a zero row test is worthwhile here ... */
+
+#ifndef NO_ZERO_ROW_TEST
+    if (wsptr[1] == 0 && wsptr[2] == 0 && wsptr[3] == 0 &&
+    wsptr[5] == 0 && wsptr[6] == 0 && wsptr[7] == 0) {
+      /* AC terms all zero */
+      JSAMPLE dcval = range_limit[(int) DESCALE((INT32) wsptr[0], PASS1_BITS+3)
+                  & RANGE_MASK];
+
+      outptr[0] = dcval;
+      outptr[1] = dcval;
+      outptr[2] = dcval;
+      outptr[3] = dcval;
+
+      wsptr += DCTSIZE;     /* advance pointer to next row */
+      continue;
+    }
+#endif
+
+    /* Even part */
+
+    tmp0 = ((INT32) wsptr[0]) << (CONST_BITS+1);
+
+    tmp2 = jictr_MULTIPLY((INT32) wsptr[2], FIX_1_847759065)
+     + jictr_MULTIPLY((INT32) wsptr[6], - FIX_0_765366865);
+
+    tmp10 = tmp0 + tmp2;
+    tmp12 = tmp0 - tmp2;
+
+    /* Odd part */
+
+    z1 = (INT32) wsptr[7];
+    z2 = (INT32) wsptr[5];
+    z3 = (INT32) wsptr[3];
+    z4 = (INT32) wsptr[1];
+
+    tmp0 = jictr_MULTIPLY(z1, - FIX_0_211164243) /* sqrt(2) * (c3-c1) */
+     + jictr_MULTIPLY(z2, FIX_1_451774981) /* sqrt(2) * (c3+c7) */
+     + jictr_MULTIPLY(z3, - FIX_2_172734803) /* sqrt(2) * (-c1-c5) */
+     + jictr_MULTIPLY(z4, FIX_1_061594337); /* sqrt(2) * (c5+c7) */
+
+    tmp2 = jictr_MULTIPLY(z1, - FIX_0_509795579) /* sqrt(2) * (c7-c5) */
+     + jictr_MULTIPLY(z2, - FIX_0_601344887) /* sqrt(2) * (c5-c1) */
+     + jictr_MULTIPLY(z3, FIX_0_899976223) /* sqrt(2) * (c3-c7) */
+     + jictr_MULTIPLY(z4, FIX_2_562915447); /* sqrt(2) * (c1+c3) */
+
+    /* Final output stage */
+
+    outptr[0] = range_limit[(int) DESCALE(tmp10 + tmp2,
+                      CONST_BITS+PASS1_BITS+3+1)
+                & RANGE_MASK];
+    outptr[3] = range_limit[(int) DESCALE(tmp10 - tmp2,
+                      CONST_BITS+PASS1_BITS+3+1)
+                & RANGE_MASK];
+    outptr[1] = range_limit[(int) DESCALE(tmp12 + tmp0,
+                      CONST_BITS+PASS1_BITS+3+1)
+                & RANGE_MASK];
+    outptr[2] = range_limit[(int) DESCALE(tmp12 - tmp0,
+                      CONST_BITS+PASS1_BITS+3+1)
+                & RANGE_MASK];
+
+    wsptr += DCTSIZE;       /* advance pointer to next row */
+  }
+}
+
+
+/*
+ * Perform dequantization and inverse DCT on one block of coefficients,
+ * producing a reduced-size 2x2 output block.
+ */
+
+GLOBAL(void)
+jpeg_idct_2x2 (j_decompress_ptr cinfo, jpeg_component_info * compptr,
+           JCOEFPTR coef_block,
+           JSAMPARRAY output_buf, JDIMENSION output_col)
+{
+  INT32 tmp0, tmp10, z1;
+  JCOEFPTR inptr;
+  ISLOW_MULT_TYPE * quantptr;
+  int * wsptr;
+  JSAMPROW outptr;
+  JSAMPLE *range_limit = IDCT_range_limit(cinfo);
+  int ctr;
+  int workspace[DCTSIZE*2]; /* buffers data between passes */
+  SHIFT_TEMPS
+
+  /* Pass 1: process columns from input, store into work array. */
+
+  inptr = coef_block;
+  quantptr = (ISLOW_MULT_TYPE *) compptr->dct_table;
+  wsptr = workspace;
+  for (ctr = DCTSIZE; ctr > 0; inptr++, quantptr++, wsptr++, ctr--) {
+    /* Don't bother to process columns 2,4,6 */
+    if (ctr == DCTSIZE-2 || ctr == DCTSIZE-4 || ctr == DCTSIZE-6)
+      continue;
+    if (inptr[DCTSIZE*1] == 0 && inptr[DCTSIZE*3] == 0 &&
+    inptr[DCTSIZE*5] == 0 && inptr[DCTSIZE*7] == 0) {
+      /* AC terms all zero; we need not examine terms 2,4,6 for 2x2 output */
+      int dcval = jictr_DEQUANTIZE(inptr[DCTSIZE*0], quantptr[DCTSIZE*0]) << PASS1_BITS;
+
+      wsptr[DCTSIZE*0] = dcval;
+      wsptr[DCTSIZE*1] = dcval;
+
+      continue;
+    }
+
+    /* Even part */
+
+    z1 = jictr_DEQUANTIZE(inptr[DCTSIZE*0], quantptr[DCTSIZE*0]);
+    tmp10 = z1 << (CONST_BITS+2);
+
+    /* Odd part */
+
+    z1 = jictr_DEQUANTIZE(inptr[DCTSIZE*7], quantptr[DCTSIZE*7]);
+    tmp0 = jictr_MULTIPLY(z1, - FIX_0_720959822); /* sqrt(2) * (c7-c5+c3-c1) */
+    z1 = jictr_DEQUANTIZE(inptr[DCTSIZE*5], quantptr[DCTSIZE*5]);
+    tmp0 += jictr_MULTIPLY(z1, FIX_0_850430095); /* sqrt(2) * (-c1+c3+c5+c7) */
+    z1 = jictr_DEQUANTIZE(inptr[DCTSIZE*3], quantptr[DCTSIZE*3]);
+    tmp0 += jictr_MULTIPLY(z1, - FIX_1_272758580); /* sqrt(2) * (-c1+c3-c5-c7) */
+    z1 = jictr_DEQUANTIZE(inptr[DCTSIZE*1], quantptr[DCTSIZE*1]);
+    tmp0 += jictr_MULTIPLY(z1, FIX_3_624509785); /* sqrt(2) * (c1+c3+c5+c7) */
+
+    /* Final output stage */
+
+    wsptr[DCTSIZE*0] = (int) DESCALE(tmp10 + tmp0, CONST_BITS-PASS1_BITS+2);
+    wsptr[DCTSIZE*1] = (int) DESCALE(tmp10 - tmp0, CONST_BITS-PASS1_BITS+2);
+  }
+
+  /* Pass 2: process 2 rows from work array, store into output array. */
+
+  wsptr = workspace;
+  for (ctr = 0; ctr < 2; ctr++) {
+    outptr = output_buf[ctr] + output_col;
+    /* It's not clear whether a zero row test is worthwhile here ... */
+
+#ifndef NO_ZERO_ROW_TEST
+    if (wsptr[1] == 0 && wsptr[3] == 0 && wsptr[5] == 0 && wsptr[7] == 0) {
+      /* AC terms all zero */
+      JSAMPLE dcval = range_limit[(int) DESCALE((INT32) wsptr[0], PASS1_BITS+3)
+                  & RANGE_MASK];
+
+      outptr[0] = dcval;
+      outptr[1] = dcval;
+
+      wsptr += DCTSIZE;     /* advance pointer to next row */
+      continue;
+    }
+#endif
+
+    /* Even part */
+
+    tmp10 = ((INT32) wsptr[0]) << (CONST_BITS+2);
+
+    /* Odd part */
+
+    tmp0 = jictr_MULTIPLY((INT32) wsptr[7], - FIX_0_720959822) /* sqrt(2) * (c7-c5+c3-c1) */
+     + jictr_MULTIPLY((INT32) wsptr[5], FIX_0_850430095) /* sqrt(2) * (-c1+c3+c5+c7) */
+     + jictr_MULTIPLY((INT32) wsptr[3], - FIX_1_272758580) /* sqrt(2) * (-c1+c3-c5-c7) */
+     + jictr_MULTIPLY((INT32) wsptr[1], FIX_3_624509785); /* sqrt(2) * (c1+c3+c5+c7) */
+
+    /* Final output stage */
+
+    outptr[0] = range_limit[(int) DESCALE(tmp10 + tmp0,
+                      CONST_BITS+PASS1_BITS+3+2)
+                & RANGE_MASK];
+    outptr[1] = range_limit[(int) DESCALE(tmp10 - tmp0,
+                      CONST_BITS+PASS1_BITS+3+2)
+                & RANGE_MASK];
+
+    wsptr += DCTSIZE;       /* advance pointer to next row */
+  }
+}
+
+
+/*
+ * Perform dequantization and inverse DCT on one block of coefficients,
+ * producing a reduced-size 1x1 output block.
+ */
+
+GLOBAL(void)
+jpeg_idct_1x1 (j_decompress_ptr cinfo, jpeg_component_info * compptr,
+           JCOEFPTR coef_block,
+           JSAMPARRAY output_buf, JDIMENSION output_col)
+{
+  int dcval;
+  ISLOW_MULT_TYPE * quantptr;
+  JSAMPLE *range_limit = IDCT_range_limit(cinfo);
+  SHIFT_TEMPS
+
+  /* We hardly need an inverse DCT routine for this: just take the
+   * average pixel value, which is one-eighth of the DC coefficient.
+   */
+  quantptr = (ISLOW_MULT_TYPE *) compptr->dct_table;
+  dcval = jictr_DEQUANTIZE(coef_block[0], quantptr[0]);
+  dcval = (int) DESCALE((INT32) dcval, 3);
+
+  output_buf[0][output_col] = range_limit[dcval & RANGE_MASK];
+}
+
+#endif /* IDCT_SCALING_SUPPORTED */
+/*
+ * jsimd.c
+ *
+ * AVX2 version of jpeg_idct_islow() (see jidctint.c), for the REBOL build.
+ *
+ * The C code transforms one column, then one row, at a time.  Here each
+ * 256-bit register holds a whole row of eight 32-bit values, so the same
+ * LL&M butterflies transform all eight columns at once; transposing the
+ * block then lets the second pass do all eight rows at once.  The arithmetic
+ * is exactly that of the C code: all the multiplies, roundings and shifts
+ * are done on 32-bit values, so the output is bit-for-bit the same.  (The
+ * C code's zero-AC shortcuts give the same values as the full computation,
+ * and the range limiting below reproduces the range_limit[] table lookup,
+ * including its wraparound of values that are far out of range.)
+ */
+
+#ifdef JPEG_SIMD
+
+#include <cpuid.h>
+#include <immintrin.h>
+
+static int jpeg_avx2 = -1; /* not checked yet */
+
+/*
+ * Check (once) for AVX2, and that the OS saves the YMM registers.
+ */
+
+GLOBAL(boolean)
+jpeg_simd_avx2 (void)
+{
+  if (jpeg_avx2 < 0) {
+    unsigned int a, b, c, d;
+    jpeg_avx2 = 0;
+    if (__get_cpuid(1, &a, &b, &c, &d)
+        && (c & bit_OSXSAVE) && (c & bit_AVX)) {
+      unsigned int xcr0_lo, xcr0_hi;
+      __asm__ ("xgetbv" : "=a" (xcr0_lo), "=d" (xcr0_hi) : "c" (0));
+      if ((xcr0_lo & 6) == 6
+          && __get_cpuid_count(7, 0, &a, &b, &c, &d) && (b & bit_AVX2))
+        jpeg_avx2 = 1;
+    }
+  }
+  return (boolean) jpeg_avx2;
+}
+
+
+#ifdef DCT_ISLOW_SUPPORTED
+
+#define JSIMD_MUL(x,k)  _mm256_mullo_epi32((x), _mm256_set1_epi32(k))
+
+/* One 1-D IDCT step across v[0..7], as in jpeg_idct_islow(),
+ * leaving the results descaled by n bits.
+ */
+
+INLINE LOCAL(void) JPEG_SIMD_TARGET
+jsimd_idct_1d (__m256i v[DCTSIZE], int n)
+{
+  __m256i tmp0, tmp1, tmp2, tmp3, tmp10, tmp11, tmp12, tmp13;
+  __m256i z1, z2, z3, z4, z5;
+  __m256i round = _mm256_set1_epi32(1 << (n-1));
+  __m128i shift = _mm_cvtsi32_si128(n);
+
+  /* Even part */
+
+  z2 = v[2];
+  z3 = v[6];
+
+  z1 = JSIMD_MUL(_mm256_add_epi32(z2, z3), FIX_0_541196100);
+  tmp2 = _mm256_add_epi32(z1, JSIMD_MUL(z3, - FIX_1_847759065));
+  tmp3 = _mm256_add_epi32(z1, JSIMD_MUL(z2, FIX_0_765366865));
+
+  tmp0 = _mm256_slli_epi32(_mm256_add_epi32(v[0], v[4]), CONST_BITS);
+  tmp1 = _mm256_slli_epi32(_mm256_sub_epi32(v[0], v[4]), CONST_BITS);
+
+  tmp10 = _mm256_add_epi32(tmp0, tmp3);
+  tmp13 = _mm256_sub_epi32(tmp0, tmp3);
+  tmp11 = _mm256_add_epi32(tmp1, tmp2);
+  tmp12 = _mm256_sub_epi32(tmp1, tmp2);
+
+  /* Odd part */
+
+  tmp0 = v[7];
+  tmp1 = v[5];
+  tmp2 = v[3];
+  tmp3 = v[1];
+
+  z1 = _mm256_add_epi32(tmp0, tmp3);
+  z2 = _mm256_add_epi32(tmp1, tmp2);
+  z3 = _mm256_add_epi32(tmp0, tmp2);
+  z4 = _mm256_add_epi32(tmp1, tmp3);
+  z5 = JSIMD_MUL(_mm256_add_epi32(z3, z4), FIX_1_175875602);
+
+  tmp0 = JSIMD_MUL(tmp0, FIX_0_298631336);
+  tmp1 = JSIMD_MUL(tmp1, FIX_2_053119869);
+  tmp2 = JSIMD_MUL(tmp2, FIX_3_072711026);
+  tmp3 = JSIMD_MUL(tmp3, FIX_1_501321110);
+  z1 = JSIMD_MUL(z1, - FIX_0_899976223);
+  z2 = JSIMD_MUL(z2, - FIX_2_562915447);
+  z3 = _mm256_add_epi32(JSIMD_MUL(z3, - FIX_1_961570560), z5);
+  z4 = _mm256_add_epi32(JSIMD_MUL(z4, - FIX_0_390180644), z5);
+
+  tmp0 = _mm256_add_epi32(tmp0, _mm256_add_epi32(z1, z3));
+  tmp1 = _mm256_add_epi32(tmp1, _mm256_add_epi32(z2, z4));
+  tmp2 = _mm256_add_epi32(tmp2, _mm256_add_epi32(z2, z3));
+  tmp3 = _mm256_add_epi32(tmp3, _mm256_add_epi32(z1, z4));
+
+  /* Final output stage, with rounding */
+
+  tmp10 = _mm256_add_epi32(tmp10, round);
+  tmp11 = _mm256_add_epi32(tmp11, round);
+  tmp12 = _mm256_add_epi32(tmp12, round);
+  tmp13 = _mm256_add_epi32(tmp13, round);
+
+  v[0] = _mm256_sra_epi32(_mm256_add_epi32(tmp10, tmp3), shift);
+  v[7] = _mm256_sra_epi32(_mm256_sub_epi32(tmp10, tmp3), shift);
+  v[1] = _mm256_sra_epi32(_mm256_add_epi32(tmp11, tmp2), shift);
+  v[6] = _mm256_sra_epi32(_mm256_sub_epi32(tmp11, tmp2), shift);
+  v[2] = _mm256_sra_epi32(_mm256_add_epi32(tmp12, tmp1), shift);
+  v[5] = _mm256_sra_epi32(_mm256_sub_epi32(tmp12, tmp1), shift);
+  v[3] = _mm256_sra_epi32(_mm256_add_epi32(tmp13, tmp0), shift);
+  v[4] = _mm256_sra_epi32(_mm256_sub_epi32(tmp13, tmp0), shift);
+}
+
+
+/* Transpose an 8x8 block of 32-bit values held one row per register. */
+
+INLINE LOCAL(void) JPEG_SIMD_TARGET
+jsimd_transpose (__m256i v[DCTSIZE])
+{
+  __m256i t0, t1, t2, t3, t4, t5, t6, t7;
+  __m256i u0, u1, u2, u3, u4, u5, u6, u7;
+
+  t0 = _mm256_unpacklo_epi32(v[0], v[1]);
+  t1 = _mm256_unpackhi_epi32(v[0], v[1]);
+  t2 = _mm256_unpacklo_epi32(v[2], v[3]);
+  t3 = _mm256_unpackhi_epi32(v[2], v[3]);
+  t4 = _mm256_unpacklo_epi32(v[4], v[5]);
+  t5 = _mm256_unpackhi_epi32(v[4], v[5]);
+  t6 = _mm256_unpacklo_epi32(v[6], v[7]);
+  t7 = _mm256_unpackhi_epi32(v[6], v[7]);
+
+  u0 = _mm256_unpacklo_epi64(t0, t2);
+  u1 = _mm256_unpackhi_epi64(t0, t2);
+  u2 = _mm256_unpacklo_epi64(t1, t3);
+  u3 = _mm256_unpackhi_epi64(t1, t3);
+  u4 = _mm256_unpacklo_epi64(t4, t6);
+  u5 = _mm256_unpackhi_epi64(t4, t6);
+  u6 = _mm256_unpacklo_epi64(t5, t7);
+  u7 = _mm256_unpackhi_epi64(t5, t7);
+
+  v[0] = _mm256_permute2x128_si256(u0, u4, 0x20);
+  v[1] = _mm256_permute2x128_si256(u1, u5, 0x20);
+  v[2] = _mm256_permute2x128_si256(u2, u6, 0x20);
+  v[3] = _mm256_permute2x128_si256(u3, u7, 0x20);
+  v[4] = _mm256_permute2x128_si256(u0, u4, 0x31);
+  v[5] = _mm256_permute2x128_si256(u1, u5, 0x31);
+  v[6] = _mm256_permute2x128_si256(u2, u6, 0x31);
+  v[7] = _mm256_permute2x128_si256(u3, u7, 0x31);
+}
+
+
+/*
+ * Perform dequantization and inverse DCT on one block of coefficients.
+ */
+
+GLOBAL(void) JPEG_SIMD_TARGET
+jpeg_idct_islow_avx2 (j_decompress_ptr cinfo, jpeg_component_info * compptr,
+              JCOEFPTR coef_block,
+              JSAMPARRAY output_buf, JDIMENSION output_col)
+{
+  ISLOW_MULT_TYPE * quantptr = (ISLOW_MULT_TYPE *) compptr->dct_table;
+  __m256i v[DCTSIZE];
+  __m256i center = _mm256_set1_epi32(CENTERJSAMPLE);
+  __m256i zero = _mm256_setzero_si256();
+  __m256i maxval = _mm256_set1_epi32(MAXJSAMPLE);
+  __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+  int row;
+
+#if BITS_IN_JSAMPLE != 8 || CONST_BITS != 13 || PASS1_BITS != 2
+  Sorry, this code only copes with 8-bit samples. /* deliberate syntax err */
+#endif
+
+  /* Dequantize: v[row] holds row "row" of the coefficients. */
+
+  for (row = 0; row < DCTSIZE; row++) {
+    __m256i coef = _mm256_cvtepi16_epi32(
+        _mm_loadu_si128((const __m128i *) (coef_block + row * DCTSIZE)));
+    __m256i quant = (SIZEOF(ISLOW_MULT_TYPE) == 2)
+      ? _mm256_cvtepi16_epi32(
+          _mm_loadu_si128((const __m128i *) (quantptr + row * DCTSIZE)))
+      : _mm256_loadu_si256((const __m256i *) (quantptr + row * DCTSIZE));
+    v[row] = _mm256_mullo_epi32(coef, quant);
+  }
+
+  /* Pass 1: process all columns, leaving the results scaled up by
+   * 2**PASS1_BITS as in the workspace of the C code.
+   */
+
+  jsimd_idct_1d(v, CONST_BITS-PASS1_BITS);
+
+  /* Pass 2: process all rows, then transpose back so each register
+   * holds a row of output samples.
+   */
+
+  jsimd_transpose(v);
+  jsimd_idct_1d(v, CONST_BITS+PASS1_BITS+3);
+  jsimd_transpose(v);
+
+  /* Range limit: sign-extend the low 10 bits (the "& RANGE_MASK"), then
+   * clamp after adding CENTERJSAMPLE, which is what range_limit[] holds.
+   * Then pack four rows at a time down to bytes.
+   */
+
+  for (row = 0; row < DCTSIZE; row++) {
+    v[row] = _mm256_srai_epi32(_mm256_slli_epi32(v[row], 22), 22);
+    v[row] = _mm256_add_epi32(v[row], center);
+    v[row] = _mm256_min_epi32(_mm256_max_epi32(v[row], zero), maxval);
+  }
+
+  for (row = 0; row < DCTSIZE; row += 4) {
+    __m256i bytes = _mm256_packus_epi16(
+      _mm256_packs_epi32(v[row], v[row+1]),
+      _mm256_packs_epi32(v[row+2], v[row+3])
+    );
+    __m128i lo, hi;
+    bytes = _mm256_permutevar8x32_epi32(bytes, order);
+    lo = _mm256_castsi256_si128(bytes);
+    hi = _mm256_extracti128_si256(bytes, 1);
+    _mm_storel_epi64((__m128i *) (output_buf[row] + output_col), lo);
+    _mm_storel_epi64((__m128i *) (output_buf[row+1] + output_col),
+             _mm_unpackhi_epi64(lo, lo));
+    _mm_storel_epi64((__m128i *) (output_buf[row+2] + output_col), hi);
+    _mm_storel_epi64((__m128i *) (output_buf[row+3] + output_col),
+             _mm_unpackhi_epi64(hi, hi));
+  }
+}
+
+#endif /* DCT_ISLOW_SUPPORTED */
+
+#endif /* JPEG_SIMD */
 /*
  * jdsample.c
  *
@@ -7514,6 +8166,157 @@ ycck_cmyk_convert (j_decompress_ptr cinfo,
   }
 }
 
+/**************** Conversion to REBOL image pixels **************/
+
+/*
+ * For JCS_PIXEL output each pixel is one 32-bit TO_PIXEL_COLOR() value with
+ * full alpha, so the application can read scanlines straight into an image.
+ * This saves a pass over the image to widen 3-byte RGB, and the planar
+ * input is what SIMD code wants.  YCbCr input uses the same arithmetic as
+ * ycc_rgb_convert(), so the colors are exactly the same.
+ */
+
+#ifdef JPEG_SIMD
+
+/*
+ * AVX2 YCbCr->pixel conversion of the first (num_cols & ~7) columns of a
+ * row; returns how many it did.  The table entries are computed on the fly
+ * with the formulas from build_ycc_rgb_table().
+ */
+
+LOCAL(JDIMENSION) JPEG_SIMD_TARGET
+ycc_pixel_convert_avx2 (JSAMPROW inptr0, JSAMPROW inptr1, JSAMPROW inptr2,
+            uinteger32 * outptr, JDIMENSION num_cols)
+{
+  __m256i center = _mm256_set1_epi32(CENTERJSAMPLE);
+  __m256i half = _mm256_set1_epi32(ONE_HALF);
+  __m256i zero = _mm256_setzero_si256();
+  __m256i maxval = _mm256_set1_epi32(MAXJSAMPLE);
+  __m256i alpha = _mm256_set1_epi32((int) TO_PIXEL_COLOR(0, 0, 0, 0xff));
+  __m128i r_shift = _mm_cvtsi32_si128(__builtin_ctz(TO_PIXEL_COLOR(1, 0, 0, 0)));
+  __m128i g_shift = _mm_cvtsi32_si128(__builtin_ctz(TO_PIXEL_COLOR(0, 1, 0, 0)));
+  __m128i b_shift = _mm_cvtsi32_si128(__builtin_ctz(TO_PIXEL_COLOR(0, 0, 1, 0)));
+  JDIMENSION col;
+
+  for (col = 0; col + 8 <= num_cols; col += 8) {
+    __m256i y = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *) (inptr0 + col)));
+    __m256i cb = _mm256_sub_epi32(
+      _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *) (inptr1 + col))), center);
+    __m256i cr = _mm256_sub_epi32(
+      _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *) (inptr2 + col))), center);
+    __m256i r, g, b;
+
+    r = _mm256_mullo_epi32(cr, _mm256_set1_epi32(jdol_FIX(1.40200)));
+    r = _mm256_srai_epi32(_mm256_add_epi32(r, half), SCALEBITS);
+    b = _mm256_mullo_epi32(cb, _mm256_set1_epi32(jdol_FIX(1.77200)));
+    b = _mm256_srai_epi32(_mm256_add_epi32(b, half), SCALEBITS);
+    g = _mm256_add_epi32(
+      _mm256_mullo_epi32(cb, _mm256_set1_epi32(- jdol_FIX(0.34414))),
+      _mm256_mullo_epi32(cr, _mm256_set1_epi32(- jdol_FIX(0.71414))));
+    g = _mm256_srai_epi32(_mm256_add_epi32(g, half), SCALEBITS);
+
+    r = _mm256_min_epi32(_mm256_max_epi32(_mm256_add_epi32(y, r), zero), maxval);
+    g = _mm256_min_epi32(_mm256_max_epi32(_mm256_add_epi32(y, g), zero), maxval);
+    b = _mm256_min_epi32(_mm256_max_epi32(_mm256_add_epi32(y, b), zero), maxval);
+
+    _mm256_storeu_si256((__m256i *) (outptr + col), _mm256_or_si256(
+      _mm256_or_si256(alpha, _mm256_sll_epi32(r, r_shift)),
+      _mm256_or_si256(_mm256_sll_epi32(g, g_shift), _mm256_sll_epi32(b, b_shift))));
+  }
+  return col;
+}
+
+#endif /* JPEG_SIMD */
+
+
+METHODDEF(void)
+ycc_pixel_convert (j_decompress_ptr cinfo,
+           JSAMPIMAGE input_buf, JDIMENSION input_row,
+           JSAMPARRAY output_buf, int num_rows)
+{
+  my_cconvert_ptr cconvert = (my_cconvert_ptr) cinfo->cconvert;
+  int y, cb, cr;
+  uinteger32 * outptr;
+  JSAMPROW inptr0, inptr1, inptr2;
+  JDIMENSION col;
+  JDIMENSION num_cols = cinfo->output_width;
+  /* copy these pointers into registers if possible */
+  JSAMPLE * range_limit = cinfo->sample_range_limit;
+  int * Crrtab = cconvert->Cr_r_tab;
+  int * Cbbtab = cconvert->Cb_b_tab;
+  INT32 * Crgtab = cconvert->Cr_g_tab;
+  INT32 * Cbgtab = cconvert->Cb_g_tab;
+#ifdef JPEG_SIMD
+  boolean avx2 = jpeg_simd_avx2();
+#endif
+  SHIFT_TEMPS
+
+  while (--num_rows >= 0) {
+    inptr0 = input_buf[0][input_row];
+    inptr1 = input_buf[1][input_row];
+    inptr2 = input_buf[2][input_row];
+    input_row++;
+    outptr = (uinteger32 *) *output_buf++;
+    col = 0;
+#ifdef JPEG_SIMD
+    if (avx2)
+      col = ycc_pixel_convert_avx2(inptr0, inptr1, inptr2, outptr, num_cols);
+#endif
+    for (; col < num_cols; col++) {
+      y  = GETJSAMPLE(inptr0[col]);
+      cb = GETJSAMPLE(inptr1[col]);
+      cr = GETJSAMPLE(inptr2[col]);
+      outptr[col] = TO_PIXEL_COLOR(
+        range_limit[y + Crrtab[cr]],
+        range_limit[y + ((int) RIGHT_SHIFT(Cbgtab[cb] + Crgtab[cr], SCALEBITS))],
+        range_limit[y + Cbbtab[cb]],
+        0xff
+      );
+    }
+  }
+}
+
+
+METHODDEF(void)
+rgb_pixel_convert (j_decompress_ptr cinfo,
+           JSAMPIMAGE input_buf, JDIMENSION input_row,
+           JSAMPARRAY output_buf, int num_rows)
+{
+  uinteger32 * outptr;
+  JSAMPROW inptr0, inptr1, inptr2;
+  JDIMENSION col;
+  JDIMENSION num_cols = cinfo->output_width;
+
+  while (--num_rows >= 0) {
+    inptr0 = input_buf[0][input_row];
+    inptr1 = input_buf[1][input_row];
+    inptr2 = input_buf[2][input_row];
+    input_row++;
+    outptr = (uinteger32 *) *output_buf++;
+    for (col = 0; col < num_cols; col++)
+      outptr[col] = TO_PIXEL_COLOR(inptr0[col], inptr1[col], inptr2[col], 0xff);
+  }
+}
+
+
+METHODDEF(void)
+gray_pixel_convert (j_decompress_ptr cinfo,
+            JSAMPIMAGE input_buf, JDIMENSION input_row,
+            JSAMPARRAY output_buf, int num_rows)
+{
+  uinteger32 * outptr;
+  JSAMPROW inptr;
+  JDIMENSION col;
+  JDIMENSION num_cols = cinfo->output_width;
+
+  while (--num_rows >= 0) {
+    inptr = input_buf[0][input_row++];
+    outptr = (uinteger32 *) *output_buf++;
+    for (col = 0; col < num_cols; col++)
+      outptr[col] = TO_PIXEL_COLOR(inptr[col], inptr[col], inptr[col], 0xff);
+  }
+}
+
 
 /*
  * Empty method for start_pass.
@@ -7598,6 +8401,19 @@ jinit_color_deconverter (j_decompress_ptr cinfo)
       ERREXIT(cinfo, JERR_CONVERSION_NOTIMPL);
     break;
 
+  case JCS_PIXEL:
+    cinfo->out_color_components = 4;
+    if (cinfo->jpeg_color_space == JCS_YCbCr) {
+      cconvert->pub.color_convert = ycc_pixel_convert;
+      build_ycc_rgb_table(cinfo);
+    } else if (cinfo->jpeg_color_space == JCS_GRAYSCALE) {
+      cconvert->pub.color_convert = gray_pixel_convert;
+    } else if (cinfo->jpeg_color_space == JCS_RGB) {
+      cconvert->pub.color_convert = rgb_pixel_convert;
+    } else
+      ERREXIT(cinfo, JERR_CONVERSION_NOTIMPL);
+    break;
+
   case JCS_CMYK:
     cinfo->out_color_components = 4;
     if (cinfo->jpeg_color_space == JCS_YCCK) {
@@ -7942,7 +8758,7 @@ jzero_far (void FAR * target, size_t bytestozero)
  * or jpeg_destroy) at some point.
  */
 
-jmp_buf jpeg_state;
+THREAD_LOCAL jmp_buf jpeg_state;
 
 METHODDEF(void)
 error_exit (j_common_ptr cinfo)
@@ -10839,15 +11655,23 @@ REBINT Codec_JPEG_Image(int action, REBCDI *codi)
 
     if (action == CODI_ACT_IDENTIFY) {
         int w, h;
-        jpeg_info(s_cast(codi->data), codi->len, &w, &h); // may longjmp above
+        jpeg_info(s_cast(codi->data), codi->len, 1, &w, &h); // may longjmp
         return CODI_CHECK;
     }
 
     if (action == CODI_ACT_DECODE) {
+        //
+        // DCT scaling: with codi->scale of 2, 4 or 8 the IDCT produces the
+        // reduced image directly, much faster than decoding at full size
+        // and shrinking afterwards.
+        //
         int w, h;
-        jpeg_info(s_cast(codi->data), codi->len, &w, &h); // also may longjmp
+        jpeg_info(s_cast(codi->data), codi->len, codi->scale, &w, &h);
         codi->extra.bits = ALLOC_N(u32, w * h);
-        jpeg_load(s_cast(codi->data), codi->len, cast(char*, codi->extra.bits));
+        jpeg_load(
+            s_cast(codi->data), codi->len, codi->scale,
+            cast(char*, codi->extra.bits)
+        );
         codi->w = w;
         codi->h = h;
         return CODI_IMAGE;
@@ -443,7 +443,7 @@ static REBIXO Parse_String_One_Rule(REBFRM *f, const RELVAL *rule) {
     case REB_EMAIL:
     case REB_STRING:
     case REB_BINARY: {
-        REBCNT index = Find_Str_Str(
+        REBLEN index = Find_Str_Str(
             P_INPUT,
             0,
             P_POS,
@@ -465,7 +465,7 @@ static REBIXO Parse_String_One_Rule(REBFRM *f, const RELVAL *rule) {
         // actual series data.  This FORMs it, but could be more optimized.
         //
         REBSER *formed = Copy_Form_Value(rule, 0);
-        REBCNT index = Find_Str_Str(
+        REBLEN index = Find_Str_Str(
             P_INPUT,
             0,
             P_POS,
@@ -559,7 +559,7 @@ static REBIXO Parse_String_One_Rule(REBFRM *f, const RELVAL *rule) {
 //
 static REBIXO Parse_Array_One_Rule_Core(
     REBFRM *f,
-    REBCNT pos,
+    REBLEN pos,
     const RELVAL *rule
 ) {
     REBARR *array = AS_ARRAY(P_INPUT);
@@ -637,7 +637,7 @@ static REBIXO Parse_Array_One_Rule_Core(
         // Hence the return value regarding whether a match occurred or not
         // has to be based on the result that comes back in P_OUT.
         //
-        REBCNT pos_before = P_POS;
+        REBLEN pos_before = P_POS;
         REBOOL interrupted;
 
         P_POS = pos; // modify input position
@@ -709,7 +709,7 @@ static REBIXO To_Thru_Block_Rule(
 
     RELVAL *blk;
 
-    REBCNT pos = P_POS;
+    REBLEN pos = P_POS;
     for (; pos <= SER_LEN(P_INPUT); ++pos) {
         blk = VAL_ARRAY_HEAD(rule_block);
         for (; NOT_END(blk); blk++) {
@@ -772,7 +772,7 @@ static REBIXO To_Thru_Block_Rule(
                 }
 
                 if (i != END_FLAG) {
-                    pos = cast(REBCNT, i);
+                    pos = cast(REBLEN, i);
                     if (!is_thru) pos--; // passed it, so back up if only TO...
                     goto found;
                 }
@@ -792,7 +792,7 @@ static REBIXO To_Thru_Block_Rule(
                 }
                 else if (IS_BINARY(rule)) {
                     if (ch1 == *VAL_BIN_AT(rule)) {
-                        REBCNT len = VAL_LEN_AT(rule);
+                        REBLEN len = VAL_LEN_AT(rule);
                         if (len == 1) {
                             if (is_thru) ++pos;
                             goto found;
@@ -853,8 +853,8 @@ static REBIXO To_Thru_Block_Rule(
                         // inefficient in the sense that it forms the tag
                         //
                         REBSER *formed = Copy_Form_Value(rule, 0);
-                        REBCNT len = SER_LEN(formed);
-                        REBCNT i = Find_Str_Str(
+                        REBLEN len = SER_LEN(formed);
+                        REBLEN i = Find_Str_Str(
                             P_INPUT,
                             0,
                             pos,
@@ -878,13 +878,13 @@ static REBIXO To_Thru_Block_Rule(
                     if (!P_HAS_CASE) ch2 = UP_CASE(ch2);
 
                     if (ch == ch2) {
-                        REBCNT len = VAL_LEN_AT(rule);
+                        REBLEN len = VAL_LEN_AT(rule);
                         if (len == 1) {
                             if (is_thru) ++pos;
                             goto found;
                         }
 
-                        REBCNT i = Find_Str_Str(
+                        REBLEN i = Find_Str_Str(
                             P_INPUT,
                             0,
                             pos,
@@ -970,7 +970,7 @@ static REBIXO To_Thru_Non_Block_Rule(
         // !!! Negative numbers get cast to large integers, needs error!
         // But also, should there be an option for relative addressing?
         //
-        REBCNT i = cast(REBCNT, Int32(const_KNOWN(rule))) - (is_thru ? 0 : 1);
+        REBLEN i = cast(REBLEN, Int32(const_KNOWN(rule))) - (is_thru ? 0 : 1);
         if (i > SER_LEN(P_INPUT))
             return SER_LEN(P_INPUT);
         return i;
@@ -997,7 +997,7 @@ static REBIXO To_Thru_Non_Block_Rule(
             rule = &word;
         }
 
-        REBCNT i = Find_In_Array(
+        REBLEN i = Find_In_Array(
             AS_ARRAY(P_INPUT),
             P_POS,
             SER_LEN(P_INPUT),
@@ -1022,8 +1022,8 @@ static REBIXO To_Thru_Non_Block_Rule(
         if (!IS_STRING(rule) && !IS_BINARY(rule)) {
             // !!! Can this be optimized not to use COPY?
             REBSER *formed = Copy_Form_Value(rule, 0);
-            REBCNT form_len = SER_LEN(formed);
-            REBCNT i = Find_Str_Str(
+            REBLEN form_len = SER_LEN(formed);
+            REBLEN i = Find_Str_Str(
                 P_INPUT,
                 0,
                 P_POS,
@@ -1047,7 +1047,7 @@ static REBIXO To_Thru_Non_Block_Rule(
             return i;
         }
 
-        REBCNT i = Find_Str_Str(
+        REBLEN i = Find_Str_Str(
             P_INPUT,
             0,
             P_POS,
@@ -1071,7 +1071,7 @@ static REBIXO To_Thru_Non_Block_Rule(
     }
 
     if (IS_CHAR(rule)) {
-        REBCNT i = Find_Str_Char(
+        REBLEN i = Find_Str_Char(
             VAL_CHAR(rule),
             P_INPUT,
             0,
@@ -1093,7 +1093,7 @@ static REBIXO To_Thru_Non_Block_Rule(
     }
 
     if (IS_BITSET(rule)) {
-        REBCNT i = Find_Str_Bitset(
+        REBLEN i = Find_Str_Bitset(
             P_INPUT,
             0,
             P_POS,
@@ -1354,7 +1354,7 @@ REBNATIVE(subparse)
     // annoying to find to inspect in the debugger.  This makes pointers into
     // the value payloads so they can be seen more easily.
     //
-    const REBCNT *pos_debug = &P_POS;
+    const REBLEN *pos_debug = &P_POS;
     cast(const void*, pos_debug);
 
     REBUPT do_count = TG_Do_Count; // helpful to cache for visibility also
@@ -1362,8 +1362,8 @@ REBNATIVE(subparse)
 
     REBVAL save;
 
-    REBCNT start = P_POS; // recovery restart point
-    REBCNT begin = P_POS; // point at beginning of match
+    REBLEN start = P_POS; // recovery restart point
+    REBLEN begin = P_POS; // point at beginning of match
 
     // The loop iterates across each REBVAL's worth of "rule" in the rule
     // block.  Some of these rules just set `flags` and `continue`, so that
@@ -1963,7 +1963,7 @@ REBNATIVE(subparse)
                     if (i == END_FLAG)
                         P_POS = NOT_FOUND;
                     else
-                        P_POS = cast(REBCNT, i);
+                        P_POS = cast(REBLEN, i);
                     break;
                 }
             }
@@ -2006,14 +2006,14 @@ REBNATIVE(subparse)
                     P_POS = NOT_FOUND; // was not enough
                 }
                 else if (i != END_FLAG) {
-                    P_POS = cast(REBCNT, i);
+                    P_POS = cast(REBLEN, i);
                 }
                 else {
                     // just keep index as is.
                 }
                 break;
             }
-            P_POS = cast(REBCNT, i);
+            P_POS = cast(REBLEN, i);
         }
 
         if (P_POS > SER_LEN(P_INPUT))
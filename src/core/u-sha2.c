@@ -0,0 +1,584 @@
+//
+//  File: %u-sha2.c
+//  Summary: "SHA-2 family secure hash functions (FIPS 180-4)"
+//  Section: utility
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2017 Rebol Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// SHA-256 is needed by the TLS 1.2 pseudo-random function and handshake
+// hash, and SHA-384/512 by anything that wants a longer digest.  The entry
+// points have the same shape as the SHA1 and MD5 ones so they can sit in
+// the digests[] table of %n-strings.c, and be fed incrementally through
+// CHECKSUM-OPEN.
+//
+// The portable code does big-endian loads a byte at a time, so there is no
+// alignment or endianness dependency.  On x86 built with GCC or Clang the
+// SHA-256 block function uses the SHA extensions ("SHA-NI") if the CPU
+// reports them at runtime.  Only that one function is compiled for the
+// extension, so the rest of the file needs no special compiler flags.
+//
+
+#include "sys-core.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) \
+    && !defined(__TINYC__)
+    #define SHA256_USE_SHANI
+    #include <cpuid.h>
+    #include <immintrin.h>
+#endif
+
+#define SHA256_DEFINED
+
+#define SHA256_BLOCK_LENGTH 64
+#define SHA256_DIGEST_LENGTH 32
+
+#define SHA512_BLOCK_LENGTH 128
+#define SHA512_DIGEST_LENGTH 64
+#define SHA384_DIGEST_LENGTH 48
+
+typedef struct {
+    u32 state[8];
+    u64 count; // total bytes hashed
+    REBYTE buffer[SHA256_BLOCK_LENGTH];
+} SHA256_CTX;
+
+typedef struct {
+    u64 state[8];
+    u64 count; // total bytes hashed (the spec allows 2^128 bits, 2^64 will do)
+    REBYTE buffer[SHA512_BLOCK_LENGTH];
+} SHA512_CTX; // also used by SHA-384, which only differs in IV and length
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void SHA256_Init(void *c);
+void SHA256_Update(void *c, REBYTE *data, REBCNT len);
+void SHA256_Final(REBYTE *md, void *c);
+int SHA256_CtxSize(void);
+
+void SHA512_Init(void *c);
+void SHA512_Update(void *c, REBYTE *data, REBCNT len);
+void SHA512_Final(REBYTE *md, void *c);
+int SHA512_CtxSize(void);
+
+void SHA384_Init(void *c);
+void SHA384_Final(REBYTE *md, void *c);
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#define CH(x,y,z) (((x) & (y)) ^ (~(x) & (z)))
+#define MAJ(x,y,z) (((x) & (y)) ^ ((x) & (z)) ^ ((y) & (z)))
+
+
+//=//// SHA-256 ///////////////////////////////////////////////////////////=//
+
+static const u32 K256[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+    0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+    0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+    0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+    0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
+    0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+#define ROTR32(x,n) (((x) >> (n)) | ((x) << (32 - (n))))
+
+#define BSIG0(x) (ROTR32(x, 2) ^ ROTR32(x, 13) ^ ROTR32(x, 22))
+#define BSIG1(x) (ROTR32(x, 6) ^ ROTR32(x, 11) ^ ROTR32(x, 25))
+#define SSIG0(x) (ROTR32(x, 7) ^ ROTR32(x, 18) ^ ((x) >> 3))
+#define SSIG1(x) (ROTR32(x, 17) ^ ROTR32(x, 19) ^ ((x) >> 10))
+
+
+static void SHA256_Transform(u32 *state, const REBYTE *block)
+{
+    u32 w[64];
+    u32 v[8];
+    int i;
+
+    for (i = 0; i < 16; i++)
+        w[i] = (cast(u32, block[i * 4]) << 24)
+            | (cast(u32, block[i * 4 + 1]) << 16)
+            | (cast(u32, block[i * 4 + 2]) << 8)
+            | cast(u32, block[i * 4 + 3]);
+
+    for (i = 16; i < 64; i++)
+        w[i] = SSIG1(w[i - 2]) + w[i - 7] + SSIG0(w[i - 15]) + w[i - 16];
+
+    for (i = 0; i < 8; i++)
+        v[i] = state[i];
+
+    for (i = 0; i < 64; i++) {
+        u32 t1 = v[7] + BSIG1(v[4]) + CH(v[4], v[5], v[6]) + K256[i] + w[i];
+        u32 t2 = BSIG0(v[0]) + MAJ(v[0], v[1], v[2]);
+        v[7] = v[6];
+        v[6] = v[5];
+        v[5] = v[4];
+        v[4] = v[3] + t1;
+        v[3] = v[2];
+        v[2] = v[1];
+        v[1] = v[0];
+        v[0] = t1 + t2;
+    }
+
+    for (i = 0; i < 8; i++)
+        state[i] += v[i];
+}
+
+
+#ifdef SHA256_USE_SHANI
+
+// SHA-NI keeps the state as two vectors, ABEF and CDGH.  SHA256RNDS2 does
+// two rounds at a time, and SHA256MSG1/MSG2 extend the message schedule by
+// four words from the previous sixteen.
+//
+__attribute__((target("sha,sse4.1,ssse3")))
+static void SHA256_Transform_Shani(
+    u32 *state,
+    const REBYTE *data,
+    REBCNT blocks
+){
+    const __m128i shuf_mask = _mm_set_epi64x(
+        0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL
+    );
+
+    __m128i tmp = _mm_loadu_si128(cast(const __m128i*, &state[0]));
+    __m128i state1 = _mm_loadu_si128(cast(const __m128i*, &state[4]));
+    tmp = _mm_shuffle_epi32(tmp, 0xB1); // CDAB
+    state1 = _mm_shuffle_epi32(state1, 0x1B); // EFGH
+    __m128i state0 = _mm_alignr_epi8(tmp, state1, 8); // ABEF
+    state1 = _mm_blend_epi16(state1, tmp, 0xF0); // CDGH
+
+    for (; blocks > 0; --blocks, data += SHA256_BLOCK_LENGTH) {
+        __m128i abef_save = state0;
+        __m128i cdgh_save = state1;
+        __m128i w[4];
+        int i;
+
+        for (i = 0; i < 4; ++i)
+            w[i] = _mm_shuffle_epi8(
+                _mm_loadu_si128(cast(const __m128i*, data + i * 16)),
+                shuf_mask
+            );
+
+        for (i = 0; i < 16; ++i) {
+            __m128i msg = _mm_add_epi32(
+                w[i % 4],
+                _mm_loadu_si128(cast(const __m128i*, &K256[i * 4]))
+            );
+            state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+            msg = _mm_shuffle_epi32(msg, 0x0E);
+            state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+
+            if (i < 12) // W[i+4] from W[i] .. W[i+3]
+                w[i % 4] = _mm_sha256msg2_epu32(
+                    _mm_add_epi32(
+                        _mm_sha256msg1_epu32(w[i % 4], w[(i + 1) % 4]),
+                        _mm_alignr_epi8(w[(i + 3) % 4], w[(i + 2) % 4], 4)
+                    ),
+                    w[(i + 3) % 4]
+                );
+        }
+
+        state0 = _mm_add_epi32(state0, abef_save);
+        state1 = _mm_add_epi32(state1, cdgh_save);
+    }
+
+    tmp = _mm_shuffle_epi32(state0, 0x1B); // FEBA
+    state1 = _mm_shuffle_epi32(state1, 0xB1); // DCHG
+    state0 = _mm_blend_epi16(tmp, state1, 0xF0); // DCBA
+    state1 = _mm_alignr_epi8(state1, tmp, 8); // ABEF
+
+    _mm_storeu_si128(cast(__m128i*, &state[0]), state0);
+    _mm_storeu_si128(cast(__m128i*, &state[4]), state1);
+}
+
+
+static REBOOL Cpu_Has_Shani(void)
+{
+    unsigned int eax, ebx, ecx, edx;
+
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+        return FALSE;
+    if (!(ecx & bit_SSSE3) || !(ecx & bit_SSE4_1))
+        return FALSE;
+    if (__get_cpuid_max(0, NULL) < 7)
+        return FALSE;
+
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+    return LOGICAL(ebx & (1 << 29)); // SHA extensions
+}
+
+#endif
+
+
+// -1 until the first SHA256_Init() asks the CPU.  Two threads racing here
+// would both store the same answer.
+//
+static int sha256_shani = -1;
+
+static void SHA256_Blocks(SHA256_CTX *c, const REBYTE *data, REBCNT blocks)
+{
+#ifdef SHA256_USE_SHANI
+    if (sha256_shani) {
+        SHA256_Transform_Shani(c->state, data, blocks);
+        return;
+    }
+#endif
+
+    for (; blocks > 0; --blocks, data += SHA256_BLOCK_LENGTH)
+        SHA256_Transform(c->state, data);
+}
+
+
+void SHA256_Init(void *c_opaque)
+{
+    SHA256_CTX *c = cast(SHA256_CTX*, c_opaque);
+
+    c->state[0] = 0x6a09e667;
+    c->state[1] = 0xbb67ae85;
+    c->state[2] = 0x3c6ef372;
+    c->state[3] = 0xa54ff53a;
+    c->state[4] = 0x510e527f;
+    c->state[5] = 0x9b05688c;
+    c->state[6] = 0x1f83d9ab;
+    c->state[7] = 0x5be0cd19;
+    c->count = 0;
+
+    if (sha256_shani < 0) {
+    #ifdef SHA256_USE_SHANI
+        sha256_shani = Cpu_Has_Shani() ? 1 : 0;
+    #else
+        sha256_shani = 0;
+    #endif
+    }
+}
+
+
+void SHA256_Update(void *c_opaque, REBYTE *data, REBCNT len)
+{
+    SHA256_CTX *c = cast(SHA256_CTX*, c_opaque);
+    REBCNT used = cast(REBCNT, c->count % SHA256_BLOCK_LENGTH);
+
+    c->count += len;
+
+    if (used != 0) {
+        REBCNT fill = SHA256_BLOCK_LENGTH - used;
+        if (len < fill) {
+            memcpy(c->buffer + used, data, len);
+            return;
+        }
+        memcpy(c->buffer + used, data, fill);
+        SHA256_Blocks(c, c->buffer, 1);
+        data += fill;
+        len -= fill;
+    }
+
+    if (len >= SHA256_BLOCK_LENGTH) {
+        REBCNT blocks = len / SHA256_BLOCK_LENGTH;
+        SHA256_Blocks(c, data, blocks);
+        data += blocks * SHA256_BLOCK_LENGTH;
+        len -= blocks * SHA256_BLOCK_LENGTH;
+    }
+
+    memcpy(c->buffer, data, len);
+}
+
+
+void SHA256_Final(REBYTE *md, void *c_opaque)
+{
+    SHA256_CTX *c = cast(SHA256_CTX*, c_opaque);
+    REBCNT used = cast(REBCNT, c->count % SHA256_BLOCK_LENGTH);
+    u64 bits = c->count * 8;
+    int i;
+
+    c->buffer[used++] = 0x80;
+    if (used > SHA256_BLOCK_LENGTH - 8) {
+        memset(c->buffer + used, 0, SHA256_BLOCK_LENGTH - used);
+        SHA256_Blocks(c, c->buffer, 1);
+        used = 0;
+    }
+    memset(c->buffer + used, 0, SHA256_BLOCK_LENGTH - 8 - used);
+
+    for (i = 0; i < 8; i++)
+        c->buffer[SHA256_BLOCK_LENGTH - 1 - i] = cast(REBYTE, bits >> (i * 8));
+    SHA256_Blocks(c, c->buffer, 1);
+
+    for (i = 0; i < 8; i++) {
+        md[i * 4] = cast(REBYTE, c->state[i] >> 24);
+        md[i * 4 + 1] = cast(REBYTE, c->state[i] >> 16);
+        md[i * 4 + 2] = cast(REBYTE, c->state[i] >> 8);
+        md[i * 4 + 3] = cast(REBYTE, c->state[i]);
+    }
+}
+
+
+int SHA256_CtxSize(void) {
+    return sizeof(SHA256_CTX);
+}
+
+
+//
+//  SHA256: C
+//
+REBYTE *SHA256(REBYTE *d, REBCNT n, REBYTE *md)
+{
+    SHA256_CTX c;
+    static REBYTE m[SHA256_DIGEST_LENGTH];
+
+    if (md == NULL)
+        md = m;
+    SHA256_Init(&c);
+    SHA256_Update(&c, d, n);
+    SHA256_Final(md, &c);
+    memset(&c, 0, sizeof(c)); // security consideration
+    return md;
+}
+
+
+//=//// SHA-512 and SHA-384 ///////////////////////////////////////////////=//
+
+static const u64 K512[80] = {
+    0x428a2f98d728ae22ULL, 0x7137449123ef65cdULL, 0xb5c0fbcfec4d3b2fULL,
+    0xe9b5dba58189dbbcULL, 0x3956c25bf348b538ULL, 0x59f111f1b605d019ULL,
+    0x923f82a4af194f9bULL, 0xab1c5ed5da6d8118ULL, 0xd807aa98a3030242ULL,
+    0x12835b0145706fbeULL, 0x243185be4ee4b28cULL, 0x550c7dc3d5ffb4e2ULL,
+    0x72be5d74f27b896fULL, 0x80deb1fe3b1696b1ULL, 0x9bdc06a725c71235ULL,
+    0xc19bf174cf692694ULL, 0xe49b69c19ef14ad2ULL, 0xefbe4786384f25e3ULL,
+    0x0fc19dc68b8cd5b5ULL, 0x240ca1cc77ac9c65ULL, 0x2de92c6f592b0275ULL,
+    0x4a7484aa6ea6e483ULL, 0x5cb0a9dcbd41fbd4ULL, 0x76f988da831153b5ULL,
+    0x983e5152ee66dfabULL, 0xa831c66d2db43210ULL, 0xb00327c898fb213fULL,
+    0xbf597fc7beef0ee4ULL, 0xc6e00bf33da88fc2ULL, 0xd5a79147930aa725ULL,
+    0x06ca6351e003826fULL, 0x142929670a0e6e70ULL, 0x27b70a8546d22ffcULL,
+    0x2e1b21385c26c926ULL, 0x4d2c6dfc5ac42aedULL, 0x53380d139d95b3dfULL,
+    0x650a73548baf63deULL, 0x766a0abb3c77b2a8ULL, 0x81c2c92e47edaee6ULL,
+    0x92722c851482353bULL, 0xa2bfe8a14cf10364ULL, 0xa81a664bbc423001ULL,
+    0xc24b8b70d0f89791ULL, 0xc76c51a30654be30ULL, 0xd192e819d6ef5218ULL,
+    0xd69906245565a910ULL, 0xf40e35855771202aULL, 0x106aa07032bbd1b8ULL,
+    0x19a4c116b8d2d0c8ULL, 0x1e376c085141ab53ULL, 0x2748774cdf8eeb99ULL,
+    0x34b0bcb5e19b48a8ULL, 0x391c0cb3c5c95a63ULL, 0x4ed8aa4ae3418acbULL,
+    0x5b9cca4f7763e373ULL, 0x682e6ff3d6b2b8a3ULL, 0x748f82ee5defb2fcULL,
+    0x78a5636f43172f60ULL, 0x84c87814a1f0ab72ULL, 0x8cc702081a6439ecULL,
+    0x90befffa23631e28ULL, 0xa4506cebde82bde9ULL, 0xbef9a3f7b2c67915ULL,
+    0xc67178f2e372532bULL, 0xca273eceea26619cULL, 0xd186b8c721c0c207ULL,
+    0xeada7dd6cde0eb1eULL, 0xf57d4f7fee6ed178ULL, 0x06f067aa72176fbaULL,
+    0x0a637dc5a2c898a6ULL, 0x113f9804bef90daeULL, 0x1b710b35131c471bULL,
+    0x28db77f523047d84ULL, 0x32caab7b40c72493ULL, 0x3c9ebe0a15c9bebcULL,
+    0x431d67c49c100d4cULL, 0x4cc5d4becb3e42b6ULL, 0x597f299cfc657e2aULL,
+    0x5fcb6fab3ad6faecULL, 0x6c44198c4a475817ULL
+};
+
+#define ROTR64(x,n) (((x) >> (n)) | ((x) << (64 - (n))))
+
+#define BSIG0_64(x) (ROTR64(x, 28) ^ ROTR64(x, 34) ^ ROTR64(x, 39))
+#define BSIG1_64(x) (ROTR64(x, 14) ^ ROTR64(x, 18) ^ ROTR64(x, 41))
+#define SSIG0_64(x) (ROTR64(x, 1) ^ ROTR64(x, 8) ^ ((x) >> 7))
+#define SSIG1_64(x) (ROTR64(x, 19) ^ ROTR64(x, 61) ^ ((x) >> 6))
+
+
+static void SHA512_Transform(u64 *state, const REBYTE *block)
+{
+    u64 w[80];
+    u64 v[8];
+    int i, j;
+
+    for (i = 0; i < 16; i++) {
+        w[i] = 0;
+        for (j = 0; j < 8; j++)
+            w[i] = (w[i] << 8) | block[i * 8 + j];
+    }
+
+    for (i = 16; i < 80; i++)
+        w[i] = SSIG1_64(w[i - 2]) + w[i - 7] + SSIG0_64(w[i - 15]) + w[i - 16];
+
+    for (i = 0; i < 8; i++)
+        v[i] = state[i];
+
+    for (i = 0; i < 80; i++) {
+        u64 t1 = v[7] + BSIG1_64(v[4]) + CH(v[4], v[5], v[6]) + K512[i] + w[i];
+        u64 t2 = BSIG0_64(v[0]) + MAJ(v[0], v[1], v[2]);
+        v[7] = v[6];
+        v[6] = v[5];
+        v[5] = v[4];
+        v[4] = v[3] + t1;
+        v[3] = v[2];
+        v[2] = v[1];
+        v[1] = v[0];
+        v[0] = t1 + t2;
+    }
+
+    for (i = 0; i < 8; i++)
+        state[i] += v[i];
+}
+
+
+void SHA512_Init(void *c_opaque)
+{
+    SHA512_CTX *c = cast(SHA512_CTX*, c_opaque);
+
+    c->state[0] = 0x6a09e667f3bcc908ULL;
+    c->state[1] = 0xbb67ae8584caa73bULL;
+    c->state[2] = 0x3c6ef372fe94f82bULL;
+    c->state[3] = 0xa54ff53a5f1d36f1ULL;
+    c->state[4] = 0x510e527fade682d1ULL;
+    c->state[5] = 0x9b05688c2b3e6c1fULL;
+    c->state[6] = 0x1f83d9abfb41bd6bULL;
+    c->state[7] = 0x5be0cd19137e2179ULL;
+    c->count = 0;
+}
+
+
+void SHA384_Init(void *c_opaque)
+{
+    SHA512_CTX *c = cast(SHA512_CTX*, c_opaque);
+
+    c->state[0] = 0xcbbb9d5dc1059ed8ULL;
+    c->state[1] = 0x629a292a367cd507ULL;
+    c->state[2] = 0x9159015a3070dd17ULL;
+    c->state[3] = 0x152fecd8f70e5939ULL;
+    c->state[4] = 0x67332667ffc00b31ULL;
+    c->state[5] = 0x8eb44a8768581511ULL;
+    c->state[6] = 0xdb0c2e0d64f98fa7ULL;
+    c->state[7] = 0x47b5481dbefa4fa4ULL;
+    c->count = 0;
+}
+
+
+void SHA512_Update(void *c_opaque, REBYTE *data, REBCNT len)
+{
+    SHA512_CTX *c = cast(SHA512_CTX*, c_opaque);
+    REBCNT used = cast(REBCNT, c->count % SHA512_BLOCK_LENGTH);
+
+    c->count += len;
+
+    if (used != 0) {
+        REBCNT fill = SHA512_BLOCK_LENGTH - used;
+        if (len < fill) {
+            memcpy(c->buffer + used, data, len);
+            return;
+        }
+        memcpy(c->buffer + used, data, fill);
+        SHA512_Transform(c->state, c->buffer);
+        data += fill;
+        len -= fill;
+    }
+
+    for (; len >= SHA512_BLOCK_LENGTH; len -= SHA512_BLOCK_LENGTH) {
+        SHA512_Transform(c->state, data);
+        data += SHA512_BLOCK_LENGTH;
+    }
+
+    memcpy(c->buffer, data, len);
+}
+
+
+static void SHA512_Finish(REBYTE *md, SHA512_CTX *c, REBCNT md_len)
+{
+    REBCNT used = cast(REBCNT, c->count % SHA512_BLOCK_LENGTH);
+    u64 bits = c->count * 8;
+    REBCNT i;
+
+    // The length field is 128 bits, of which the top 64 are zero here.
+    //
+    c->buffer[used++] = 0x80;
+    if (used > SHA512_BLOCK_LENGTH - 16) {
+        memset(c->buffer + used, 0, SHA512_BLOCK_LENGTH - used);
+        SHA512_Transform(c->state, c->buffer);
+        used = 0;
+    }
+    memset(c->buffer + used, 0, SHA512_BLOCK_LENGTH - 8 - used);
+
+    for (i = 0; i < 8; i++)
+        c->buffer[SHA512_BLOCK_LENGTH - 1 - i] = cast(REBYTE, bits >> (i * 8));
+    SHA512_Transform(c->state, c->buffer);
+
+    for (i = 0; i < md_len; i++)
+        md[i] = cast(REBYTE, c->state[i / 8] >> (56 - 8 * (i % 8)));
+}
+
+
+void SHA512_Final(REBYTE *md, void *c_opaque)
+{
+    SHA512_Finish(md, cast(SHA512_CTX*, c_opaque), SHA512_DIGEST_LENGTH);
+}
+
+
+void SHA384_Final(REBYTE *md, void *c_opaque)
+{
+    SHA512_Finish(md, cast(SHA512_CTX*, c_opaque), SHA384_DIGEST_LENGTH);
+}
+
+
+int SHA512_CtxSize(void) {
+    return sizeof(SHA512_CTX);
+}
+
+
+//
+//  SHA512: C
+//
+REBYTE *SHA512(REBYTE *d, REBCNT n, REBYTE *md)
+{
+    SHA512_CTX c;
+    static REBYTE m[SHA512_DIGEST_LENGTH];
+
+    if (md == NULL)
+        md = m;
+    SHA512_Init(&c);
+    SHA512_Update(&c, d, n);
+    SHA512_Final(md, &c);
+    memset(&c, 0, sizeof(c)); // security consideration
+    return md;
+}
+
+
+//
+//  SHA384: C
+//
+REBYTE *SHA384(REBYTE *d, REBCNT n, REBYTE *md)
+{
+    SHA512_CTX c;
+    static REBYTE m[SHA384_DIGEST_LENGTH];
+
+    if (md == NULL)
+        md = m;
+    SHA384_Init(&c);
+    SHA512_Update(&c, d, n);
+    SHA384_Final(md, &c);
+    memset(&c, 0, sizeof(c)); // security consideration
+    return md;
+}
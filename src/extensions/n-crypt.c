@@ -41,6 +41,8 @@
 #include "rsa/rsa.h" // defines gCryptProv and rng_fd (used in Init/Shutdown)
 #include "dh/dh.h"
 #include "aes/aes.h"
+#include "chacha20poly1305/chacha20poly1305.h"
+#include "x25519/x25519.h"
 
 #ifdef IS_ERROR
 #undef IS_ERROR //winerror.h defines this, so undef it to avoid the warning
@@ -252,7 +254,6 @@ static REBNATIVE(rsa)
         else if (word == CRYPT_WORD_Q) {
             q = VAL_BIN_AT(var);
             q_len = VAL_LEN_AT(var);
-           break;
         }
         else if (word == CRYPT_WORD_DP) {
             dp = VAL_BIN_AT(var);
@@ -465,6 +466,9 @@ static REBNATIVE(dh_compute_key)
         else if (word == CRYPT_WORD_PRIV_KEY) { 
             dh_ctx.x = VAL_BIN_AT(var);
         }
+        else if (word == CRYPT_WORD_G || word == CRYPT_WORD_PUB_KEY) {
+            // set by DH-GENERATE-KEY, but not needed here
+        }
         else {
             fail (Error(RE_EXT_CRYPT_INVALID_KEY_FIELD, key));
         }
@@ -488,6 +492,24 @@ static REBNATIVE(dh_compute_key)
 }
 
 
+// Modes for AES streams.  CBC is what the native originally offered, and
+// pads the data with zeros to whole blocks.  CTR and GCM take data of any
+// length; GCM authenticates each call's data as one message.
+//
+enum {
+    AES_STREAM_CBC,
+    AES_STREAM_CTR,
+    AES_STREAM_GCM
+};
+
+typedef struct {
+    int mode;
+    REBOOL decrypt;
+    AES_GCM_CTX gcm; // gcm.aes is the cipher for the other modes too
+    uint8_t nonce[AES_GCM_IV_SIZE]; // GCM only
+} AES_STREAM_CTX;
+
+
 // The original Saphirion implementation used OS_ALLOC (basically malloc) to
 // leave a potentially dangling memory pointer for the AES context.  Ren-C
 // has "managed handles" which will clean themselves up when they are no
@@ -498,8 +520,60 @@ static void cleanup_aes_ctx(const REBVAL *val)
     assert(IS_HANDLE(val));
     assert(val->payload.handle.pointer != NULL);
 
-    AES_CTX *aes_ctx = cast(AES_CTX*, val->payload.handle.pointer);
-    FREE(AES_CTX, aes_ctx);
+    AES_STREAM_CTX *aes_ctx
+        = cast(AES_STREAM_CTX*, val->payload.handle.pointer);
+    memset(aes_ctx, 0, sizeof(AES_STREAM_CTX)); // don't leave keys in memory
+    FREE(AES_STREAM_CTX, aes_ctx);
+}
+
+
+// Encrypt or decrypt a whole message with GCM.  The output of encryption
+// is the ciphertext followed by the tag.  The last 8 bytes of the nonce
+// are then counted up as a big-endian number, so each call uses a fresh
+// one without the caller having to supply it (both ends of a stream stay
+// in step, as with the CBC chaining value).
+//
+// Returns NULL if decryption fails authentication.
+//
+static REBSER *Aes_Gcm_Stream(
+    AES_STREAM_CTX *aes_ctx,
+    const REBYTE *data,
+    REBCNT len,
+    const REBYTE *aad,
+    REBCNT aad_len
+){
+    REBSER *out;
+
+    if (aes_ctx->decrypt) {
+        if (len < AES_GCM_TAG_SIZE)
+            return NULL;
+        len -= AES_GCM_TAG_SIZE;
+
+        out = Make_Binary(len);
+        if (!AES_gcm_open(
+            &aes_ctx->gcm, aes_ctx->nonce, aad, aad_len,
+            data, BIN_HEAD(out), len, data + len
+        )){
+            Free_Series(out);
+            return NULL;
+        }
+        SET_SERIES_LEN(out, len);
+    }
+    else {
+        out = Make_Binary(len + AES_GCM_TAG_SIZE);
+        AES_gcm_seal(
+            &aes_ctx->gcm, aes_ctx->nonce, aad, aad_len,
+            data, BIN_HEAD(out), len, BIN_AT(out, len)
+        );
+        SET_SERIES_LEN(out, len + AES_GCM_TAG_SIZE);
+    }
+
+    REBINT i;
+    for (i = AES_GCM_IV_SIZE; i > AES_GCM_IV_SIZE - 8; --i)
+        if (++aes_ctx->nonce[i - 1] != 0)
+            break;
+
+    return out;
 }
 
 
@@ -508,14 +582,15 @@ static void cleanup_aes_ctx(const REBVAL *val)
 //
 //  "Encrypt/decrypt data using AES algorithm."
 //
-//      return: [handle! binary! logic!]
-//          "Stream cipher context handle or encrypted/decrypted data."
+//      return: [handle! binary! logic! blank!]
+//          {Stream cipher context handle or encrypted/decrypted data (blank
+//          if GCM decryption fails authentication)}
 //      /key
 //          "Provided only for the first time to get stream HANDLE!"
 //      crypt-key [binary!]
 //          "Crypt key."
 //      iv [binary! blank!]
-//          "Optional initialization vector."
+//          "Optional initialization vector (CTR counter, or GCM nonce)."
 //      /stream
 //      ctx [handle!]
 //          "Stream cipher context."
@@ -523,7 +598,15 @@ static void cleanup_aes_ctx(const REBVAL *val)
 //          "Data to encrypt/decrypt."
 //      /decrypt
 //          "Use the crypt-key for decryption (default is to encrypt)"
+//      /mode
+//          "Cipher mode to use with the new key (default is CBC)"
+//      cipher-mode [word!]
+//          "CBC, CTR or GCM"
+//      /aad
+//          "Additional data to authenticate along with a GCM stream's data"
+//      additional [binary!]
 //  ]
+//  new-words: [cbc ctr gcm]
 //  new-errors: [
 //      invalid-aes-context: [{Not a AES context:} :arg1]
 //      invalid-aes-key-length: [{AES key length has to be 16 or 32:} :arg1]
@@ -537,11 +620,36 @@ static REBNATIVE(aes)
         if (VAL_HANDLE_CLEANER(ARG(ctx)) != cleanup_aes_ctx)
             fail (Error(RE_EXT_CRYPT_INVALID_AES_CONTEXT, ARG(ctx)));
 
-        AES_CTX *aes_ctx = cast(AES_CTX*, VAL_HANDLE_POINTER(ARG(ctx)));
+        AES_STREAM_CTX *aes_ctx
+            = cast(AES_STREAM_CTX*, VAL_HANDLE_POINTER(ARG(ctx)));
 
         REBYTE *dataBuffer = VAL_BIN_AT(ARG(data));
         REBINT len = VAL_LEN_AT(ARG(data));
 
+        if (aes_ctx->mode == AES_STREAM_GCM) {
+            REBSER *out = Aes_Gcm_Stream(
+                aes_ctx,
+                dataBuffer,
+                len,
+                REF(aad) ? VAL_BIN_AT(ARG(additional)) : NULL,
+                REF(aad) ? VAL_LEN_AT(ARG(additional)) : 0
+            );
+            if (out == NULL)
+                return R_BLANK;
+
+            Init_Binary(D_OUT, out);
+            return R_OUT;
+        }
+
+        if (aes_ctx->mode == AES_STREAM_CTR) {
+            REBSER *out = Make_Binary(len);
+            AES_ctr_crypt(&aes_ctx->gcm.aes, dataBuffer, BIN_HEAD(out), len);
+            SET_SERIES_LEN(out, len);
+
+            Init_Binary(D_OUT, out);
+            return R_OUT;
+        }
+
         if (len == 0)
             return R_BLANK;
 
@@ -563,16 +671,16 @@ static REBNATIVE(aes)
         REBSER *binaryOut = Make_Binary(pad_len);
         memset(BIN_HEAD(binaryOut), 0, pad_len);
 
-        if (aes_ctx->key_mode == AES_MODE_DECRYPT)
+        if (aes_ctx->gcm.aes.key_mode == AES_MODE_DECRYPT)
             AES_cbc_decrypt(
-                aes_ctx,
+                &aes_ctx->gcm.aes,
                 cast(const uint8_t*, dataBuffer),
                 BIN_HEAD(binaryOut),
                 pad_len
             );
         else
             AES_cbc_encrypt(
-                aes_ctx,
+                &aes_ctx->gcm.aes,
                 cast(const uint8_t*, dataBuffer),
                 BIN_HEAD(binaryOut),
                 pad_len
@@ -587,18 +695,32 @@ static REBNATIVE(aes)
     }
 
     if (REF(key)) {
+        int mode = AES_STREAM_CBC;
+        if (REF(mode)) {
+            REBSTR *word = VAL_WORD_CANON(ARG(cipher_mode));
+            if (word == CRYPT_WORD_CTR)
+                mode = AES_STREAM_CTR;
+            else if (word == CRYPT_WORD_GCM)
+                mode = AES_STREAM_GCM;
+            else if (word != CRYPT_WORD_CBC)
+                fail (Error_Invalid_Arg(ARG(cipher_mode)));
+        }
+
+        REBCNT iv_size = (mode == AES_STREAM_GCM)
+            ? AES_GCM_IV_SIZE
+            : AES_IV_SIZE;
+
         uint8_t iv[AES_IV_SIZE];
+        memset(iv, 0, AES_IV_SIZE);
 
         if (IS_BINARY(ARG(iv))) {
-            if (VAL_LEN_AT(ARG(iv)) < AES_IV_SIZE)
+            if (VAL_LEN_AT(ARG(iv)) < iv_size)
                 return R_BLANK;
 
-            memcpy(iv, VAL_BIN_AT(ARG(iv)), AES_IV_SIZE);
+            memcpy(iv, VAL_BIN_AT(ARG(iv)), iv_size);
         }
-        else {
+        else
             assert(IS_BLANK(ARG(iv)));
-            memset(iv, 0, AES_IV_SIZE);
-        }
 
         //key defined - setup new context
 
@@ -609,17 +731,31 @@ static REBNATIVE(aes)
             fail (Error(RE_EXT_CRYPT_INVALID_AES_KEY_LENGTH, &i));
         }
 
-        AES_CTX *aes_ctx = ALLOC_ZEROFILL(AES_CTX);
+        AES_STREAM_CTX *aes_ctx = ALLOC_ZEROFILL(AES_STREAM_CTX);
+        aes_ctx->mode = mode;
+        aes_ctx->decrypt = REF(decrypt);
 
-        AES_set_key(
-            aes_ctx,
-            cast(const uint8_t *, VAL_BIN_AT(ARG(crypt_key))),
-            cast(const uint8_t *, iv),
-            (len == 128) ? AES_MODE_128 : AES_MODE_256
-        );
+        if (mode == AES_STREAM_GCM) {
+            AES_gcm_init(
+                &aes_ctx->gcm,
+                cast(const uint8_t *, VAL_BIN_AT(ARG(crypt_key))),
+                len >> 3
+            );
+            memcpy(aes_ctx->nonce, iv, AES_GCM_IV_SIZE);
+        }
+        else {
+            AES_set_key(
+                &aes_ctx->gcm.aes,
+                cast(const uint8_t *, VAL_BIN_AT(ARG(crypt_key))),
+                cast(const uint8_t *, iv),
+                (len == 128) ? AES_MODE_128 : AES_MODE_256
+            );
 
-        if (REF(decrypt))
-            AES_convert_key(aes_ctx);
+            // CTR mode only ever runs the cipher forwards
+            //
+            if (mode == AES_STREAM_CBC && REF(decrypt))
+                AES_convert_key(&aes_ctx->gcm.aes);
+        }
 
         Init_Handle_Managed(D_OUT, aes_ctx, 0, &cleanup_aes_ctx);
         return R_OUT;
@@ -629,6 +765,344 @@ static REBNATIVE(aes)
 }
 
 
+//
+//  x25519: native/export [
+//
+//  "Elliptic curve Diffie-Hellman over Curve25519 (RFC 7748)."
+//
+//      return: [binary!]
+//          "Public key, or the shared secret if /shared is used"
+//      private-key [binary!]
+//          "32 random bytes (clamped internally)"
+//      /shared
+//          "Compute the shared secret with the peer's public key"
+//      public-key [binary!]
+//          "The peer's 32 byte public key"
+//  ]
+//  new-errors: [
+//      invalid-x25519-key: [{X25519 key length has to be 32:} :arg1]
+//      weak-x25519-key: {X25519 peer key gives an all-zero shared secret}
+//  ]
+//
+static REBNATIVE(x25519)
+{
+    INCLUDE_PARAMS_OF_X25519;
+
+    if (VAL_LEN_AT(ARG(private_key)) != X25519_KEY_SIZE)
+        fail (Error(RE_EXT_CRYPT_INVALID_X25519_KEY, ARG(private_key)));
+
+    const uint8_t *point = NULL; // NULL means use the base point
+    if (REF(shared)) {
+        if (VAL_LEN_AT(ARG(public_key)) != X25519_KEY_SIZE)
+            fail (Error(RE_EXT_CRYPT_INVALID_X25519_KEY, ARG(public_key)));
+        point = VAL_BIN_AT(ARG(public_key));
+    }
+
+    REBSER *result = Make_Binary(X25519_KEY_SIZE);
+    x25519(BIN_HEAD(result), VAL_BIN_AT(ARG(private_key)), point);
+    SET_SERIES_LEN(result, X25519_KEY_SIZE);
+
+    if (REF(shared)) {
+        //
+        // A small-order peer point yields zero no matter what our private
+        // key is; RFC 7748 section 6.1 says to abort in that case.
+        //
+        REBYTE check = 0;
+        REBCNT i;
+        for (i = 0; i < X25519_KEY_SIZE; ++i)
+            check |= BIN_HEAD(result)[i];
+        if (check == 0) {
+            Free_Series(result);
+            fail (Error(RE_EXT_CRYPT_WEAK_X25519_KEY));
+        }
+    }
+
+    Init_Binary(D_OUT, result);
+    return R_OUT;
+}
+
+
+// Per-direction state for an AEAD-protected TLS 1.2 record stream.  The
+// sequence number is passed in on each call rather than kept here, since
+// the protocol code already tracks it and resets it on ChangeCipherSpec.
+//
+enum {
+    TLS_AEAD_AES_GCM,
+    TLS_AEAD_CHACHA20_POLY1305
+};
+
+#define TLS_MAX_PLAINTEXT 16384
+#define TLS_AEAD_TAG_SIZE 16
+#define TLS_GCM_EXPLICIT_NONCE 8
+
+typedef struct {
+    int method;
+    AES_GCM_CTX gcm;
+    uint8_t key[CHACHA20_KEY_SIZE];
+    uint8_t iv[CHACHA20_NONCE_SIZE]; // only first 4 bytes used by GCM
+} TLS_AEAD_CTX;
+
+static void cleanup_tls_aead_ctx(const REBVAL *val)
+{
+    assert(IS_HANDLE(val));
+    TLS_AEAD_CTX *tls_ctx = cast(TLS_AEAD_CTX*, val->payload.handle.pointer);
+    memset(tls_ctx, 0, sizeof(TLS_AEAD_CTX)); // don't leave keys in freed memory
+    FREE(TLS_AEAD_CTX, tls_ctx);
+}
+
+
+//
+//  tls-cipher: native/export [
+//
+//  "Make a TLS 1.2 record protection context for an AEAD cipher suite."
+//
+//      return: [handle!]
+//          "Context for TLS-SEAL (writing) or TLS-OPEN (reading)"
+//      method [word!]
+//          "AES-128-GCM, AES-256-GCM or CHACHA20-POLY1305"
+//      key [binary!]
+//          "Write key from the key block"
+//      iv [binary!]
+//          "Write IV from the key block: 4 bytes for GCM, 12 for ChaCha20"
+//  ]
+//  new-words: [aes-128-gcm aes-256-gcm chacha20-poly1305]
+//  new-errors: [
+//      invalid-tls-context: [{Not a TLS record context:} :arg1]
+//      invalid-tls-key: [{Wrong key or IV length for} :arg1]
+//      tls-record-overflow: [{TLS record exceeds 16384 bytes:} :arg1]
+//      tls-bad-record-mac: {TLS record failed authentication (bad_record_mac)}
+//  ]
+//
+static REBNATIVE(tls_cipher)
+{
+    INCLUDE_PARAMS_OF_TLS_CIPHER;
+
+    REBSTR *method = VAL_WORD_CANON(ARG(method));
+    REBCNT key_len = VAL_LEN_AT(ARG(key));
+    REBCNT iv_len = VAL_LEN_AT(ARG(iv));
+
+    int kind;
+    if (method == CRYPT_WORD_AES_128_GCM) {
+        kind = TLS_AEAD_AES_GCM;
+        if (key_len != 16 || iv_len != 4)
+            fail (Error(RE_EXT_CRYPT_INVALID_TLS_KEY, ARG(method)));
+    }
+    else if (method == CRYPT_WORD_AES_256_GCM) {
+        kind = TLS_AEAD_AES_GCM;
+        if (key_len != 32 || iv_len != 4)
+            fail (Error(RE_EXT_CRYPT_INVALID_TLS_KEY, ARG(method)));
+    }
+    else if (method == CRYPT_WORD_CHACHA20_POLY1305) {
+        kind = TLS_AEAD_CHACHA20_POLY1305;
+        if (key_len != CHACHA20_KEY_SIZE || iv_len != CHACHA20_NONCE_SIZE)
+            fail (Error(RE_EXT_CRYPT_INVALID_TLS_KEY, ARG(method)));
+    }
+    else
+        fail (Error_Invalid_Arg(ARG(method)));
+
+    TLS_AEAD_CTX *tls_ctx = ALLOC_ZEROFILL(TLS_AEAD_CTX);
+    tls_ctx->method = kind;
+    memcpy(tls_ctx->iv, VAL_BIN_AT(ARG(iv)), iv_len);
+
+    if (kind == TLS_AEAD_AES_GCM)
+        AES_gcm_init(&tls_ctx->gcm, VAL_BIN_AT(ARG(key)), key_len);
+    else
+        memcpy(tls_ctx->key, VAL_BIN_AT(ARG(key)), key_len);
+
+    Init_Handle_Managed(D_OUT, tls_ctx, 0, &cleanup_tls_aead_ctx);
+    return R_OUT;
+}
+
+
+// The additional data authenticated with each record (RFC 5246 6.2.3.3).
+//
+static void Tls_Aead_Header(
+    REBYTE *aad,
+    REBI64 seq,
+    const REBVAL *type,
+    const REBVAL *version,
+    REBCNT len
+){
+    REBINT i;
+    for (i = 7; i >= 0; --i) {
+        aad[i] = cast(REBYTE, seq & 0xff);
+        seq >>= 8;
+    }
+    aad[8] = cast(REBYTE, VAL_INT32(type));
+    aad[9] = VAL_BIN_AT(version)[0];
+    aad[10] = VAL_BIN_AT(version)[1];
+    aad[11] = cast(REBYTE, len >> 8);
+    aad[12] = cast(REBYTE, len & 0xff);
+}
+
+
+// ChaCha20-Poly1305 XORs the sequence number into the IV (RFC 7905), GCM
+// appends it to the 4 byte salt and sends it as the explicit nonce.
+//
+static void Tls_Aead_Nonce(
+    REBYTE *nonce,
+    const TLS_AEAD_CTX *tls_ctx,
+    const REBYTE *seq_bytes
+){
+    REBCNT i;
+    if (tls_ctx->method == TLS_AEAD_AES_GCM) {
+        memcpy(nonce, tls_ctx->iv, 4);
+        memcpy(nonce + 4, seq_bytes, TLS_GCM_EXPLICIT_NONCE);
+    }
+    else {
+        memcpy(nonce, tls_ctx->iv, CHACHA20_NONCE_SIZE);
+        for (i = 0; i < 8; ++i)
+            nonce[4 + i] ^= seq_bytes[i];
+    }
+}
+
+
+//
+//  tls-seal: native/export [
+//
+//  "Encrypt and authenticate the payload of one TLS record."
+//
+//      return: [binary!]
+//          "Record fragment (explicit nonce, ciphertext, tag) without header"
+//      ctx [handle!]
+//          "Write context from TLS-CIPHER"
+//      seq [integer!]
+//          "Record sequence number"
+//      type [integer!]
+//          "Content type of the record (20 to 23)"
+//      version [binary!]
+//          "Two byte protocol version of the record"
+//      data [binary!]
+//          "Plaintext (at most 16384 bytes)"
+//  ]
+//
+static REBNATIVE(tls_seal)
+{
+    INCLUDE_PARAMS_OF_TLS_SEAL;
+
+    if (VAL_HANDLE_CLEANER(ARG(ctx)) != cleanup_tls_aead_ctx)
+        fail (Error(RE_EXT_CRYPT_INVALID_TLS_CONTEXT, ARG(ctx)));
+
+    TLS_AEAD_CTX *tls_ctx = cast(TLS_AEAD_CTX*, VAL_HANDLE_POINTER(ARG(ctx)));
+
+    REBCNT len = VAL_LEN_AT(ARG(data));
+    if (len > TLS_MAX_PLAINTEXT)
+        fail (Error(RE_EXT_CRYPT_TLS_RECORD_OVERFLOW, ARG(data)));
+    if (VAL_LEN_AT(ARG(version)) < 2)
+        fail (Error_Invalid_Arg(ARG(version)));
+
+    REBYTE aad[13];
+    Tls_Aead_Header(aad, VAL_INT64(ARG(seq)), ARG(type), ARG(version), len);
+
+    REBYTE nonce[CHACHA20_NONCE_SIZE];
+    Tls_Aead_Nonce(nonce, tls_ctx, aad);
+
+    REBCNT explicit_len =
+        (tls_ctx->method == TLS_AEAD_AES_GCM) ? TLS_GCM_EXPLICIT_NONCE : 0;
+
+    REBCNT out_len = explicit_len + len + TLS_AEAD_TAG_SIZE;
+    REBSER *out = Make_Binary(out_len);
+    REBYTE *bp = BIN_HEAD(out);
+
+    memcpy(bp, aad, explicit_len); // the sequence number bytes
+    bp += explicit_len;
+
+    if (tls_ctx->method == TLS_AEAD_AES_GCM)
+        AES_gcm_seal(
+            &tls_ctx->gcm, nonce, aad, sizeof(aad),
+            VAL_BIN_AT(ARG(data)), bp, len, bp + len
+        );
+    else
+        chacha20poly1305_seal(
+            tls_ctx->key, nonce, aad, sizeof(aad),
+            VAL_BIN_AT(ARG(data)), bp, len, bp + len
+        );
+
+    SET_SERIES_LEN(out, out_len);
+    Init_Binary(D_OUT, out);
+    return R_OUT;
+}
+
+
+//
+//  tls-open: native/export [
+//
+//  "Authenticate and decrypt the payload of one TLS record."
+//
+//      return: [binary!]
+//          "Plaintext of the record"
+//      ctx [handle!]
+//          "Read context from TLS-CIPHER"
+//      seq [integer!]
+//          "Record sequence number"
+//      type [integer!]
+//          "Content type from the record header"
+//      version [binary!]
+//          "Two byte protocol version of the record"
+//      fragment [binary!]
+//          "Record payload following the 5 byte header"
+//  ]
+//
+static REBNATIVE(tls_open)
+{
+    INCLUDE_PARAMS_OF_TLS_OPEN;
+
+    if (VAL_HANDLE_CLEANER(ARG(ctx)) != cleanup_tls_aead_ctx)
+        fail (Error(RE_EXT_CRYPT_INVALID_TLS_CONTEXT, ARG(ctx)));
+
+    TLS_AEAD_CTX *tls_ctx = cast(TLS_AEAD_CTX*, VAL_HANDLE_POINTER(ARG(ctx)));
+
+    if (VAL_LEN_AT(ARG(version)) < 2)
+        fail (Error_Invalid_Arg(ARG(version)));
+
+    REBCNT explicit_len =
+        (tls_ctx->method == TLS_AEAD_AES_GCM) ? TLS_GCM_EXPLICIT_NONCE : 0;
+
+    REBYTE *fragment = VAL_BIN_AT(ARG(fragment));
+    REBCNT frag_len = VAL_LEN_AT(ARG(fragment));
+    if (frag_len < explicit_len + TLS_AEAD_TAG_SIZE)
+        fail (Error(RE_EXT_CRYPT_TLS_BAD_RECORD_MAC));
+
+    REBCNT len = frag_len - explicit_len - TLS_AEAD_TAG_SIZE;
+    if (len > TLS_MAX_PLAINTEXT)
+        fail (Error(RE_EXT_CRYPT_TLS_RECORD_OVERFLOW, ARG(fragment)));
+
+    REBYTE aad[13];
+    Tls_Aead_Header(aad, VAL_INT64(ARG(seq)), ARG(type), ARG(version), len);
+
+    // GCM takes the nonce from the wire, ChaCha20 derives it from the
+    // sequence number which the peer never sends.
+    //
+    REBYTE nonce[CHACHA20_NONCE_SIZE];
+    Tls_Aead_Nonce(nonce, tls_ctx, explicit_len != 0 ? fragment : aad);
+
+    REBYTE *cipher = fragment + explicit_len;
+
+    REBSER *out = Make_Binary(len);
+
+    int ok;
+    if (tls_ctx->method == TLS_AEAD_AES_GCM)
+        ok = AES_gcm_open(
+            &tls_ctx->gcm, nonce, aad, sizeof(aad),
+            cipher, BIN_HEAD(out), len, cipher + len
+        );
+    else
+        ok = chacha20poly1305_open(
+            tls_ctx->key, nonce, aad, sizeof(aad),
+            cipher, BIN_HEAD(out), len, cipher + len
+        );
+
+    if (!ok) {
+        Free_Series(out);
+        fail (Error(RE_EXT_CRYPT_TLS_BAD_RECORD_MAC));
+    }
+
+    SET_SERIES_LEN(out, len);
+    Init_Binary(D_OUT, out);
+    return R_OUT;
+}
+
+
 /*
 #define SEED_LEN 10
 static REBYTE seed_str[SEED_LEN] = {
@@ -40,6 +40,14 @@
 
 #define MAX_SERIES_WIDE 0x100
 
+// Largest size in bytes of the data of a series (see REBLEN)
+//
+#if defined(REB_LARGE_SERIES)
+    #define MAX_SERIES_BYTES (cast(REBU64, 1) << 48)
+#else
+    #define MAX_SERIES_BYTES cast(REBU64, MAX_I32)
+#endif
+
 inline static void SER_SET_WIDE(REBSER *s, REBYTE w) {
     CLEAR_8_RIGHT_BITS(s->info.bits);
     s->info.bits |= FLAGBYTE_RIGHT(w);
@@ -49,14 +57,14 @@ inline static void SER_SET_WIDE(REBSER *s, REBYTE w) {
 // Bias is empty space in front of head:
 //
 
-inline static REBCNT SER_BIAS(REBSER *s) {
+inline static REBLEN SER_BIAS(REBSER *s) {
     assert(GET_SER_INFO(s, SERIES_INFO_HAS_DYNAMIC));
-    return cast(REBCNT, ((s)->content.dynamic.bias >> 16) & 0xffff);
+    return cast(REBLEN, ((s)->content.dynamic.bias >> 16) & 0xffff);
 }
 
 #define MAX_SERIES_BIAS 0x1000
 
-inline static void SER_SET_BIAS(REBSER *s, REBCNT bias) {
+inline static void SER_SET_BIAS(REBSER *s, REBLEN bias) {
     assert(GET_SER_INFO(s, SERIES_INFO_HAS_DYNAMIC));
     s->content.dynamic.bias =
         (s->content.dynamic.bias & 0xffff) | (bias << 16);
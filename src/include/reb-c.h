@@ -449,6 +449,19 @@ typedef struct sInt64 {
 
 typedef i32             REBINT;     // 32 bit (64 bit defined below)
 typedef u32             REBCNT;     // 32 bit (counting number)
+
+// Series lengths, capacities and indices.  These are 32-bit unless the build
+// defines REB_LARGE_SERIES (64-bit platforms only), which allows series past
+// 4GB.  On 64-bit platforms the REBSER node is the same size either way.
+//
+#if defined(REB_LARGE_SERIES)
+    #if !defined(__LP64__) && !defined(__LLP64__)
+        #error "REB_LARGE_SERIES requires a 64-bit platform"
+    #endif
+    typedef u64         REBLEN;
+#else
+    typedef u32         REBLEN;
+#endif
 typedef i64             REBI64;     // 64 bit integer
 typedef u64             REBU64;     // 64 bit unsigned integer
 typedef float           REBD32;     // 32 bit decimal
@@ -703,6 +716,24 @@ typedef u16 REBUNI;
     #define DEAD_END
 #endif
 
+// THREAD_LOCAL gives each thread its own copy of a global.  It only expands
+// to something when the core is built with REB_INSTANCES, where each thread
+// that calls RL_Init() gets an interpreter of its own (see sys-core.h).  The
+// C11 and C++11 spellings are preferred, with the older compiler-specific
+// forms as fallbacks.
+//
+#if !defined(REB_INSTANCES)
+    #define THREAD_LOCAL
+#elif defined(__cplusplus) && __cplusplus >= 201103L
+    #define THREAD_LOCAL thread_local
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+    #define THREAD_LOCAL _Thread_local
+#elif defined(_MSC_VER)
+    #define THREAD_LOCAL __declspec(thread)
+#else
+    #define THREAD_LOCAL __thread
+#endif
+
 
 
 //=////////////////////////////////////////////////////////////////////////=//
@@ -57,6 +57,7 @@ typedef struct reb_codec_image {
         void *other;
     } extra;
     int error;
+    int scale; // DECODE: 2, 4 or 8 asks for a reduced image, if codec can
 } REBCDI;
 
 typedef REBINT (*codo)(int action, REBCDI *cdi);
@@ -169,6 +169,21 @@ Special internal defines used by RT, not Host-Kit developers:
 #ifdef TO_LINUX
     #define HAS_POSIX_SIGNAL
 
+    // Network readiness is delivered by the kernel through epoll(7), so
+    // the TCP/IP device does not have to retry every pending request on
+    // each WAIT.  (See Poll_Net() in %dev-net.c)
+    //
+    #define HAS_EPOLL
+
+    // COMPRESS/PARALLEL and TO-PNG/PARALLEL can run on worker threads.
+    // (The threads never touch interpreter state, see Run_Workers().)
+    //
+    #define HAS_PTHREADS
+
+    // Child processes can be opened as ports, see %dev-process.c
+    //
+    #define HAS_PROCESS_PORT
+
     // !!! The Atronix build introduced a differentiation between
     // a Linux build and a POSIX build, and one difference is the
     // usage of some signal functions that are not available if
@@ -47,6 +47,9 @@ enum {
     RDI_SERIAL,
 #ifdef HAS_POSIX_SIGNAL
     RDI_SIGNAL,
+#endif
+#ifdef HAS_PROCESS_PORT
+    RDI_PROCESS,
 #endif
     RDI_MAX,
     RDI_LIMIT = 32
@@ -189,8 +192,8 @@ struct rebol_devreq {
         REBYTE *data;       // data to transfer
         REBREQ *sock;       // temp link to related socket
     } common;
-    u32  length;            // length to transfer
-    u32  actual;            // length actually transferred
+    REBLEN length;          // length to transfer (see REB_LARGE_SERIES)
+    REBLEN actual;          // length actually transferred
 
     // Special fields:
     union {
@@ -211,6 +214,8 @@ struct rebol_devreq {
             u32  remote_ip;         // remote address
             u32  remote_port;       // remote port
             void *host_info;        // for DNS usage
+            u32  buffer_size;       // SO_RCVBUF/SO_SNDBUF (0 = OS default)
+            u32  transfer_size;     // current send/recv size (adapts)
         } net;
         struct {
             REBCHR *path;           //device path string (in OS local format)
@@ -222,6 +227,23 @@ struct rebol_devreq {
             u8  flow_control;       // hardware or software
 
         } serial;
+#ifdef HAS_PROCESS_PORT
+        struct {
+            char *command;          // shell command line (only for open)
+            char **argv;            // or program and arguments (only for open)
+            int pid;
+            int stdin_fd;           // -1 once closed by MODIFY
+            int stdout_fd;
+            int exit_code;          // negative signal number if killed
+            int pidfd;              // watched for exit while closing, or -1
+            i64 close_time;         // when the current close stage began
+            u8  merge_error;        // child's stderr goes to stdout_fd too
+            u8  exited;             // exit_code is valid
+            u8  output_eof;         // stdout_fd has reached end of file
+            u8  closing;            // CLOSE is pending until the child exits
+            u8  close_signal;       // last signal CLOSE sent (0 if none yet)
+        } process;
+#endif
     } special;
 };
 
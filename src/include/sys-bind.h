@@ -49,6 +49,15 @@
 // The debug build also adds another feature, that makes sure the clear count
 // matches the set count.
 //
+// Binders only use the high half.  The low half is a persistent cache of the
+// index each canon has in one context (PG_Bind_Cache_Context, which is lib)
+// so binding against that context is a field read per word, with no binder
+// to populate and clear.  Append_Context_Core() keeps it in sync, and the GC
+// moves it to the synonym which becomes canon when a canon is freed.
+//
+
+#define MAX_CACHED_BIND_INDEX 0x7FFF // bind_index.low is a signed 16 bits
+
 
 // Modes allowed by Bind related functions:
 enum {
@@ -67,7 +76,7 @@ struct Reb_Binder {
 
 
 inline static void INIT_BINDER(struct Reb_Binder *binder) {
-    binder->high = TRUE; //LOGICAL(SPORADICALLY(2)); sporadic?
+    binder->high = TRUE; // low half is the bind cache (see above)
 #if !defined(NDEBUG)
     binder->count = 0;
 #endif
@@ -438,10 +447,11 @@ static inline REBVAL *Get_Mutable_Var_May_Fail(
 // that is the only kind of specifier you can use with them).
 //
 
-inline static void Derelativize(
+inline static void Derelativize_Core(
     REBVAL *out, // relative destinations are overwritten with specified value
     const RELVAL *v,
-    REBSPC *specifier
+    REBSPC *specifier,
+    REBOOL may_escape
 ) {
     assert(NOT_END(v));
     assert(!IS_TRASH_DEBUG(v));
@@ -469,6 +479,12 @@ inline static void Derelativize(
         out->header.bits
             = v->header.bits & ~cast(REBUPT, VALUE_FLAG_RELATIVE);
         out->extra.binding = cast(REBARR*, specifier);
+
+        // The specific value may outlive the frame, so its varlist can't be
+        // reused when the frame ends (see SERIES_INFO_FRAME_ESCAPED)
+        //
+        if (may_escape)
+            SET_SER_INFO(cast(REBARR*, specifier), SERIES_INFO_FRAME_ESCAPED);
     }
     else {
         out->header = v->header;
@@ -477,6 +493,14 @@ inline static void Derelativize(
     out->payload = v->payload;
 }
 
+inline static void Derelativize(
+    REBVAL *out,
+    const RELVAL *v,
+    REBSPC *specifier
+){
+    Derelativize_Core(out, v, specifier, TRUE);
+}
+
 
 // In the C++ build, defining this overload that takes a REBVAL* instead of
 // a RELVAL*, and then not defining it...will tell you that you do not need
@@ -70,9 +70,13 @@
 #define MAX_NUM_LEN 64          // As many numeric digits we will accept on input
 #define MAX_SAFE_SERIES 5       // quanitity of most recent series to not GC.
 #define MAX_EXPAND_LIST 5       // number of series-1 in Prior_Expand list
+#define MAX_DEFLATE_WORKERS 64  // threads for Run_Workers(), see %u-compress.c
+#define MAX_REUSABLE_VARLISTS 64 // expired stack frame varlists kept for reuse
 #define UNICODE_CASES 0x2E00    // size of unicode folding table
 #define HAS_SHA1                // allow it
 #define HAS_MD5                 // allow it
+#define HAS_SHA256              // allow it (also SHA384 and SHA512)
+#define HAS_BLAKE2              // allow it (BLAKE2B and BLAKE2S)
 
 // External system includes:
 #include <stdlib.h>
@@ -289,6 +293,8 @@ typedef struct rebol_stats {
     REBCNT  Mark_Count;
     REBCNT  Blocks;
     REBCNT  Objects;
+    REBCNT  Frames_Reified;
+    REBCNT  Frames_Recycled;
 } REB_STATS;
 
 //-- Options of various kinds:
@@ -328,6 +334,17 @@ enum Boot_Levels {
     BOOT_LEVEL_FULL
 };
 
+// Where Init_Core() spends its time (see PG_Boot_Times and STATS/BOOT)
+//
+enum Boot_Timings {
+    BOOT_TIME_DECOMPRESS, // inflating the embedded boot block
+    BOOT_TIME_LOAD, // turning it into arrays
+    BOOT_TIME_INIT, // symbols, datatypes, natives, actions, errors, sysobj
+    BOOT_TIME_BIND, // binding the base, sys, and mezzanine code
+    BOOT_TIME_RUN, // running it (including schemes and protocols)
+    BOOT_TIME_MAX
+};
+
 // Modes allowed by Make_Series function:
 enum {
     MKS_NONE        = 0,        // data is opaque (not delved into by the GC)
@@ -602,11 +619,20 @@ enum Reb_Vararg_Op {
 // Despite this basic work for threading, greater issues were not hammered
 // out.  And so this separation really just caused problems when two different
 // threads wanted to work with the same data (at different times).  Such a
-// feature is better implemented as in the V8 JavaScript engine as "isolates"  
+// feature is better implemented as in the V8 JavaScript engine as "isolates"
+//
+// Building with REB_INSTANCES takes a step in that direction: every PVAR and
+// TVAR becomes THREAD_LOCAL, so each thread that calls RL_Init() boots an
+// interpreter with its own word table, contexts, memory pools, stacks, and
+// GC.  Such instances share nothing and need no locking, but a REBVAL made
+// by one must never be handed to another.  (Only the host library and the
+// device layer are process-wide.)  The split between PVAR and TVAR is kept,
+// since it still says which variables would be shared if instances were
+// ever to share immutable boot data.
 
 #ifdef __cplusplus
-    #define PVAR extern "C"
-    #define TVAR extern "C"
+    #define PVAR extern "C" THREAD_LOCAL
+    #define TVAR extern "C" THREAD_LOCAL
 #else
     // When being preprocessed by TCC and combined with the user - native
     // code, all global variables need to be declared
@@ -615,10 +641,10 @@ enum Reb_Vararg_Op {
     // PVAR and TVAR allow for overriding at the compiler command line.
     //
     #if !defined(PVAR)
-        #define PVAR extern
+        #define PVAR extern THREAD_LOCAL
     #endif
     #if !defined(TVAR)
-        #define TVAR extern
+        #define TVAR extern THREAD_LOCAL
     #endif
 #endif
 
@@ -271,6 +271,7 @@ inline static void Lookback_For_Set_Word_Or_Set_Path(REBVAL *out, REBFRM *f)
     enum Reb_Kind kind = VAL_TYPE(DS_TOP);
     if (kind == REB_SET_WORD) {
         *out = *DS_TOP;
+        Note_Binding_Escaped(out); // pushed without noting, see Do_Core()
         SET_VAL_FLAG(out, VALUE_FLAG_UNEVALUATED);
         VAL_SET_TYPE_BITS(DS_TOP, REB_GET_WORD); // See Do_Core/ET_SET_WORD
     }
@@ -316,6 +317,7 @@ inline static void Do_Pending_Sets_May_Invalidate_Gotten(
         case REB_SET_WORD: {
             f->refine = Sink_Var_May_Fail(DS_TOP, SPECIFIED);
             *f->refine = *out;
+            Note_Binding_Escaped(out); // see SERIES_INFO_FRAME_ESCAPED
             if (f->refine == f->gotten)
                 f->gotten = NULL;
             break; }
@@ -333,6 +335,8 @@ inline static void Do_Pending_Sets_May_Invalidate_Gotten(
             break;
 
         case REB_SET_PATH: {
+            Note_Binding_Escaped(out); // see SERIES_INFO_FRAME_ESCAPED
+
             REBVAL hack = *DS_TOP; // can't path eval from data stack, yet
 
             if (Do_Path_Throws_Core(
@@ -421,7 +425,10 @@ inline static void Do_Next_In_Frame_May_Throw(
     // we do with lookups here will be reused if we can't avoid a frame.
     //
     if (IS_KIND_INERT(child->eval_type)) {
-        Derelativize(out, parent->value, parent->specifier);
+        //
+        // (not noted as escaping, see SERIES_INFO_FRAME_ESCAPED)
+        //
+        Derelativize_Core(out, parent->value, parent->specifier, FALSE);
         SET_VAL_FLAG(out, VALUE_FLAG_UNEVALUATED);
     }
     else {
@@ -565,7 +572,10 @@ no_optimization:
 inline static void Quote_Next_In_Frame(REBVAL *dest, REBFRM *f) {
     TRACE_FETCH_DEBUG("Quote_Next_In_Frame", f, FALSE);
 
-    Derelativize(dest, f->value, f->specifier);
+    // Like the inert case in Do_Next_In_Frame_May_Throw(), this doesn't note
+    // the frame as escaped.  See SERIES_INFO_FRAME_ESCAPED for where it is.
+    //
+    Derelativize_Core(dest, f->value, f->specifier, FALSE);
     SET_VAL_FLAG(dest, VALUE_FLAG_UNEVALUATED);
     f->gotten = NULL;
     Fetch_Next_In_Frame(f);
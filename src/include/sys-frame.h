@@ -639,6 +639,9 @@ inline static void Drop_Function_Args_For_Frame_Core(
     REBFRM *f,
     REBOOL drop_chunks
 ) {
+    if (PG_Profiling)
+        Profile_Exit(f); // see Profile_Enter() in Do_Core()
+
     // The frame may be reused for another function call, and that function
     // may not start with native code (or use native code at all).
     //
@@ -714,6 +717,18 @@ inline static void Drop_Function_Args_For_Frame_Core(
     assert(NOT_SER_INFO(f->varlist, SERIES_INFO_INACCESSIBLE));
     SET_SER_INFO(f->varlist, SERIES_INFO_INACCESSIBLE);
 
+    // If nothing ever got a reference to the varlist (it was only used as
+    // the specifier for running the body) then nothing can notice if the
+    // node gets reused for the next frame that needs a context.  That saves
+    // making a new managed node for every call of an interpreted function.
+    //
+    if (
+        NOT_SER_INFO(f->varlist, SERIES_INFO_FRAME_ESCAPED)
+        && TG_Num_Reusable_Varlists < MAX_REUSABLE_VARLISTS
+    ){
+        TG_Reusable_Varlists[TG_Num_Reusable_Varlists++] = f->varlist;
+    }
+
 finished:
 
     TRASH_POINTER_IF_DEBUG(f->args_head);
@@ -723,9 +738,43 @@ finished:
 }
 
 
+// A value which was derelativized without being noted as escaping (such as
+// a pending SET-WORD! on the data stack) must be noted if it gets copied
+// anywhere that could outlive its frame.  A FUNCTION! can refer to a frame
+// too: the definitional RETURN and LEAVE are bound to the varlist (other
+// functions may be bound to a paramlist, which is left alone).
+//
+inline static void Note_Binding_Escaped(const REBVAL *v)
+{
+    if (ANY_WORD(v) || ANY_ARRAY(v)) {
+        if (v->extra.binding != NULL)
+            SET_SER_INFO(v->extra.binding, SERIES_INFO_FRAME_ESCAPED);
+    }
+    else if (IS_FUNCTION(v)) {
+        if (
+            v->extra.binding != NULL
+            && GET_SER_FLAG(v->extra.binding, ARRAY_FLAG_VARLIST)
+        ){
+            SET_SER_INFO(v->extra.binding, SERIES_INFO_FRAME_ESCAPED);
+        }
+    }
+}
+
+inline static void Note_Args_Escaped(REBVAL *arg, REBCNT num_args)
+{
+    for (; num_args != 0; --num_args, ++arg)
+        Note_Binding_Escaped(arg);
+}
+
+
 // This routine ensures that a valid REBCTX* (suitable for putting into a
 // FRAME! REBVAL) exists for a Reb_Frame stack structure.
 //
+// The caller may let the context outlive the frame, so the varlist is marked
+// as escaped and will not be reused when the frame ends.  The same goes for
+// the frames that its arguments are bound to (which weren't noted when the
+// call started if it has FUNC_FLAG_ARGS_DONT_ESCAPE).
+//
 inline static REBCTX *Context_For_Frame_May_Reify_Managed(REBFRM *f)
 {
     assert(NOT(Is_Function_Frame_Fulfilling(f)));
@@ -733,5 +782,23 @@ inline static REBCTX *Context_For_Frame_May_Reify_Managed(REBFRM *f)
     if (f->varlist == NULL || NOT_SER_FLAG(f->varlist, ARRAY_FLAG_VARLIST))
         Reify_Frame_Context_Maybe_Fulfilling(f); // it's not fulfilling, here
 
+    SET_SER_INFO(f->varlist, SERIES_INFO_FRAME_ESCAPED);
+    Note_Args_Escaped(f->args_head, FUNC_NUM_PARAMS(f->underlying));
     return AS_CONTEXT(f->varlist);
 }
+
+
+// Dispatchers that only need the frame as the specifier for running a body
+// use this instead.  Values made from that body are noted when they can
+// outlive the call (see SERIES_INFO_FRAME_ESCAPED), so the varlist stays
+// reusable unless one of those is.
+//
+inline static REBSPC *Specifier_For_Frame_May_Reify(REBFRM *f)
+{
+    assert(NOT(Is_Function_Frame_Fulfilling(f)));
+
+    if (f->varlist == NULL || NOT_SER_FLAG(f->varlist, ARRAY_FLAG_VARLIST))
+        Reify_Frame_Context_Maybe_Fulfilling(f); // it's not fulfilling, here
+
+    return AS_SPECIFIER(AS_CONTEXT(f->varlist));
+}
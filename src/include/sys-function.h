@@ -141,6 +141,13 @@ inline static REBRIN *FUNC_ROUTINE(REBFUN *f) {
 //
 #define FUNC_FLAG_USER_NATIVE FUNC_FLAG(4)
 
+// Set on natives like IF and EITHER which only evaluate their arguments or
+// return them, never keeping them anywhere else.  A BLOCK! passed to one of
+// these doesn't keep the frame it is bound to alive past its call, see
+// SERIES_INFO_FRAME_ESCAPED.
+//
+#define FUNC_FLAG_ARGS_DONT_ESCAPE FUNC_FLAG(5)
+
 #if !defined(NDEBUG)
     //
     // This flag is set on the canon function value when a proxy for a
@@ -149,12 +156,12 @@ inline static REBRIN *FUNC_ROUTINE(REBFUN *f) {
     // function implementation after digging through the layers...because
     // proxies must have new (cloned) paramlists but use the original bodies.
     //
-    #define FUNC_FLAG_PROXY_DEBUG FUNC_FLAG(5)
+    #define FUNC_FLAG_PROXY_DEBUG FUNC_FLAG(6)
 
     // BLANK! ("none!") for unused refinements instead of FALSE
     // Also, BLANK! for args of unused refinements instead of not set
     //
-    #define FUNC_FLAG_LEGACY_DEBUG FUNC_FLAG(6)
+    #define FUNC_FLAG_LEGACY_DEBUG FUNC_FLAG(7)
 
     // If a function is a native then it may provide return information as
     // documentation, but not want to pay for the run-time check of whether
@@ -162,7 +169,7 @@ inline static REBRIN *FUNC_ROUTINE(REBFUN *f) {
     // to double-check.  So when MKF_FAKE_RETURN is used in a debug build,
     // it leaves this flag on the function.
     //
-    #define FUNC_FLAG_RETURN_DEBUG FUNC_FLAG(7)
+    #define FUNC_FLAG_RETURN_DEBUG FUNC_FLAG(8)
 #endif
 
 
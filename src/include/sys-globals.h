@@ -46,6 +46,7 @@ PVAR REBINT PG_Boot_Level;  // User specified startup level
 
 PVAR REBU64 PG_Mem_Usage;   // Overall memory used
 PVAR REBU64 PG_Mem_Limit;   // Memory limit set by SECURE
+PVAR REBU64 PG_Series_Made; // Count of Make_Series() calls, for PROFILE
 
 // In Ren-C, words are REBSER nodes (REBSTR subtype).  They may be GC'd (unless
 // they are in the %words.r list, in which case their canon forms are
@@ -57,11 +58,10 @@ PVAR REBU64 PG_Mem_Limit;   // Memory limit set by SECURE
 // according to the total number of canons in the system.
 //
 PVAR REBSTR *PG_Symbol_Canons; // Canon symbol pointers for words in %words.r
-PVAR REBSTR *PG_Canons_By_Hash; // Canon REBSER pointers indexed by hash
-PVAR REBCNT PG_Num_Canon_Slots_In_Use; // Total canon hash slots (+ deleteds)
-#if !defined(NDEBUG)
-    PVAR REBCNT PG_Num_Canon_Deleteds; // Deleted canon hash slots "in use"
-#endif
+PVAR REBSER *PG_Canons_By_Hash; // Canon REBSER pointers (and hash tags)
+PVAR REBSER *PG_Canons_By_Hash_Old; // Table being moved from while growing
+PVAR REBCNT PG_Canons_Migrated; // Slots of the old table moved so far
+PVAR REBCNT PG_Num_Canons; // Total canons in the table
 
 //-- Main contexts:
 PVAR REBCTX *PG_Root_Context; // Frame that holds Root_Vars
@@ -69,6 +69,7 @@ PVAR ROOT_VARS *Root_Vars; // VARLIST of PG_Root_Context as a C structure
 
 PVAR REBCTX *Lib_Context;
 PVAR REBCTX *Sys_Context;
+PVAR REBCTX *PG_Bind_Cache_Context; // Key indices are on canons (see binding)
 
 //-- Various char tables:
 PVAR REBYTE *White_Chars;
@@ -79,6 +80,7 @@ PVAR REBUNI *Lower_Cases;
 PVAR REBYTE *PG_Pool_Map;   // Memory pool size map (created on boot)
 
 PVAR REBI64 PG_Boot_Time;   // Counter when boot started
+PVAR REBI64 PG_Boot_Times[BOOT_TIME_MAX]; // Microseconds per part of boot
 PVAR REB_OPTS *Reb_Opts;
 
 #ifndef NDEBUG
@@ -114,6 +116,19 @@ PVAR REBFLGS Eval_Signals;   // Signal flags
 //
 PVAR REBBRK PG_Breakpoint_Quitting_Hook;
 
+// Number of calls after which an interpreted function is compiled by TCC,
+// or 0 if they are only compiled when asked.  (See %c-jit.c)
+//
+PVAR REBCNT PG_Jit_Threshold;
+
+// Whether function calls are being measured by PROFILE (see %d-profile.c)
+//
+PVAR REBOOL PG_Profiling;
+
+// Whether Make_Series() notes where series are made (see %d-alloc.c)
+//
+PVAR REBOOL PG_Series_Profiling;
+
 
 /***********************************************************************
 **
@@ -175,6 +190,13 @@ TVAR struct Reb_Chunk *TG_Top_Chunk;
 TVAR struct Reb_Chunk *TG_Head_Chunk;
 TVAR struct Reb_Chunker *TG_Root_Chunker;
 
+// Varlist nodes of expired stack frames which were never captured by any
+// value, available to be reused by Reify_Frame_Context_Maybe_Fulfilling().
+// They stay managed (and are kept alive by the GC) while in this list.
+//
+TVAR REBARR *TG_Reusable_Varlists[MAX_REUSABLE_VARLISTS];
+TVAR REBCNT TG_Num_Reusable_Varlists;
+
 TVAR struct Reb_State *Saved_State; // Saved state for Catch (CPU state, etc.)
 
 #if !defined(NDEBUG)
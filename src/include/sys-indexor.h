@@ -48,10 +48,22 @@
 // https://github.com/metaeducation/ren-c/wiki/
 //
 
-#if defined(NDEBUG) || !defined(__cplusplus) || (__cplusplus < 201103L)
+// Series positions past 2GB are possible with REB_LARGE_SERIES, so then the
+// flags are moved out of the way to the top of the 64-bit range.  (The C++
+// checking class is built around REBCNT, so it is not used in that case.)
+//
+#if defined(REB_LARGE_SERIES)
+    #define INDEXOR_FLAG_BASE (cast(REBUPT, 1) << 63)
+#else
+    #define INDEXOR_FLAG_BASE 0x80000000
+#endif
+
+#if defined(NDEBUG) || !defined(__cplusplus) || (__cplusplus < 201103L) \
+    || defined(REB_LARGE_SERIES)
+
     typedef REBUPT REBIXO;
 
-    #define END_FLAG 0x80000000  // end of block as index
+    #define END_FLAG INDEXOR_FLAG_BASE  // end of block as index
     #define THROWN_FLAG (END_FLAG - 0x75) // throw as an index
 
     // The VA_LIST_FLAG is the index used when a C va_list pointer is input.
@@ -64,20 +76,29 @@
     #define VA_LIST_FLAG (END_FLAG - 0xBD)
 
     // These are not actually used with REBIXO, but have a similar purpose...
-    // fold a flag into an integer (like a std::optional<REBCNT>).
+    // fold a flag into an integer (like a std::optional<REBCNT>).  NOT_FOUND
+    // is a series position, so it is a REBLEN (see REB_LARGE_SERIES).
     //
-    #define NOT_FOUND ((REBCNT)-1)
+    #define NOT_FOUND ((REBLEN)-1)
     #define UNKNOWN   ((REBCNT)-1)
 #else
     class NOT_FOUND_t {
     public:
         NOT_FOUND_t () {} // clang won't initialize const object w/o this
+        operator REBLEN() const {
+            return ((REBLEN)-1);
+        }
+    };
+    const NOT_FOUND_t NOT_FOUND;
+
+    class UNKNOWN_t {
+    public:
+        UNKNOWN_t () {}
         operator REBCNT() const {
             return ((REBCNT)-1);
         }
     };
-    const NOT_FOUND_t NOT_FOUND;
-    const NOT_FOUND_t UNKNOWN;
+    const UNKNOWN_t UNKNOWN;
 
     class REBIXO {
         //
@@ -95,6 +116,10 @@
         void operator=(NOT_FOUND_t const &) = delete;
         int operator==(NOT_FOUND_t const &rhs) const = delete;
         int operator!=(NOT_FOUND_t const &rhs) const = delete;
+        REBIXO (UNKNOWN_t const &) = delete;
+        void operator=(UNKNOWN_t const &) = delete;
+        int operator==(UNKNOWN_t const &rhs) const = delete;
+        int operator!=(UNKNOWN_t const &rhs) const = delete;
 
     public:
         REBIXO () {} // simulate C uninitialization
@@ -134,7 +159,7 @@
         // should be extracted by casting to a REBCNT.
         //
         friend int operator==(REBCNT lhs, const REBIXO &rhs) {
-            assert(lhs != UNKNOWN && lhs != NOT_FOUND);
+            assert(lhs != UNKNOWN); // same bits as 32-bit NOT_FOUND
             return lhs == rhs.bits;
         }
         friend int operator!=(REBCNT lhs, const REBIXO &rhs) {
@@ -204,5 +229,5 @@
 // does not apply (e.g. END, THROWN, VA_LIST)
 //
 #if !defined(NDEBUG)
-    #define TRASHED_INDEX (0x80000000 - 0xAE)
+    #define TRASHED_INDEX (INDEXOR_FLAG_BASE - 0xAE)
 #endif
@@ -309,7 +309,7 @@ typedef int boolean;
 #define D_PROGRESSIVE_SUPPORTED     /* Progressive JPEG? (Requires MULTISCAN)*/
 //#define SAVE_MARKERS_SUPPORTED        /* jpeg_save_markers() needed? */
 //#define BLOCK_SMOOTHING_SUPPORTED   /* Block smoothing? (Progressive only) */
-//#define IDCT_SCALING_SUPPORTED        /* Output rescaling via IDCT? */
+#define IDCT_SCALING_SUPPORTED      /* Output rescaling via IDCT? */
 //#undef  UPSAMPLE_SCALING_SUPPORTED  /* Output rescaling at upsample stage? */
 //#define UPSAMPLE_MERGING_SUPPORTED  /* Fast path for sloppy upsampling? */
 #define QUANT_1PASS_SUPPORTED       /* 1-pass color quantization? */
@@ -366,6 +366,19 @@ typedef int boolean;
 #endif
 
 
+/* The decoder's slow-but-accurate IDCT and its YCbCr color conversion have
+ * AVX2 versions, used when the CPU has AVX2 (checked once at run time).
+ * They give exactly the same output as the C code.  Define JPEG_NO_SIMD
+ * to build without them.
+ */
+
+#if !defined(JPEG_NO_SIMD) && defined(__GNUC__) \
+    && (defined(__x86_64__) || defined(__i386__))
+#define JPEG_SIMD
+#define JPEG_SIMD_TARGET __attribute__((target("avx2")))
+#endif
+
+
 /* FAST_FLOAT should be either float or double, whichever is done faster
  * by your compiler.  (Note that this type is only used in the floating point
  * DCT routines, so it only matters if you've defined DCT_FLOAT_SUPPORTED.)
@@ -977,7 +990,8 @@ typedef enum {
     JCS_RGB,        /* red/green/blue */
     JCS_YCbCr,      /* Y/Cb/Cr (also known as YUV) */
     JCS_CMYK,       /* C/M/Y/K */
-    JCS_YCCK        /* Y/Cb/Cr/K */
+    JCS_YCCK,       /* Y/Cb/Cr/K */
+    JCS_PIXEL       /* 32-bit TO_PIXEL_COLOR() values, as in a REBOL image */
 } J_COLOR_SPACE;
 
 /* DCT/IDCT algorithm options. */
@@ -2329,8 +2343,13 @@ EXTERN(void) jpeg_make_d_derived_tbl
  * necessary.
  */
 
+#if defined(__LP64__) || defined(_WIN64)
+typedef unsigned long long bit_buf_type; /* type of bit-extraction buffer */
+#define BIT_BUF_SIZE  64    /* size of buffer in bits */
+#else
 typedef INT32 bit_buf_type; /* type of bit-extraction buffer */
 #define BIT_BUF_SIZE  32    /* size of buffer in bits */
+#endif
 
 /* If long is > 32 bits on your machine, and shifting/masking longs is
  * reasonably fast, making bit_buf_type be long and setting BIT_BUF_SIZE
@@ -2578,6 +2597,12 @@ EXTERN(void) jpeg_idct_2x2
 EXTERN(void) jpeg_idct_1x1
     JPP((j_decompress_ptr cinfo, jpeg_component_info * compptr,
      JCOEFPTR coef_block, JSAMPARRAY output_buf, JDIMENSION output_col));
+#ifdef JPEG_SIMD
+EXTERN(boolean) jpeg_simd_avx2 JPP((void));
+EXTERN(void) jpeg_idct_islow_avx2
+    JPP((j_decompress_ptr cinfo, jpeg_component_info * compptr,
+     JCOEFPTR coef_block, JSAMPARRAY output_buf, JDIMENSION output_col));
+#endif
 
 
 /*
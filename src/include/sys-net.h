@@ -60,6 +60,10 @@ typedef long __LONG;
 #include <netinet/in.h>
 #include <unistd.h>
 
+#ifdef HAS_EPOLL
+#include <sys/epoll.h>
+#endif
+
 #define GET_ERROR       errno
 #define IOCTL           ioctl
 #define CLOSE_SOCKET    close
@@ -93,5 +97,7 @@ typedef struct hostent HOSTENT;
 typedef struct sockaddr_in SOCKAI; // Internet extensions
 
 #define BAD_SOCKET (~0)
-#define MAX_TRANSFER 32000      // Max send/recv buffer size
+#define MIN_TRANSFER 32000      // Initial send/recv size per device call
+#define MAX_TRANSFER (4 * 1024 * 1024) // Limit of the adaptive send/recv size
 #define MAX_HOST_NAME 256       // Max length of host name
+#define MAX_NET_EVENTS 256      // Max readiness events taken per poll
@@ -408,6 +408,40 @@
     FLAGIT_LEFT(11)
 
 
+//=//// SERIES_INFO_FRAME_ESCAPED ///////////////////////////////////////////=//
+//
+// Set on a frame's varlist when anything outside of the running function
+// may be holding a reference to it.  A CONTEXT_FLAG_STACK varlist without
+// this flag is known to die with its frame, so the node can be reused by the
+// next reification instead of being left for the GC.
+//
+// The evaluator makes a specific value out of every BLOCK! or WORD! in the
+// body that it quotes or passes as an argument, so that alone can't count
+// (or no frame that ran an IF would qualify).  Instead the escape is noted
+// where such a value can be kept past the frame's end:
+//
+// * It is assigned by a SET-WORD! or SET-PATH!
+// * It is an argument to a function without FUNC_FLAG_ARGS_DONT_ESCAPE
+// * It is the result of the function whose frame it refers to
+// * It is copied by other C code with Derelativize() (e.g. deep copies)
+// * The frame holding it is handed out as a FRAME! (debugger, EXIT/FROM,
+//   variadics...) or the frame itself is
+//
+#define SERIES_INFO_FRAME_ESCAPED \
+    FLAGIT_LEFT(12)
+
+
+//=//// SERIES_INFO_DECODED /////////////////////////////////////////////////=//
+//
+// Set on a frozen array once the evaluator has made a pre-decoded instruction
+// stream for it, which is held in ->link.decoded.  Only arrays that can never
+// change are decoded, so the stream does not need to be invalidated.  It is
+// freed along with the array.  (See Decode_Array() in %c-eval.c)
+//
+#define SERIES_INFO_DECODED \
+    FLAGIT_LEFT(13)
+
+
 // ^-- STOP AT FLAGIT_LEFT(15) --^
 //
 // The rightmost 16 bits of the series info is used to store an 8 bit length
@@ -415,7 +449,7 @@
 // flags need to stop at FLAGIT_LEFT(15).
 //
 #if defined(__cplusplus) && (__cplusplus >= 201103L)
-    static_assert(11 < 16, "SERIES_INFO_XXX too high");
+    static_assert(13 < 16, "SERIES_INFO_XXX too high");
 #endif
 
 
@@ -468,22 +502,27 @@ struct Reb_Series_Dynamic {
 
     // `len` is one past end of useful data.
     //
-    REBCNT len;
+    REBLEN len;
 
     // `rest` is the total number of units from bias to end.  Having a
     // slightly weird name draws attention to the idea that it's not really
     // the "capacity", just the "rest of the capacity after the bias".
     //
-    REBCNT rest;
+    REBLEN rest;
 
     // This is the 4th pointer on 32-bit platforms which could be used for
     // something when a series is dynamic.  Previously the bias was not
     // a full REBCNT but was limited in range to 16 bits or so.  This means
     // 16 info bits are likely available if needed for dynamic series.
     //
-    REBCNT bias;
+    REBLEN bias;
 
-#if defined(__LP64__) || defined(__LLP64__)
+#if defined(REB_LARGE_SERIES)
+    //
+    // With 64-bit REBLENs the fields above fill the space of a REBVAL, so
+    // the slots mentioned below are not available.
+    //
+#elif defined(__LP64__) || defined(__LLP64__)
     //
     // The Reb_Series_Dynamic is used in Reb_Series inside of a union with a
     // REBVAL.  On 64-bit machines this will leave one unused 32-bit slot
@@ -548,6 +587,8 @@ struct Reb_Series {
         REBARR *schema; // for STRUCT (a REBFLD, parallels object's keylist)
         REBCTX *meta; // paramlists and keylists can store a "meta" object
         REBSTR *synonym; // circularly linked list of othEr-CaSed string forms
+        REBUPT calls; // FUNCTION! body holder, counts calls toward JIT
+        REBYTE *decoded; // frozen arrays run by Do_Core, see Decode_Array()
     } link;
 
     union Reb_Series_Content content;
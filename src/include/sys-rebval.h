@@ -306,7 +306,7 @@ struct Reb_Any_Series {
     // in a systemic way.  VAL_LEN_AT() bounds the length at the index
     // position by the physical length, but VAL_ARRAY_AT() doesn't check.
     //
-    REBCNT index;
+    REBLEN index;
 };
 
 struct Reb_Typeset {
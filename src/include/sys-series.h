@@ -199,13 +199,13 @@
 #define SER_WIDE(s) \
     RIGHT_8_BITS((s)->info.bits) // inlining unnecessary
 
-inline static REBCNT SER_LEN(REBSER *s) {
+inline static REBLEN SER_LEN(REBSER *s) {
     return GET_SER_INFO(s, SERIES_INFO_HAS_DYNAMIC)
         ? s->content.dynamic.len
         : MID_8_BITS(s->info.bits);
 }
 
-inline static void SET_SERIES_LEN(REBSER *s, REBCNT len) {
+inline static void SET_SERIES_LEN(REBSER *s, REBLEN len) {
     assert(NOT_SER_FLAG(s, CONTEXT_FLAG_STACK));
 
     if (GET_SER_INFO(s, SERIES_INFO_HAS_DYNAMIC)) {
@@ -219,7 +219,7 @@ inline static void SET_SERIES_LEN(REBSER *s, REBCNT len) {
     }
 }
 
-inline static REBCNT SER_REST(REBSER *s) {
+inline static REBLEN SER_REST(REBSER *s) {
     if (GET_SER_INFO(s, SERIES_INFO_HAS_DYNAMIC))
         return s->content.dynamic.rest;
 
@@ -241,7 +241,7 @@ inline static REBYTE *SER_DATA_RAW(REBSER *s) {
         : cast(REBYTE*, &s->content);
 }
 
-inline static REBYTE *SER_AT_RAW(REBYTE w, REBSER *s, REBCNT i) {
+inline static REBYTE *SER_AT_RAW(REBYTE w, REBSER *s, REBLEN i) {
 #if !defined(NDEBUG)
     if (w != SER_WIDE(s)) {
         //
@@ -310,7 +310,7 @@ inline static REBYTE *SER_LAST_RAW(size_t w, REBSER *s) {
 // Optimized expand when at tail (but, does not reterminate)
 //
 
-inline static void EXPAND_SERIES_TAIL(REBSER *s, REBCNT delta) {
+inline static void EXPAND_SERIES_TAIL(REBSER *s, REBLEN delta) {
     if (SER_FITS(s, delta))
         SET_SERIES_LEN(s, SER_LEN(s) + delta);
     else
@@ -326,7 +326,7 @@ inline static void TERM_SEQUENCE(REBSER *s) {
     memset(SER_AT_RAW(SER_WIDE(s), s, SER_LEN(s)), 0, SER_WIDE(s));
 }
 
-inline static void TERM_SEQUENCE_LEN(REBSER *s, REBCNT len) {
+inline static void TERM_SEQUENCE_LEN(REBSER *s, REBLEN len) {
     SET_SERIES_LEN(s, len);
     TERM_SEQUENCE(s);
 }
@@ -496,6 +496,24 @@ inline static void FAIL_IF_READ_ONLY_SERIES(REBSER *s) {
     }
 }
 
+// Series positions are REBLEN, but some helpers used by datatype actions
+// (Modify_Array(), the array copiers, trim, sort, shuffle...) still take
+// REBCNT or REBINT.  The actions that call those check the series with
+// this first.  A series too long for them (only possible in REB_LARGE_SERIES
+// builds) raises an error, instead of being indexed with truncated positions.
+//
+inline static void FAIL_IF_LARGE_SERIES(REBSER *s) {
+#if defined(REB_LARGE_SERIES)
+    if (SER_LEN(s) > MAX_I32) {
+        REBVAL temp;
+        SET_INTEGER(&temp, MAX_I32);
+        fail (Error(RE_SIZE_LIMIT, &temp));
+    }
+#else
+    UNUSED(s);
+#endif
+}
+
 
 //=////////////////////////////////////////////////////////////////////////=//
 //
@@ -586,7 +604,7 @@ inline static void INIT_VAL_SERIES(RELVAL *v, REBSER *s) {
 #define VAL_LEN_HEAD(v) \
     SER_LEN(VAL_SERIES(v))
 
-inline static REBCNT VAL_LEN_AT(const RELVAL *v) {
+inline static REBLEN VAL_LEN_AT(const RELVAL *v) {
     if (VAL_INDEX(v) >= VAL_LEN_HEAD(v))
         return 0; // avoid negative index
     return VAL_LEN_HEAD(v) - VAL_INDEX(v); // take current index into account
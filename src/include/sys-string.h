@@ -158,11 +158,11 @@ inline static void TERM_UNI_LEN(REBSER *s, REBCNT len) {
 // Get a char, from either byte or unicode string:
 //
 
-inline static REBUNI GET_ANY_CHAR(REBSER *s, REBCNT n) {
+inline static REBUNI GET_ANY_CHAR(REBSER *s, REBLEN n) {
     return BYTE_SIZE(s) ? BIN_HEAD(s)[n] : UNI_HEAD(s)[n];
 }
 
-inline static void SET_ANY_CHAR(REBSER *s, REBCNT n, REBYTE c) {
+inline static void SET_ANY_CHAR(REBSER *s, REBLEN n, REBYTE c) {
     if BYTE_SIZE(s)
         BIN_HEAD(s)[n] = c;
     else
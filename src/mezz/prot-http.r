@@ -12,7 +12,7 @@ REBOL [
     Name: http
     Type: module
     File: %prot-http.r
-    Version: 0.1.47
+    Version: 0.1.48
     Purpose: {
         This program defines the HTTP protocol scheme for REBOL 3.
     }
@@ -48,7 +48,7 @@ idate-to-date: function [date [string!]] [
 
 sync-op: function [port body] [
     unless port/state [
-        open port
+        unless reuse-connection port [open port]
         port/state/close?: yes
     ]
 
@@ -74,7 +74,9 @@ sync-op: function [port body] [
 
     body: copy port
     
-    if state/close? [close port]
+    if state/close? [
+        unless release-connection port [close port]
+    ]
 
     either port/spec/debug [
         state/connection/locals
@@ -127,6 +129,17 @@ http-awake: func [event /local port http-port state awake res] [
             awake make event! [type: 'connect port: http-port]
         ]
         close [
+            if all [
+                state/reused?
+                find [doing-request reading-headers] state/state
+            ][
+                ; The server dropped an idle keep-alive connection before it
+                ; answered, so retry once on a fresh connection.
+                state/reused?: false
+                close port
+                open port
+                return false
+            ]
             res: switch state/state [
                 ready [
                     awake make event! [type: 'close port: http-port]
@@ -214,7 +227,7 @@ make-http-request: func [
     result: rejoin [
         uppercase form method #" "
         either file? target [next mold target] [target]
-        " HTTP/1.0" CRLF
+        " HTTP/1.1" CRLF
     ]
     for-each [word string] headers [
         join result [mold word #" " string CRLF]
@@ -443,6 +456,99 @@ http-response-headers: context [
     Content-Length: _
     Transfer-Encoding: _
     Last-Modified: _
+    Connection: _
+]
+
+; Connections of finished synchronous requests are kept open for reuse by
+; the next request to the same server, as `key port` pairs in this block.
+; Only plain HTTP is pooled (the TLS port does not support reopening).
+;
+idle-connections: copy []
+max-idle-connections: 16
+
+connection-key: func [spec [object!]] [
+    rejoin [spec/scheme "://" spec/host ":" spec/port-id]
+]
+
+idle-awake: func [event [event!] /local pos] [
+    if find [close error] event/type [
+        if pos: find idle-connections event/port [
+            remove/part back pos 2
+        ]
+        close event/port
+    ]
+    false
+]
+
+make-http-state: func [port [port!]] [
+    port/state: has [
+        state: 'inited
+        connection: _
+        error: _
+        close?: no
+        reused?: no
+        info: construct port/scheme/info [type: 'file]
+        awake: :port/awake
+    ]
+]
+
+reuse-connection: func [
+    "Give the port an idle connection to its server, if there is one"
+    port [port!]
+    /local pos conn
+][
+    unless all [
+        port/spec/host
+        pos: find idle-connections connection-key port/spec
+    ][
+        return false
+    ]
+    conn: second pos
+    remove/part pos 2
+
+    make-http-state port
+    port/state/connection: conn
+    port/state/reused?: yes
+    port/state/state: 'ready
+    conn/data: _
+    conn/awake: :http-awake
+    conn/locals: port
+    true
+]
+
+release-connection: func [
+    "Keep a finished request's connection for reuse instead of closing it"
+    port [port!]
+    /local state conn headers
+][
+    state: port/state
+    conn: state/connection
+    unless all [
+        port/spec/scheme = 'http
+        state/state = 'ready
+        open? conn
+        headers: state/info/headers
+        find/match state/info/response-line "HTTP/1.1"
+        not all [
+            string? headers/connection
+            headers/connection = "close"
+        ]
+        any [
+            integer? headers/content-length
+            headers/transfer-encoding = "chunked"
+            port/spec/method = 'head
+            find [no-content not-modified] state/info/response-parsed
+        ]
+        max-idle-connections > ((length idle-connections) / 2)
+    ][
+        return false
+    ]
+
+    conn/awake: :idle-awake
+    conn/locals: _
+    append idle-connections reduce [connection-key port/spec conn]
+    port/state: _
+    true
 ]
 do-redirect: func [port [port!] new-uri [url! string! file!] /local spec state] [
     spec: port/spec
@@ -477,7 +583,7 @@ do-redirect: func [port [port!] new-uri [url! string! file!] /local spec state]
         state/awake make event! [type: 'error port: port]
     ]
 ]
-check-data: func [port /local headers res data out chunk-size mk1 mk2 trailer state conn] [
+check-data: func [port /local headers res data trailer state conn] [
     state: port/state
     headers: state/info/headers
     conn: state/connection
@@ -487,42 +593,17 @@ check-data: func [port /local headers res data out chunk-size mk1 mk2 trailer st
             data: conn/data
             ;clear the port data only at the beginning of the request --Richard
             unless port/data [port/data: make binary! length data]
-            out: port/data
-            loop-until [
-                either parse data [
-                    copy chunk-size some hex-digits thru crlfbin mk1: to end
-                ] [
-                    ; The chunk size is in the byte stream as ASCII chars
-                    ; forming a hex string.  ISSUE! can decode that.
-                    chunk-size: (
-                        to-integer/unsigned to issue! to string! chunk-size
-                    )
 
-                    either chunk-size = 0 [
-                        if parse mk1 [
-                            crlfbin (trailer: "") to end | copy trailer to crlf2bin to end
-                        ] [
-                            trailer: has/only trailer
-                            append headers body-of trailer
-                            state/state: 'ready
-                            res: state/awake make event! [type: 'custom port: port code: 0]
-                            clear data
-                        ]
-                        true
-                    ] [
-                        either parse mk1 [
-                            chunk-size skip mk2: crlfbin to end
-                        ] [
-                            insert/part tail out mk1 mk2
-                            remove/part data skip mk2 2
-                            empty? data
-                        ] [
-                            true
-                        ]
-                    ]
-                ] [
-                    true
+            ; DECHUNK moves whole chunks from the connection's buffer into
+            ; the port data, leaving any partial chunk for the next READ.
+            ;
+            if trailer: dechunk data port/data [
+                unless empty? trailer [
+                    append headers scan-net-header trailer
                 ]
+                state/state: 'ready
+                res: state/awake make event! [type: 'custom port: port code: 0]
+                clear data
             ]
             unless state/state = 'ready [
                 ;Awake from the WAIT loop to prevent timeout when reading big data. --Richard
@@ -553,7 +634,6 @@ check-data: func [port /local headers res data out chunk-size mk1 mk2 trailer st
     ]
     res
 ]
-hex-digits: charset "1234567890abcdefABCDEF"
 sys/make-scheme [
     name: 'http
     title: "HyperText Transport Protocol v1.1"
@@ -643,14 +723,7 @@ sys/make-scheme [
             unless port/spec/host [
                 fail make-http-error "Missing host address"
             ]
-            port/state: has [
-                state: 'inited
-                connection: _
-                error: _
-                close?: no
-                info: construct port/scheme/info [type: 'file]
-                awake: :port/awake
-            ]
+            make-http-state port
             port/state/connection: conn: make port! compose [
                 scheme: (
                     to lit-word! either port/spec/scheme = 'http ['tcp]['tls]
@@ -1,16 +1,16 @@
 REBOL [
-    Title: "REBOL 3 TLSv1.0 protocol scheme"
+    Title: "REBOL 3 TLSv1.0 - TLSv1.2 protocol scheme"
     Name: tls
     Type: module
     Author: "Richard 'Cyphre' Smolak"
-    Version: 0.6.1
+    Version: 0.7.0
     Todo: {
         -cached sessions
         -automagic cert data lookup
-        -add more cipher suites (based on DSA, 3DES, ECDH, ECDHE, ECDSA, SHA256, SHA384 ...)
+        -add more cipher suites (based on DSA, 3DES, ECDSA, SHA384 ...)
         -server role support
-        -SSL3.0, TLS1.1/1.2 compatibility
-        -cert validation
+        -SSL3.0 compatibility
+        -cert validation, ServerKeyExchange signature verification
     }
 ]
 
@@ -44,7 +44,16 @@ make-tls-error: func [
     ]
 ]
 
+; Listed in order of preference.  The AEAD suites are TLS 1.2 only, and
+; their record protection is done natively by TLS-SEAL and TLS-OPEN.
+;
 cipher-suites: has [
+    TLS_ECDHE_RSA_WITH_CHACHA20_POLY1305_SHA256: #{CC A8}
+    TLS_ECDHE_RSA_WITH_AES_128_GCM_SHA256:  #{C0 2F}
+    TLS_DHE_RSA_WITH_AES_128_GCM_SHA256:    #{00 9E}
+    TLS_RSA_WITH_AES_128_GCM_SHA256:        #{00 9C}
+    TLS_ECDHE_RSA_WITH_AES_128_CBC_SHA:     #{C0 13}
+    TLS_ECDHE_RSA_WITH_AES_256_CBC_SHA:     #{C0 14}
     TLS_RSA_WITH_RC4_128_MD5:               #{00 04}
     TLS_RSA_WITH_RC4_128_SHA:               #{00 05}
     TLS_RSA_WITH_AES_128_CBC_SHA:           #{00 2F}
@@ -244,7 +253,7 @@ update-proto-state: func [
 client-hello: func [
     ctx [object!]
     /local
-        beg len cs-data
+        beg len cs-data extensions name
 ] [
     ; generate client random struct
     ctx/client-random: to-bin to-integer difference now/precise 1-Jan-1970 4
@@ -253,6 +262,26 @@ client-hello: func [
 
     cs-data: rejoin values-of cipher-suites
 
+    extensions: rejoin [
+        #{00 0A 00 04 00 02 00 1D}  ; supported_groups: x25519
+        #{00 0B 00 02 01 00}        ; ec_point_formats: uncompressed
+        #{00 0D 00 0A 00 08}        ; signature_algorithms, RSA PKCS#1 with...
+        #{04 01 05 01 06 01 02 01}  ; ...SHA256, SHA384, SHA512, SHA1
+        #{FF 01 00 01 00}           ; renegotiation_info (initial handshake)
+    ]
+    if string? ctx/host [
+        ; server_name (SNI), needed by servers hosting several certificates
+        name: to binary! ctx/host
+        insert extensions rejoin [
+            #{00 00}
+            to-bin 5 + length name 2    ; extension length
+            to-bin 3 + length name 2    ; server name list length
+            #{00}                       ; name type (0=host_name)
+            to-bin length name 2
+            name
+        ]
+    ]
+
     beg: length ctx/msg
     emit ctx [
         #{16}                       ; protocol type (22=Handshake)
@@ -260,13 +289,15 @@ client-hello: func [
         #{00 00}                    ; length of SSL record data
         #{01}                       ; protocol message type (1=ClientHello)
         #{00 00 00}                 ; protocol message length
-        ctx/version                 ; max supported version by client (TLS1.0)
+        ctx/client-version          ; max supported version by client (TLS1.2)
         ctx/client-random           ; random struct (4 bytes gmt unix time + 28 random bytes)
         #{00}                       ; session ID length
         to-bin length cs-data 2     ; cipher suites length
         cs-data                     ; cipher suites list
         #{01}                       ; compression method length
         #{00}                       ; no compression
+        to-bin length extensions 2  ; extensions length
+        extensions
     ]
 
     ; set the correct msg lengths
@@ -285,8 +316,8 @@ client-key-exchange: func [
 ] [
     switch ctx/key-method [
         rsa [
-            ; generate pre-master-secret
-            ctx/pre-master-secret: copy ctx/version
+            ; generate pre-master-secret (starts with the version offered)
+            ctx/pre-master-secret: copy ctx/client-version
             random/seed now/time/precise
             loop 46 [append ctx/pre-master-secret (random/secure 256) - 1]
 
@@ -308,6 +339,18 @@ client-key-exchange: func [
             ; generate pre-master-secret
             ctx/pre-master-secret: dh-compute-key ctx/dh-key ctx/dh-pub
         ]
+        ecdhe-rsa [
+            ; generate an ephemeral X25519 private key
+            ctx/ecdh-key: make binary! 32
+            random/seed now/time/precise
+            loop 32 [append ctx/ecdh-key (random/secure 256) - 1]
+
+            ; supply the client's public key to server
+            key-data: x25519 ctx/ecdh-key
+
+            ; generate pre-master-secret
+            ctx/pre-master-secret: x25519/shared ctx/ecdh-key ctx/ecdh-pub
+        ]
     ]
 
     beg: length ctx/msg
@@ -317,7 +360,7 @@ client-key-exchange: func [
         #{00 00}                    ; length of SSL record data
         #{10}                       ; protocol message type (16=ClientKeyExchange)
         #{00 00 00}                 ; protocol message length
-        to-bin length key-data 2    ; length of the key (2 bytes)
+        to-bin length key-data either ctx/key-method = 'ecdhe-rsa [1] [2] ; length of the key (EC point is 1 byte, others 2)
         key-data
     ]
 
@@ -336,9 +379,9 @@ client-key-exchange: func [
     ctx/client-crypt-key: copy/part skip ctx/key-block 2 * ctx/hash-size ctx/crypt-size
     ctx/server-crypt-key: copy/part skip ctx/key-block (2 * ctx/hash-size) + ctx/crypt-size ctx/crypt-size
 
-    if ctx/block-size [
-        ctx/client-iv: copy/part skip ctx/key-block 2 * (ctx/hash-size + ctx/crypt-size) ctx/block-size
-        ctx/server-iv: copy/part skip ctx/key-block (2 * (ctx/hash-size + ctx/crypt-size)) + ctx/block-size ctx/block-size
+    if ctx/iv-size [
+        ctx/client-iv: copy/part skip ctx/key-block 2 * (ctx/hash-size + ctx/crypt-size) ctx/iv-size
+        ctx/server-iv: copy/part skip ctx/key-block (2 * (ctx/hash-size + ctx/crypt-size)) + ctx/iv-size ctx/iv-size
     ]
 
     append ctx/handshake-messages copy at ctx/msg beg + 6
@@ -380,13 +423,23 @@ encrypted-handshake-msg: func [
 application-data: func [
     ctx [object!]
     message [binary! string!]
+    /local
+        data
 ] [
-    message: encrypt-data ctx to binary! message
-    emit ctx [
-        #{17}                       ; protocol type (23=Application)
-        ctx/version                 ; protocol version (3|1 = TLS1.0)
-        to-bin length message 2     ; length of SSL record data
-        message
+    ; records carry at most 16384 bytes of plaintext, so large writes are
+    ; split.  DO-COMMANDS bumps the sequence number after the last record.
+    ;
+    message: to binary! message
+    forever [
+        data: encrypt-data ctx copy/part message 16384
+        emit ctx [
+            #{17}                       ; protocol type (23=Application)
+            ctx/version                 ; protocol version (3|1 = TLS1.0)
+            to-bin length data 2        ; length of SSL record data
+            data
+        ]
+        if tail? message: skip message 16384 [break]
+        ctx/seq-num-w: ctx/seq-num-w + 1
     ]
     return ctx/msg
 ]
@@ -395,7 +448,7 @@ alert-close-notify: func [
     ctx [object!]
     /local message
 ] [
-    message: encrypt-data ctx #{0100} ; close notify
+    message: encrypt-data/type ctx #{0100} #{15} ; close notify
     emit ctx [
         #{15}                       ; protocol type (21=Alert)
         ctx/version                 ; protocol version (3|1 = TLS1.0)
@@ -406,6 +459,19 @@ alert-close-notify: func [
 ]
 
 
+handshake-hash: func [
+    ctx [object!]
+] [
+    either tls-1.2? ctx [
+        checksum/method ctx/handshake-messages 'sha256
+    ][
+        rejoin [
+            checksum/method ctx/handshake-messages 'md5
+            checksum/method ctx/handshake-messages 'sha1
+        ]
+    ]
+]
+
 finished: func [
     ctx [object!]
 ] [
@@ -413,9 +479,7 @@ finished: func [
     return rejoin [
         #{14}       ; protocol message type (20=Finished)
         #{00 00 0c} ; protocol message length (12 bytes)
-        prf ctx/master-secret either ctx/server? ["server finished"] ["client finished"] rejoin [
-            checksum/method ctx/handshake-messages 'md5 checksum/method ctx/handshake-messages 'sha1
-        ] 12
+        prf/(all [tls-1.2? ctx 'sha256]) ctx/master-secret either ctx/server? ["server finished"] ["client finished"] handshake-hash ctx 12
     ]
 ]
 
@@ -427,7 +491,14 @@ encrypt-data: func [
     /local
         mac padding len
 ] [
-        data: rejoin [
+    if ctx/aead? [
+        unless ctx/encrypt-stream [
+            ctx/encrypt-stream: tls-cipher ctx/crypt-method ctx/client-crypt-key ctx/client-iv
+        ]
+        return tls-seal ctx/encrypt-stream ctx/seq-num-w first any [:msg-type #{17}] ctx/version data
+    ]
+
+    data: rejoin [
         data
         ; MAC code
         mac: checksum/method/key rejoin [
@@ -444,6 +515,14 @@ encrypt-data: func [
         padding: ctx/block-size - ((1 + (length data)) // ctx/block-size)
         len: 1 + padding
         append data head insert/dup make binary! len to-bin padding 1 len
+
+        ; TLS 1.1+ has no chained IV between records: each record starts
+        ; with a random block, which the receiver decrypts and discards.
+        if ctx/explicit-iv? [
+            padding: make binary! ctx/block-size
+            loop ctx/block-size [append padding (random/secure 256) - 1]
+            insert data padding
+        ]
     ]
 
     switch ctx/crypt-method [
@@ -467,9 +546,18 @@ encrypt-data: func [
 decrypt-data: func [
     ctx [object!]
     data [binary!]
+    /type
+        msg-type [integer!] "content type of the record, needed for AEAD"
     /local
         crypt-data
 ] [
+    if ctx/aead? [
+        unless ctx/decrypt-stream [
+            ctx/decrypt-stream: tls-cipher ctx/crypt-method ctx/server-crypt-key ctx/server-iv
+        ]
+        return tls-open ctx/decrypt-stream ctx/seq-num-r msg-type ctx/version data
+    ]
+
     switch ctx/crypt-method [
         rc4 [
             unless ctx/decrypt-stream [
@@ -545,7 +633,8 @@ parse-protocol: func [
     ]
     return context [
         type: proto
-        version: pick [ssl-v3 tls-v1.0 tls-v1.1] data/3 + 1
+        content-type: data/1
+        version: pick [ssl-v3 tls-v1.0 tls-v1.1 tls-v1.2] data/3 + 1
         size: to-integer/unsigned copy/part at data 4 2
         messages: copy/part at data 6 size
     ]
@@ -561,14 +650,19 @@ parse-messages: func [
     data: proto/messages
 
     if ctx/encrypted? [
-        change data decrypt-data ctx data
         debug ["decrypting..."]
-        if ctx/block-size [
-            ; deal with padding in CBC mode
-            data: copy/part data (
-                ((length data) - 1) - (to-integer/unsigned last data)
-            )
-            debug ["depadding..."]
+        either ctx/aead? [
+            data: decrypt-data/type ctx data proto/content-type
+        ][
+            change data decrypt-data ctx data
+            if ctx/block-size [
+                ; deal with padding in CBC mode
+                data: copy/part data (
+                    ((length data) - 1) - (to-integer/unsigned last data)
+                )
+                debug ["depadding..."]
+                if ctx/explicit-iv? [data: skip data ctx/block-size]
+            ]
         ]
         debug ["data:" data]
     ]
@@ -600,7 +694,7 @@ parse-messages: func [
 
                         msg-obj: context [
                             type: msg-type
-                            version: pick [ssl-v3 tls-v1.0 tls-v1.1] data/6 + 1
+                            version: pick [ssl-v3 tls-v1.0 tls-v1.1 tls-v1.2] data/6 + 1
                             length: len
                             server-random: copy/part msg-content 32
                             session-id: copy/part at msg-content 34 msg-content/33
@@ -615,8 +709,64 @@ parse-messages: func [
                         ]
                         ctx/cipher-suite: msg-obj/cipher-suite
 
+                        ; adopt the version chosen by the server
+                        unless find [tls-v1.0 tls-v1.1 tls-v1.2] msg-obj/version [
+                            fail ["Unsupported TLS version:" (msg-obj/version)]
+                        ]
+                        ctx/version: copy/part at data 5 2
+
                         ; note: the cipher-suite config will be more automatized in later versions
                         switch/default ctx/cipher-suite reduce bind [
+                            TLS_ECDHE_RSA_WITH_CHACHA20_POLY1305_SHA256 [
+                                ctx/key-method: 'ecdhe-rsa
+                                ctx/crypt-method: 'chacha20-poly1305
+                                ctx/crypt-size: 32
+                                ctx/iv-size: 12
+                                ctx/hash-size: 0
+                                ctx/aead?: true
+                            ]
+                            TLS_ECDHE_RSA_WITH_AES_128_GCM_SHA256 [
+                                ctx/key-method: 'ecdhe-rsa
+                                ctx/crypt-method: 'aes-128-gcm
+                                ctx/crypt-size: 16
+                                ctx/iv-size: 4
+                                ctx/hash-size: 0
+                                ctx/aead?: true
+                            ]
+                            TLS_DHE_RSA_WITH_AES_128_GCM_SHA256 [
+                                ctx/key-method: 'dhe-rsa
+                                ctx/crypt-method: 'aes-128-gcm
+                                ctx/crypt-size: 16
+                                ctx/iv-size: 4
+                                ctx/hash-size: 0
+                                ctx/aead?: true
+                            ]
+                            TLS_RSA_WITH_AES_128_GCM_SHA256 [
+                                ctx/key-method: 'rsa
+                                ctx/crypt-method: 'aes-128-gcm
+                                ctx/crypt-size: 16
+                                ctx/iv-size: 4
+                                ctx/hash-size: 0
+                                ctx/aead?: true
+                            ]
+                            TLS_ECDHE_RSA_WITH_AES_128_CBC_SHA [
+                                ctx/key-method: 'ecdhe-rsa
+                                ctx/crypt-method: 'aes
+                                ctx/crypt-size: 16
+                                ctx/block-size: 16
+                                ctx/iv-size: 16
+                                ctx/hash-method: 'sha1
+                                ctx/hash-size: 20
+                            ]
+                            TLS_ECDHE_RSA_WITH_AES_256_CBC_SHA [
+                                ctx/key-method: 'ecdhe-rsa
+                                ctx/crypt-method: 'aes
+                                ctx/crypt-size: 32
+                                ctx/block-size: 16
+                                ctx/iv-size: 16
+                                ctx/hash-method: 'sha1
+                                ctx/hash-size: 20
+                            ]
                             TLS_RSA_WITH_RC4_128_SHA [
                                 ctx/key-method: 'rsa
                                 ctx/crypt-method: 'rc4
@@ -692,6 +842,11 @@ parse-messages: func [
                             ]
                         ]
 
+                        ctx/explicit-iv?: all [
+                            ctx/block-size
+                            ctx/version/2 >= 2 ; TLS 1.1 and up
+                        ]
+
                         ctx/server-random: msg-obj/server-random
                         msg-obj
                     ]
@@ -713,8 +868,9 @@ parse-messages: func [
                         ctx/certificate: parse-asn msg-obj/certificate-list/1
 
                         switch/default ctx/key-method [
-                            rsa [
+                            rsa ecdhe-rsa [
                                 ; get the public key and exponent (hardcoded for now)
+                                ; ECDHE-RSA uses it to check the key exchange signature
                                 ctx/pub-key: parse-asn next
 ;                               ctx/certificate/1/sequence/4/1/sequence/4/6/sequence/4/2/bit-string/4
                                 ctx/certificate/1/sequence/4/1/sequence/4/7/sequence/4/2/bit-string/4
@@ -751,6 +907,39 @@ parse-messages: func [
                                 ; TODO: the signature sent by server should be verified using DSA or RSA algorithm to be sure the dh-key params are safe
                                 msg-obj
                             ]
+                            ecdhe-rsa [
+                                msg-content: copy/part at data 5 len
+                                unless all [
+                                    msg-content/1 = 3                           ; curve type (3=named_curve)
+                                    #{00 1D} = copy/part at msg-content 2 2     ; x25519, the only group offered
+                                ] [
+                                    fail "Server chose an unsupported elliptic curve"
+                                ]
+                                unless all [
+                                    len >= 4
+                                    len >= 4 + msg-content/4
+                                ] [
+                                    fail "Server-key-exchange public key exceeds the message"
+                                ]
+                                msg-obj: context [
+                                    type: msg-type
+                                    length: len
+                                    public-length: msg-content/4
+                                    public: copy/part at msg-content 5 public-length
+                                    signature: copy at msg-content 5 + public-length
+                                ]
+
+                                ; the server signs both randoms and the curve
+                                ; parameters with its certificate's key
+                                verify-key-exchange ctx rejoin [
+                                    ctx/client-random
+                                    ctx/server-random
+                                    copy/part msg-content 4 + msg-obj/public-length
+                                ] msg-obj/signature
+
+                                ctx/ecdh-pub: msg-obj/public
+                                msg-obj
+                            ]
                         ] [
                             fail "Server-key-exchange message sent illegally."
                         ]
@@ -765,7 +954,7 @@ parse-messages: func [
                         msg-content: copy/part at data 7 len
                         context [
                             type: msg-type
-                            version: pick [ssl-v3 tls-v1.0 tls-v1.1] data/6 + 1
+                            version: pick [ssl-v3 tls-v1.0 tls-v1.1 tls-v1.2] data/6 + 1
                             length: len
                             content: msg-content
                         ]
@@ -773,7 +962,7 @@ parse-messages: func [
                     finished [
                         ctx/seq-num-r: 0
                         msg-content: copy/part at data 5 len
-                        either msg-content <> prf ctx/master-secret either ctx/server? ["client finished"] ["server finished"] rejoin [checksum/method ctx/handshake-messages 'md5 checksum/method ctx/handshake-messages 'sha1] 12 [
+                        either msg-content <> prf/(all [tls-1.2? ctx 'sha256]) ctx/master-secret either ctx/server? ["client finished"] ["server finished"] handshake-hash ctx 12 [
                             fail "Bad 'finished' MAC"
                         ] [
                             debug "FINISHED MAC verify: OK"
@@ -788,7 +977,7 @@ parse-messages: func [
 
                 append ctx/handshake-messages copy/part data len + 4
 
-                data: skip data len + either ctx/encrypted? [
+                data: skip data len + either all [ctx/encrypted? not ctx/aead?] [
                     ; check the MAC
                     mac: copy/part skip data len + 4 ctx/hash-size
                     if mac <> checksum/method/key rejoin [
@@ -809,6 +998,7 @@ parse-messages: func [
         ]
         change-cipher-spec [
             ctx/encrypted?: true
+            ctx/seq-num-r: -1 ; first protected record is 0 after the bump below
             append result context [
                 type: 'ccs-message-type
             ]
@@ -820,15 +1010,17 @@ parse-messages: func [
             ]
             len: length msg-obj/content
             mac: copy/part skip data len ctx/hash-size
-            ; check the MAC
-            if mac <> checksum/method/key rejoin [
-                to-bin ctx/seq-num-r 8  ; sequence number (64-bit int in R3)
-                #{17}                   ; msg type
-                ctx/version             ; version
-                to-bin len 2            ; msg content length
-                msg-obj/content         ; content
-            ] ctx/hash-method decode 'text ctx/server-mac-key
-            [
+            ; check the MAC (AEAD records were already authenticated)
+            if all [
+                not ctx/aead?
+                mac <> checksum/method/key rejoin [
+                    to-bin ctx/seq-num-r 8  ; sequence number (64-bit int in R3)
+                    #{17}                   ; msg type
+                    ctx/version             ; version
+                    to-bin len 2            ; msg content length
+                    msg-obj/content         ; content
+                ] ctx/hash-method decode 'text ctx/server-mac-key
+            ][
                 fail "Bad application record MAC"
             ]
         ]
@@ -859,14 +1051,88 @@ parse-response: func [
     return proto
 ]
 
+tls-1.2?: func [ctx [object!]] [
+    ctx/version/2 >= 3
+]
+
+verify-key-exchange: func [
+    "Fail unless SIGNATURE is the server's RSA signature of DATA (RFC 5246 7.4.3)"
+    ctx [object!]
+    data [binary!] "client random, server random and the key parameters"
+    signature [binary!] "digitally-signed struct that ends the message"
+    /local
+        digest-info hash sig-length rsa-key block
+] [
+    either tls-1.2? ctx [
+        ; PKCS#1 DigestInfo prefixes for the hashes offered in client-hello
+        ; (SignatureAndHashAlgorithm is the hash, then 1 for RSA)
+        hash: _
+        if all [2 <= length signature signature/2 = 1] [
+            switch signature/1 [
+                2 [hash: 'sha1 digest-info: #{3021300906052B0E03021A05000414}]
+                4 [hash: 'sha256 digest-info: #{3031300D060960864801650304020105000420}]
+                5 [hash: 'sha384 digest-info: #{3041300D060960864801650304020205000430}]
+                6 [hash: 'sha512 digest-info: #{3051300D060960864801650304020305000440}]
+            ]
+        ]
+        unless hash [
+            fail "Server-key-exchange uses an unsupported signature algorithm"
+        ]
+        hash: append copy digest-info checksum/method data hash
+        signature: skip signature 2
+    ] [
+        ; TLS 1.0 and 1.1 sign MD5 and SHA1 of the data, with no DigestInfo
+        hash: append checksum/method data 'md5 checksum/method data 'sha1
+    ]
+
+    rsa-key: rsa-make-key
+    rsa-key/e: ctx/pub-exp
+    rsa-key/n: ctx/pub-key
+
+    sig-length: either 2 <= length signature [
+        to-integer/unsigned copy/part signature 2
+    ] [0]
+    unless all [
+        sig-length = length rsa-key/n
+        sig-length + 2 <= length signature
+        sig-length >= 11 + length hash
+    ] [
+        fail "Bad server-key-exchange signature length"
+    ]
+
+    ; RSA/DECRYPT with a public key gives the whole block back, which has to
+    ; be exactly 00 01 FF..FF 00 followed by the hash
+    block: rsa/decrypt copy/part skip signature 2 sig-length rsa-key
+    unless block = rejoin [
+        #{0001}
+        append/dup copy #{} #{FF} sig-length - 3 - length hash
+        #{00}
+        hash
+    ] [
+        fail "Server-key-exchange signature does not verify"
+    ]
+]
+
 prf: func [
     secret [binary!]
     label [string! binary!]
     seed [binary!]
     output-length [integer!]
+    /sha256 "TLS 1.2 PRF, P_SHA256 (default is TLS 1.0/1.1 MD5 xor SHA1)"
     /local
-        len mid s-1 s-2 a p-sha1 p-md5
+        len mid s-1 s-2 a p-sha1 p-md5 p-sha256
 ] [
+    if sha256 [
+        seed: rejoin [#{} label seed]
+        p-sha256: copy #{}
+        a: seed ; A(0)
+        while [output-length > length p-sha256] [
+            a: checksum/method/key a 'sha256 decode 'text secret ; A(n)
+            append p-sha256 checksum/method/key rejoin [a seed] 'sha256 decode 'text secret
+        ]
+        return copy/part p-sha256 output-length
+    ]
+
     len: length secret
     mid: to integer! (.5 * (len + either odd? len [1] [0]))
 
@@ -895,13 +1161,13 @@ prf: func [
 make-key-block: func [
     ctx [object!]
 ] [
-    ctx/key-block: prf
+    ctx/key-block: prf/(all [tls-1.2? ctx 'sha256])
         ctx/master-secret
         "key expansion"
         rejoin [ctx/server-random ctx/client-random]
         (
             (ctx/hash-size + ctx/crypt-size)
-            + (either ctx/block-size [ctx/iv-size] [0])
+            + (any [ctx/iv-size 0])
         ) * 2
 ]
 
@@ -909,7 +1175,7 @@ make-master-secret: func [
     ctx [object!]
     pre-master-secret [binary!]
 ] [
-    ctx/master-secret: prf
+    ctx/master-secret: prf/(all [tls-1.2? ctx 'sha256])
         pre-master-secret
         "master secret"
         rejoin [ctx/client-random ctx/server-random]
@@ -1117,7 +1383,7 @@ tls-awake: function [event [event!]] [
 
 sys/make-scheme [
     name: 'tls
-    title: "TLS protocol v1.0"
+    title: "TLS protocol v1.2"
     spec: construct system/standard/port-spec-net []
     actor: [
         read: func [
@@ -1150,7 +1416,9 @@ sys/make-scheme [
                 port-data: make binary! 32000
                 resp: _
 
-                version: #{03 01} ; protocol version used
+                version: #{03 01} ; record version until the server picks one
+                client-version: #{03 03} ; highest version offered (TLS1.2)
+                host: port/spec/host ; for server name indication
 
                 server?: false
 
@@ -1188,6 +1456,10 @@ sys/make-scheme [
                 key-block:
                 certificate: pub-key: pub-exp:
                 dh-key: dh-pub: blank
+                ecdh-key: ecdh-pub: blank
+
+                aead?: false
+                explicit-iv?: false
 
                 encrypt-stream: decrypt-stream: blank
 
@@ -1238,7 +1510,7 @@ sys/make-scheme [
                         port/state/decrypt-stream: _ ;-- will be GC'd
                     ]
                 ]
-                aes [
+                aes aes-128-gcm aes-256-gcm chacha20-poly1305 [
                     if port/state/encrypt-stream [
                         port/state/encrypt-stream: _ ;-- will be GC'd
                     ]
@@ -65,10 +65,12 @@ decode: function [
     {Decodes a series of bytes into the related datatype (e.g. image!).}
     type [word!] {Media type (jpeg, png, etc.)}
     data [binary!] {The data to decode}
+    /scale {Decode an image at reduced size (JPEG only, others ignore it)}
+    denom [integer!] {1, 2, 4 or 8 (for 1/2, 1/4 or 1/8 of each dimension)}
 ][
     unless all [
         cod: select system/codecs type
-        data: do-codec cod/entry 'decode data
+        data: do-codec/scale cod/entry 'decode data any [denom 1]
     ][
         cause-error 'access 'no-codec type
     ]
@@ -83,10 +85,13 @@ encode: function [
 ][
     unless all [
         cod: select system/codecs type
-        ;encode patch replacing internal PNG encoder crash for now
         data: switch/default cod/name [
             png [
-                lib/to-png data
+                ; e.g. [level 9 parallel 4], see TO-PNG
+                opts: any [opts []]
+                lib/to-png/level/parallel data
+                    any [select opts 'level -1]
+                    any [select opts 'parallel 1]
             ]
         ][
             do-codec cod/entry 'encode data
@@ -324,6 +324,13 @@ init-schemes: func [
             name: 'signal
             spec: system/standard/port-spec-signal
         ]
+
+        make-scheme [
+            title: "Child Process"
+            name: 'process
+            spec: system/standard/port-spec-process
+            info: system/standard/process-info ; for C enums
+        ]
     ]
 
     make-scheme [
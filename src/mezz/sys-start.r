@@ -83,9 +83,10 @@ finish-init-core: procedure [
     comment [if :lib/secure [protect-system-object]]
 
     ; The mezzanine is currently considered part of what Init_Core() will
-    ; initialize for all clients.
+    ; initialize for all clients.  (It has already been bound to lib, as
+    ; BIND-LIB would, so that Init_Core() can time binding separately.)
     ;
-    do bind-lib boot-mezz
+    do boot-mezz
 
     ; For now, we also consider initializing the port schemes to be "part of
     ; the core function".  Longer term, it needs to be the host's
@@ -56,6 +56,18 @@ typedef int socklen_t;
 extern HWND Event_Handle; // For WSAAsync API
 #endif
 
+#ifdef HAS_EPOLL
+//
+// All sockets of the device are registered with a single epoll instance,
+// using the REBREQ as the event's user data.  Registration is one-shot: a
+// socket only reports readiness after a command on it has gone pending and
+// re-armed it with the direction it is waiting on (see Arm_Socket()).  The
+// handle is also waited on by Query_Events() in %dev-event.c, so WAIT wakes
+// up as soon as any pending socket becomes ready.
+//
+int Net_Epoll_Handle = -1;
+#endif
+
 
 /***********************************************************************
 **
@@ -99,6 +111,87 @@ static REBOOL Nonblocking_Mode(SOCKET sock)
 #endif
 }
 
+static void Set_Buffer_Size(REBREQ *sock)
+{
+    // Ask the OS for the socket buffer size given in the port spec.  It
+    // is only a hint (Linux doubles it, and caps it at rmem_max/wmem_max),
+    // so failure is not an error.
+    int size = cast(int, sock->special.net.buffer_size);
+    if (size == 0)
+        return;
+
+    setsockopt(
+        sock->requestee.socket, SOL_SOCKET, SO_RCVBUF,
+        cast(char*, &size), sizeof(size)
+    );
+    setsockopt(
+        sock->requestee.socket, SOL_SOCKET, SO_SNDBUF,
+        cast(char*, &size), sizeof(size)
+    );
+}
+
+static long Transfer_Limit(REBREQ *sock)
+{
+    // Largest size the transfer is allowed to grow to.  A port with an
+    // explicit buffer size does not move more than that per call, so the
+    // awake handler sees data in the granularity it asked for.
+    //
+    u32 limit = sock->special.net.buffer_size;
+    if (limit == 0 || limit > MAX_TRANSFER)
+        limit = MAX_TRANSFER;
+    return limit;
+}
+
+static u32 First_Transfer_Size(REBREQ *sock)
+{
+    // Transfers start out small and grow (see Adapt_Transfer_Size()), but
+    // never start above the port's own limit.
+    //
+    return MIN(MIN_TRANSFER, cast(u32, Transfer_Limit(sock)));
+}
+
+static void Adapt_Transfer_Size(REBREQ *sock, long len, long result)
+{
+    // Each full-sized send or recv means more data was probably ready to
+    // move, so the next call is allowed twice the size.  Short results
+    // shrink it back, so idle interactive ports don't keep big buffers.
+    //
+    u32 size = sock->special.net.transfer_size;
+
+    if (result >= len && len == cast(long, size)) {
+        if (size < cast(u32, Transfer_Limit(sock)))
+            sock->special.net.transfer_size = MIN(
+                size * 2, cast(u32, Transfer_Limit(sock))
+            );
+    }
+    else if (result < cast(long, size / 4) && size > First_Transfer_Size(sock))
+        sock->special.net.transfer_size = MAX(
+            size / 2, First_Transfer_Size(sock)
+        );
+}
+
+static void Arm_Socket(REBREQ *sock, REBOOL writing)
+{
+    // Ask for one readiness notification in the direction the pending
+    // command waits on.  Sockets accepted by a listener have not been seen
+    // by epoll yet (their REBREQ gets copied into the new port), so they
+    // are registered on the first arm.
+#ifdef HAS_EPOLL
+    struct epoll_event ev;
+    ev.events = (writing ? EPOLLOUT : EPOLLIN) | EPOLLONESHOT;
+    ev.data.ptr = sock;
+
+    if (epoll_ctl(
+        Net_Epoll_Handle, EPOLL_CTL_MOD, sock->requestee.socket, &ev
+    ) != 0 && errno == ENOENT) {
+        epoll_ctl(Net_Epoll_Handle, EPOLL_CTL_ADD, sock->requestee.socket, &ev);
+    }
+#else
+    UNUSED(sock);
+    UNUSED(writing);
+#endif
+}
+
 
 //
 //  Init_Net: C
@@ -114,6 +207,12 @@ DEVICE_CMD Init_Net(REBREQ *dr)
     // Initialize Windows Socket API with given VERSION.
     // It is ok to call twice, as long as WSACleanup twice.
     if (WSAStartup(0x0101, &wsaData)) return DR_ERROR;
+#endif
+#ifdef HAS_EPOLL
+    if (Net_Epoll_Handle < 0) {
+        Net_Epoll_Handle = epoll_create1(EPOLL_CLOEXEC);
+        if (Net_Epoll_Handle < 0) return DR_ERROR;
+    }
 #endif
     SET_FLAG(dev->flags, RDF_INIT);
     return DR_DONE;
@@ -130,6 +229,12 @@ DEVICE_CMD Quit_Net(REBREQ *dr)
     REBDEV *dev = (REBDEV*)dr; // just to keep compiler happy
 #ifdef TO_WINDOWS
     if (GET_FLAG(dev->flags, RDF_INIT)) WSACleanup();
+#endif
+#ifdef HAS_EPOLL
+    if (Net_Epoll_Handle >= 0) {
+        close(Net_Epoll_Handle);
+        Net_Epoll_Handle = -1;
+    }
 #endif
     CLR_FLAG(dev->flags, RDF_INIT);
     return DR_DONE;
@@ -206,6 +311,9 @@ DEVICE_CMD Open_Socket(REBREQ *sock)
 
     sock->requestee.socket = result;
     SET_FLAG(sock->state, RSM_OPEN);
+    sock->special.net.transfer_size = First_Transfer_Size(sock);
+
+    Set_Buffer_Size(sock);
 
     // Set socket to non-blocking async mode:
     if (!Nonblocking_Mode(sock->requestee.socket)) {
@@ -213,6 +321,21 @@ DEVICE_CMD Open_Socket(REBREQ *sock)
         return DR_ERROR;
     }
 
+#ifdef HAS_EPOLL
+    // Register the socket disarmed; commands arm it when they go pending.
+    {
+        struct epoll_event ev;
+        ev.events = EPOLLONESHOT;
+        ev.data.ptr = sock;
+        if (epoll_ctl(
+            Net_Epoll_Handle, EPOLL_CTL_ADD, sock->requestee.socket, &ev
+        ) != 0) {
+            sock->error = GET_ERROR;
+            return DR_ERROR;
+        }
+    }
+#endif
+
     return DR_DONE;
 }
 
@@ -242,6 +365,14 @@ DEVICE_CMD Close_Socket(REBREQ *sock)
             sock->requestee.socket = sock->length; // Restore TCP socket (see Lookup)
         }
 
+#ifdef HAS_EPOLL
+        // Closing would drop the registration too, but not if the handle
+        // was duplicated (e.g. inherited by a CALL), so remove it explicitly.
+        epoll_ctl(
+            Net_Epoll_Handle, EPOLL_CTL_DEL, sock->requestee.socket, NULL
+        );
+#endif
+
         if (CLOSE_SOCKET(sock->requestee.socket)) {
             sock->error = GET_ERROR;
             return DR_ERROR;
@@ -381,6 +512,7 @@ DEVICE_CMD Connect_Socket(REBREQ *sock)
     case NE_ALREADY:
         // Still trying:
         SET_FLAG(sock->state, RSM_ATTEMPT);
+        Arm_Socket(sock, TRUE); // writable once connected (or failed)
         return DR_PEND;
 
     default:
@@ -433,7 +565,13 @@ DEVICE_CMD Transfer_Socket(REBREQ *sock)
     SET_FLAG(sock->state, mode);
 
     // Limit size of transfer:
-    len = MIN(sock->length - sock->actual, MAX_TRANSFER);
+    if (
+        sock->special.net.transfer_size == 0
+        || sock->special.net.transfer_size > cast(u32, Transfer_Limit(sock))
+    ){
+        sock->special.net.transfer_size = First_Transfer_Size(sock);
+    }
+    len = MIN(sock->length - sock->actual, sock->special.net.transfer_size);
 
     if (mode == RSM_SEND) {
         // If host is no longer connected:
@@ -447,6 +585,7 @@ DEVICE_CMD Transfer_Socket(REBREQ *sock)
         WATCH2("send() len: %d actual: %d\n", len, result);
 
         if (result >= 0) {
+            Adapt_Transfer_Size(sock, len, result);
             sock->common.data += result;
             sock->actual += result;
             if (sock->actual >= sock->length) {
@@ -454,6 +593,7 @@ DEVICE_CMD Transfer_Socket(REBREQ *sock)
                 return DR_DONE;
             }
             SET_FLAG(sock->flags, RRF_ACTIVE); /* notify OS_WAIT of activity */
+            Arm_Socket(sock, TRUE);
             return DR_PEND;
         }
         // if (result < 0) ...
@@ -468,6 +608,7 @@ DEVICE_CMD Transfer_Socket(REBREQ *sock)
         WATCH2("recv() len: %d result: %d\n", len, result);
 
         if (result > 0) {
+            Adapt_Transfer_Size(sock, len, result);
             if (GET_FLAG(sock->modes, RST_UDP)) {
                 sock->special.net.remote_ip = remote_addr.sin_addr.s_addr;
                 sock->special.net.remote_port = ntohs(remote_addr.sin_port);
@@ -488,7 +629,10 @@ DEVICE_CMD Transfer_Socket(REBREQ *sock)
     // Check error code:
     result = GET_ERROR;
     WATCH2("get error: %d %s\n", result, strerror(result));
-    if (result == NE_WOULDBLOCK) return DR_PEND; // still waiting
+    if (result == NE_WOULDBLOCK) {
+        Arm_Socket(sock, LOGICAL(mode == RSM_SEND));
+        return DR_PEND; // still waiting
+    }
 
     WATCH4("ERROR: recv(%d %x) len: %d error: %d\n", sock->requestee.socket, sock->common.data, len, result);
     // A nasty error happened:
@@ -548,6 +692,7 @@ lserr:
     Get_Local_IP(sock);
     sock->command = RDC_CREATE; // the command done on wakeup
 
+    Arm_Socket(sock, FALSE); // readable when a connection is queued
     return DR_PEND;
 }
 
@@ -580,7 +725,10 @@ DEVICE_CMD Accept_Socket(REBREQ *sock)
 
     if (result == BAD_SOCKET) {
         result = GET_ERROR;
-        if (result == NE_WOULDBLOCK) return DR_PEND;
+        if (result == NE_WOULDBLOCK) {
+            Arm_Socket(sock, FALSE);
+            return DR_PEND;
+        }
         sock->error = result;
         //Signal_Device(sock, EVT_ERROR);
         return DR_ERROR;
@@ -601,7 +749,10 @@ DEVICE_CMD Accept_Socket(REBREQ *sock)
     news->requestee.socket = result;
     news->special.net.remote_ip   = sa.sin_addr.s_addr; //htonl(ip); NOTE: REBOL stays in network byte order
     news->special.net.remote_port = ntohs(sa.sin_port);
+    news->special.net.buffer_size = sock->special.net.buffer_size;
+    news->special.net.transfer_size = First_Transfer_Size(news);
     Get_Local_IP(news);
+    Set_Buffer_Size(news);
 
     Nonblocking_Mode(news->requestee.socket);
 
@@ -609,10 +760,71 @@ DEVICE_CMD Accept_Socket(REBREQ *sock)
     Signal_Device(sock, EVT_ACCEPT);
 
     // Even though we signalled, we keep the listen pending to
-    // accept additional connections.
+    // accept additional connections.  (Level-triggered, so re-arming
+    // reports again at once if more are already queued.)
+    Arm_Socket(sock, FALSE);
     return DR_PEND;
 }
 
+
+#ifdef HAS_EPOLL
+
+//
+//  Poll_Net: C
+//
+// Rerun the commands of only those pending requests whose sockets the
+// kernel reported ready, instead of the generic retry of every pending
+// request done by Poll_Default() in %host-device.c.
+//
+// Returns 1 if any request changed status, else 0.
+//
+DEVICE_CMD Poll_Net(REBREQ *dr)
+{
+    REBDEV *dev = (REBDEV*)dr;
+    struct epoll_event events[MAX_NET_EVENTS];
+    REBOOL change = FALSE;
+    int count;
+    int n;
+    extern void Detach_Request(REBREQ **node, REBREQ *req);
+
+    count = epoll_wait(Net_Epoll_Handle, events, MAX_NET_EVENTS, 0);
+
+    for (n = 0; n < count; n++) {
+        REBREQ *req = cast(REBREQ*, events[n].data.ptr);
+        int result;
+
+        // Notification of a socket with nothing pending (e.g. the hangup
+        // of a fresh socket at registration) is dropped.  Being one-shot,
+        // it stays quiet until the next command arms it again.
+        //
+        if (!GET_FLAG(req->flags, RRF_PENDING))
+            continue;
+
+        if (
+            req->command < cast(i32, dev->max_command)
+            && dev->commands[req->command]
+        ){
+            CLR_FLAG(req->flags, RRF_ACTIVE);
+            result = dev->commands[req->command](req);
+        }
+        else {
+            result = DR_ERROR; // invalid command, remove it
+            req->error = ((REBCNT)-1);
+        }
+
+        if (result <= 0) {
+            Detach_Request(&dev->pending, req);
+            change = TRUE;
+        }
+        else if (GET_FLAG(req->flags, RRF_ACTIVE))
+            change = TRUE;
+    }
+
+    return change ? 1 : 0;
+}
+
+#endif
+
 /***********************************************************************
 **
 **  Command Dispatch Table (RDC_ enum order)
@@ -626,7 +838,11 @@ static DEVICE_CMD_FUNC Dev_Cmds[RDC_MAX] = {
     Close_Socket,
     Transfer_Socket,        // Read
     Transfer_Socket,        // Write
+#ifdef HAS_EPOLL
+    Poll_Net,
+#else
     0,  // poll
+#endif
     Connect_Socket,
     0,  // query
     0,  // modify
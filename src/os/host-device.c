@@ -78,6 +78,10 @@ extern REBDEV Dev_Serial;
 extern REBDEV Dev_Signal;
 #endif
 
+#ifdef HAS_PROCESS_PORT
+extern REBDEV Dev_Process;
+#endif
+
 REBDEV *Devices[RDI_LIMIT] =
 {
     0,
@@ -102,6 +106,10 @@ REBDEV *Devices[RDI_LIMIT] =
 #ifdef HAS_POSIX_SIGNAL
     &Dev_Signal,
 #endif
+
+#ifdef HAS_PROCESS_PORT
+    &Dev_Process,
+#endif
     0,
 };
 
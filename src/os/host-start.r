@@ -534,7 +534,10 @@ host-start: function [
 
     ; version, import, secure are all of valid type or blank
 
-    if o/verbose [print o]
+    if o/verbose [
+        print o
+        print ["Init_Core() times:" mold stats/boot]
+    ]
 
     load-boot-exts boot-exts
 
@@ -40,6 +40,15 @@
 
 #include "reb-host.h"
 
+#ifdef HAS_EPOLL
+#include <poll.h>
+
+extern int Net_Epoll_Handle; // in %dev-net.c, readable when a socket is ready
+#ifdef HAS_PROCESS_PORT
+extern int Process_Epoll_Handle; // in %dev-process.c, when a closed child exits
+#endif
+#endif
+
 extern void Done_Device(REBUPT handle, int error);
 
 //
@@ -78,16 +87,39 @@ DEVICE_CMD Poll_Events(REBREQ *req)
 // req->length. The latter is used by WAIT as the main timing
 // method.
 //
+// When the network device is driven by epoll, its handle is waited on as
+// well, so a socket becoming ready ends the wait immediately instead of at
+// the end of the timer.  The same goes for the process device's handle, so
+// a pending CLOSE finishes as soon as its child exits.
+//
 DEVICE_CMD Query_Events(REBREQ *req)
 {
-    struct timeval tv;
     int result;
 
+#ifdef HAS_EPOLL
+    struct pollfd pfds[2];
+    int n = 0;
+    pfds[n].fd = Net_Epoll_Handle; // negative fd (no network yet) is ignored
+    pfds[n].events = POLLIN;
+    pfds[n].revents = 0;
+    ++n;
+    #ifdef HAS_PROCESS_PORT
+    pfds[n].fd = Process_Epoll_Handle;
+    pfds[n].events = POLLIN;
+    pfds[n].revents = 0;
+    ++n;
+    #endif
+
+    result = poll(pfds, n, cast(int, req->length));
+#else
+    struct timeval tv;
+
     tv.tv_sec = 0;
     tv.tv_usec = req->length * 1000;
     //printf("usec %d\n", tv.tv_usec);
 
     result = select(0, 0, 0, 0, &tv);
+#endif
     if (result < 0) {
         //
         // !!! In R3-Alpha this had a TBD that said "set error code" and had a
@@ -98,7 +130,7 @@ DEVICE_CMD Query_Events(REBREQ *req)
         if (errno == EINTR)
             return DR_ERROR;
 
-        printf("select() returned -1 in dev-event.c (I/O error!)\n");
+        printf("wait returned -1 in dev-event.c (I/O error!)\n");
         return DR_ERROR;
     }
 
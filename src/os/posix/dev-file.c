@@ -392,16 +392,28 @@ DEVICE_CMD Read_File(REBREQ *file)
         if (!Seek_File_64(file)) return DR_ERROR;
     }
 
-    // printf("read %d len %d\n", file->requestee.id, file->length);
-
-    bytes = read(file->requestee.id, file->common.data, file->length);
-    if (bytes < 0) {
-        file->error = -RFE_BAD_READ;
-        return DR_ERROR;
-    } else {
-        file->actual = bytes;
-        file->special.file.index += file->actual;
+    // A single read() may transfer less than was asked for when the length
+    // is large (Linux stops at 0x7ffff000 bytes), so read until the request
+    // is filled or the end of the file is reached.
+    //
+    file->actual = 0;
+    while (file->actual < file->length) {
+        bytes = read(
+            file->requestee.id,
+            file->common.data + file->actual,
+            file->length - file->actual
+        );
+        if (bytes < 0) {
+            if (errno == EINTR)
+                continue;
+            file->error = -RFE_BAD_READ;
+            return DR_ERROR;
+        }
+        if (bytes == 0)
+            break;
+        file->actual += bytes;
     }
+    file->special.file.index += file->actual;
 
     return DR_DONE;
 }
@@ -434,11 +446,23 @@ DEVICE_CMD Write_File(REBREQ *file)
 
     if (file->length == 0) return DR_DONE;
 
-    file->actual = bytes = write(file->requestee.id, file->common.data, file->length);
-    if (bytes < 0) {
-        if (errno == ENOSPC) file->error = -RFE_DISK_FULL;
-        else file->error = -RFE_BAD_WRITE;
-        return DR_ERROR;
+    // As with reading, large writes may take more than one write() call.
+    //
+    file->actual = 0;
+    while (file->actual < file->length) {
+        bytes = write(
+            file->requestee.id,
+            file->common.data + file->actual,
+            file->length - file->actual
+        );
+        if (bytes < 0) {
+            if (errno == EINTR)
+                continue;
+            if (errno == ENOSPC) file->error = -RFE_DISK_FULL;
+            else file->error = -RFE_BAD_WRITE;
+            return DR_ERROR;
+        }
+        file->actual += bytes;
     }
 
     return DR_DONE;
@@ -0,0 +1,466 @@
+//
+//  File: %dev-process.c
+//  Summary: "Device: Child processes with non-blocking pipes for Posix"
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2017 Rebol Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Each unit is one child process, started on open with its standard input
+// and output connected to pipes.  The parent's ends of the pipes are
+// non-blocking, so a read or write that can't proceed stays pending and is
+// retried when the device is polled by WAIT, like the serial device.
+//
+// Reading signals EVT_READ when some output arrived.  Once the output has
+// reached end of file the read stays pending until the child has exited,
+// and then signals EVT_CLOSE (so the exit code is known by then).
+//
+// Closing doesn't wait for the child either.  The close stays pending and
+// finishes when the device is polled after the child has exited (see
+// Close_Process()).  On Linux a pidfd for the child is put in an epoll set
+// which WAIT watches, so the exit wakes it up.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <signal.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
+#include "reb-host.h"
+
+#ifdef HAS_EPOLL
+    #include <sys/epoll.h>
+    #include <sys/syscall.h>
+#endif
+
+extern void Signal_Device(REBREQ *req, REBINT type);
+
+// Readable when a child that is being closed has exited, so WAIT wakes up
+// to finish the close (see Query_Events() in %dev-event.c).  It stays -1
+// without epoll, and closes are then only finished by the periodic polls.
+//
+int Process_Epoll_Handle = -1;
+
+// Indices of the ends of a pipe() pair
+//
+#define R 0
+#define W 1
+
+
+//
+//  Init_Process: C
+//
+// Writing to a child which has exited would raise SIGPIPE, whose default
+// action is to end the interpreter.  Ignore it so write() reports EPIPE.
+//
+DEVICE_CMD Init_Process(REBREQ *dr)
+{
+    REBDEV *dev = (REBDEV*)dr; // just to keep compiler happy
+
+    signal(SIGPIPE, SIG_IGN);
+
+#ifdef HAS_EPOLL
+    Process_Epoll_Handle = epoll_create1(EPOLL_CLOEXEC);
+#endif
+
+    SET_FLAG(dev->flags, RDF_INIT);
+    return DR_DONE;
+}
+
+
+//
+//  Set_Pipe_Flags: C
+//
+// The parent's pipe ends are non-blocking and not inherited by children
+// (including other processes opened later, which would keep them alive).
+//
+static int Set_Pipe_Flags(int fd, REBOOL nonblock)
+{
+    if (fcntl(fd, F_SETFD, FD_CLOEXEC) < 0)
+        return -1;
+    if (nonblock && fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK) < 0)
+        return -1;
+    return 0;
+}
+
+
+//
+//  Reap_Process: C
+//
+// Collect the exit status if the child has finished (without waiting).
+//
+static REBOOL Reap_Process(REBREQ *req)
+{
+    int status;
+
+    if (req->special.process.exited)
+        return TRUE;
+
+    if (waitpid(req->special.process.pid, &status, WNOHANG) <= 0)
+        return FALSE;
+
+    if (WIFEXITED(status))
+        req->special.process.exit_code = WEXITSTATUS(status);
+    else if (WIFSIGNALED(status))
+        req->special.process.exit_code = -WTERMSIG(status);
+    else
+        return FALSE; // stopped, not finished
+
+    req->special.process.exited = TRUE;
+    return TRUE;
+}
+
+
+//
+//  Open_Process: C
+//
+// process.command = shell command line, or NULL to use process.argv
+// process.argv = program and arguments (NULL terminated)
+// process.merge_error = send the child's stderr to its stdout pipe
+//
+// The strings are only needed until this returns.
+//
+DEVICE_CMD Open_Process(REBREQ *req)
+{
+    int stdin_pipe[2] = {-1, -1};
+    int stdout_pipe[2] = {-1, -1};
+    int info_pipe[2] = {-1, -1}; // reports exec() failure, closed on success
+    pid_t pid;
+    int err;
+    ssize_t n;
+
+    if (
+        pipe(stdin_pipe) < 0
+        || pipe(stdout_pipe) < 0
+        || pipe(info_pipe) < 0
+        || Set_Pipe_Flags(stdin_pipe[W], TRUE) < 0
+        || Set_Pipe_Flags(stdout_pipe[R], TRUE) < 0
+        || Set_Pipe_Flags(info_pipe[W], FALSE) < 0
+    ){
+        goto error;
+    }
+
+    pid = fork();
+    if (pid < 0)
+        goto error;
+
+    if (pid == 0) {
+        // child
+        //
+        close(stdin_pipe[W]);
+        close(stdout_pipe[R]);
+        close(info_pipe[R]);
+
+        if (
+            dup2(stdin_pipe[R], STDIN_FILENO) < 0
+            || dup2(stdout_pipe[W], STDOUT_FILENO) < 0
+            || (
+                req->special.process.merge_error
+                && dup2(stdout_pipe[W], STDERR_FILENO) < 0
+            )
+        ){
+            goto child_error;
+        }
+        close(stdin_pipe[R]);
+        close(stdout_pipe[W]);
+
+        signal(SIGPIPE, SIG_DFL); // ignored dispositions survive exec()
+
+        if (req->special.process.command != NULL)
+            execl("/bin/sh", "sh", "-c", req->special.process.command, NULL);
+        else
+            execvp(req->special.process.argv[0], req->special.process.argv);
+
+    child_error:
+        err = errno;
+        if (write(info_pipe[W], &err, sizeof(err)) < 0) {
+            // Nothing else can be done, but warn_unused_result must be used
+        }
+        _exit(127);
+    }
+
+    // parent
+    //
+    close(stdin_pipe[R]);
+    close(stdout_pipe[W]);
+    close(info_pipe[W]);
+
+    // A successful exec() closes the child's end of the info pipe, giving
+    // end of file here.  Otherwise this gets the errno it failed with.
+    //
+    do {
+        n = read(info_pipe[R], &err, sizeof(err));
+    } while (n < 0 && errno == EINTR);
+    close(info_pipe[R]);
+
+    if (n == sizeof(err)) {
+        close(stdin_pipe[W]);
+        close(stdout_pipe[R]);
+        waitpid(pid, NULL, 0);
+        req->error = err;
+        return DR_ERROR;
+    }
+
+    req->special.process.pid = pid;
+    req->special.process.stdin_fd = stdin_pipe[W];
+    req->special.process.stdout_fd = stdout_pipe[R];
+    req->special.process.exit_code = 0;
+    req->special.process.pidfd = -1;
+    req->special.process.exited = FALSE;
+    req->special.process.output_eof = FALSE;
+    req->special.process.closing = FALSE;
+    req->requestee.id = stdout_pipe[R];
+
+    SET_OPEN(req);
+    return DR_DONE;
+
+error:
+    req->error = errno;
+    if (stdin_pipe[R] >= 0) close(stdin_pipe[R]);
+    if (stdin_pipe[W] >= 0) close(stdin_pipe[W]);
+    if (stdout_pipe[R] >= 0) close(stdout_pipe[R]);
+    if (stdout_pipe[W] >= 0) close(stdout_pipe[W]);
+    if (info_pipe[R] >= 0) close(info_pipe[R]);
+    if (info_pipe[W] >= 0) close(info_pipe[W]);
+    return DR_ERROR;
+}
+
+
+//
+//  Watch_Exit: C
+//
+// Add a pidfd for the child to the epoll set WAIT watches, so its exit ends
+// the wait.  Kernels without pidfd_open() (before Linux 5.3) just don't get
+// the early wakeup.
+//
+static void Watch_Exit(REBREQ *req)
+{
+#if defined(HAS_EPOLL) && defined(SYS_pidfd_open)
+    if (Process_Epoll_Handle < 0)
+        return;
+
+    int fd = syscall(SYS_pidfd_open, req->special.process.pid, 0);
+    if (fd < 0)
+        return;
+
+    struct epoll_event ev;
+    ev.events = EPOLLIN;
+    ev.data.ptr = req;
+    if (epoll_ctl(Process_Epoll_Handle, EPOLL_CTL_ADD, fd, &ev) < 0) {
+        close(fd);
+        return;
+    }
+    req->special.process.pidfd = fd;
+#else
+    UNUSED(req);
+#endif
+}
+
+
+// How long a closed child gets to finish on its own, and then how long it
+// gets after SIGTERM, before it is sent SIGKILL
+//
+#define PROCESS_CLOSE_MSEC 1000
+
+
+//
+//  Close_Process: C
+//
+// Closing the pipes is normally enough for a child to finish, once it has
+// dealt with end of file on its input.  The close stays pending (DR_PEND)
+// until the child has exited, and each time the device is polled it tries
+// to reap it.  One that is still running after a grace period is sent
+// SIGTERM, and one that outlives another grace period gets SIGKILL, so that
+// no zombie is left behind.  Nothing here blocks.
+//
+// The port counts as closed right away.  QUERY gives the exit code once the
+// close has finished.
+//
+DEVICE_CMD Close_Process(REBREQ *req)
+{
+    if (IS_OPEN(req)) {
+        if (req->special.process.stdin_fd >= 0)
+            close(req->special.process.stdin_fd);
+        close(req->special.process.stdout_fd);
+        req->special.process.stdin_fd = -1;
+        req->special.process.stdout_fd = -1;
+        req->requestee.id = -1;
+        SET_CLOSED(req);
+
+        req->special.process.closing = TRUE;
+        req->special.process.close_signal = 0;
+        req->special.process.close_time = OS_Delta_Time(0, 0);
+        if (!Reap_Process(req))
+            Watch_Exit(req);
+    }
+
+    if (!req->special.process.closing)
+        return DR_DONE;
+
+    if (!Reap_Process(req)) {
+        i64 msec = OS_Delta_Time(req->special.process.close_time, 0) / 1000;
+        if (
+            msec >= PROCESS_CLOSE_MSEC
+            && req->special.process.close_signal != SIGKILL
+        ){
+            int sig = (req->special.process.close_signal == 0)
+                ? SIGTERM
+                : SIGKILL;
+            kill(req->special.process.pid, sig);
+            req->special.process.close_signal = sig;
+            req->special.process.close_time = OS_Delta_Time(0, 0);
+        }
+        return DR_PEND;
+    }
+
+    // Closing the pidfd also takes it out of the epoll set
+    //
+    if (req->special.process.pidfd >= 0) {
+        close(req->special.process.pidfd);
+        req->special.process.pidfd = -1;
+    }
+    req->special.process.closing = FALSE;
+    return DR_DONE;
+}
+
+
+//
+//  Read_Process: C
+//
+DEVICE_CMD Read_Process(REBREQ *req)
+{
+    req->actual = 0;
+
+    if (!req->special.process.output_eof) {
+        ssize_t result = read(
+            req->special.process.stdout_fd, req->common.data, req->length
+        );
+
+        if (result > 0) {
+            req->actual = result;
+            Signal_Device(req, EVT_READ);
+            return DR_DONE;
+        }
+
+        if (result < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+                return DR_PEND;
+
+            req->error = errno;
+            Signal_Device(req, EVT_ERROR);
+            return DR_ERROR;
+        }
+
+        req->special.process.output_eof = TRUE;
+    }
+
+    if (!Reap_Process(req))
+        return DR_PEND; // output is finished, but the process isn't yet
+
+    Signal_Device(req, EVT_CLOSE);
+    return DR_DONE;
+}
+
+
+//
+//  Write_Process: C
+//
+DEVICE_CMD Write_Process(REBREQ *req)
+{
+    if (req->special.process.stdin_fd < 0) {
+        req->error = EPIPE;
+        return DR_ERROR;
+    }
+
+    if (req->actual < req->length) {
+        ssize_t result = write(
+            req->special.process.stdin_fd,
+            req->common.data,
+            req->length - req->actual
+        );
+
+        if (result < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+                return DR_PEND;
+
+            req->error = errno;
+            Signal_Device(req, EVT_ERROR);
+            return DR_ERROR;
+        }
+
+        req->actual += result;
+        req->common.data += result;
+        if (req->actual < req->length)
+            return DR_PEND;
+    }
+
+    Signal_Device(req, EVT_WROTE);
+    return DR_DONE;
+}
+
+
+//
+//  Modify_Process: C
+//
+// The only modification is closing the child's standard input, so that a
+// program reading to end of file (e.g. `sort`) can finish.
+//
+DEVICE_CMD Modify_Process(REBREQ *req)
+{
+    if (req->special.process.stdin_fd >= 0) {
+        close(req->special.process.stdin_fd);
+        req->special.process.stdin_fd = -1;
+    }
+    return DR_DONE;
+}
+
+
+/***********************************************************************
+**
+**  Command Dispatch Table (RDC_ enum order)
+**
+***********************************************************************/
+
+static DEVICE_CMD_FUNC Dev_Cmds[RDC_MAX] =
+{
+    Init_Process,
+    0,
+    Open_Process,
+    Close_Process,
+    Read_Process,
+    Write_Process,
+    0,  // poll
+    0,  // connect
+    0,  // query
+    Modify_Process,
+    0,  // create
+    0,  // delete
+    0,  // rename
+    0,  // lookup
+};
+
+DEFINE_DEV(Dev_Process, "Process", 1, Dev_Cmds, RDC_MAX, 0);
@@ -41,6 +41,10 @@
 #define INVALID_SET_FILE_POINTER ((DWORD)-1)
 #endif
 
+// Largest transfer done in one ReadFile() or WriteFile() call
+//
+#define MAX_FILE_CHUNK 0x40000000
+
 
 /***********************************************************************
 **
@@ -291,20 +295,29 @@ DEVICE_CMD Read_File(REBREQ *file)
         if (!Seek_File_64(file)) return DR_ERROR;
     }
 
-    assert(sizeof(DWORD) == sizeof(file->actual));
-
-    if (!ReadFile(
-        file->requestee.handle,
-        file->common.data,
-        file->length,
-        cast(DWORD*, &file->actual),
-        0
-    )) {
-        file->error = -RFE_BAD_READ;
-        return DR_ERROR;
-    } else {
-        file->special.file.index += file->actual;
+    // ReadFile() takes a DWORD length, which a REB_LARGE_SERIES request may
+    // exceed, so read in chunks until the request is filled or end of file.
+    //
+    file->actual = 0;
+    while (file->actual < file->length) {
+        REBLEN rest = file->length - file->actual;
+        DWORD chunk = rest > MAX_FILE_CHUNK ? MAX_FILE_CHUNK : cast(DWORD, rest);
+        DWORD got;
+        if (!ReadFile(
+            file->requestee.handle,
+            file->common.data + file->actual,
+            chunk,
+            &got,
+            0
+        )) {
+            file->error = -RFE_BAD_READ;
+            return DR_ERROR;
+        }
+        if (got == 0)
+            break;
+        file->actual += got;
     }
+    file->special.file.index += file->actual;
 
     return DR_DONE;
 }
@@ -337,12 +350,27 @@ DEVICE_CMD Write_File(REBREQ *file)
             SetEndOfFile(file->requestee.handle);
     }
 
+    file->actual = 0;
     if (file->length != 0) {
-        if (!WriteFile(file->requestee.handle, file->common.data, file->length, (LPDWORD)&file->actual, 0)) {
-            result = GetLastError();
-            if (result == ERROR_HANDLE_DISK_FULL) file->error = -RFE_DISK_FULL;
-            else file->error = -RFE_BAD_WRITE;
-            return DR_ERROR;
+        while (file->actual < file->length) {
+            REBLEN rest = file->length - file->actual;
+            DWORD chunk = rest > MAX_FILE_CHUNK
+                ? MAX_FILE_CHUNK
+                : cast(DWORD, rest);
+            DWORD wrote;
+            if (!WriteFile(
+                file->requestee.handle,
+                file->common.data + file->actual,
+                chunk,
+                &wrote,
+                0
+            )) {
+                result = GetLastError();
+                if (result == ERROR_HANDLE_DISK_FULL) file->error = -RFE_DISK_FULL;
+                else file->error = -RFE_BAD_WRITE;
+                return DR_ERROR;
+            }
+            file->actual += wrote;
         }
     }
 
@@ -34,6 +34,7 @@ core: [
     c-error.c
     c-eval.c
     c-function.c
+    c-jit.c
     c-path.c
     c-port.c
     c-signal.c
@@ -42,11 +43,13 @@ core: [
 
     ; (D)ebug
     d-break.c
+    d-alloc.c
     d-crash.c
     d-dump.c
     d-eval.c
     d-legacy.c
     d-print.c
+    d-profile.c
     d-stack.c
     d-trace.c
 
@@ -100,6 +103,7 @@ core: [
     p-event.c
     p-file.c
     p-net.c
+    p-process.c
     p-serial.c
     p-signal.c
 ;   p-timer.c ;--Marked as unimplemented
@@ -146,6 +150,7 @@ core: [
     t-word.c
 
     ; (U)??? (3rd-party code extractions)
+    u-blake2.c
     u-bmp.c
     u-compress.c
     u-dialect.c
@@ -155,6 +160,7 @@ core: [
     u-parse.c
     u-png.c
     u-sha1.c
+    u-sha2.c
     u-zlib.c
 
     ; Atronix repository breaks out codecs into a separate directory.
@@ -163,10 +169,12 @@ core: [
 
     ../codecs/aes/aes.c
     ../codecs/bigint/bigint.c
+    ../codecs/chacha20poly1305/chacha20poly1305.c
     ../codecs/dh/dh.c
-    ../codecs/png/lodepng.c
+    ../codecs/mont64/mont64.c
     ../codecs/rc4/rc4.c
     ../codecs/rsa/rsa.c
+    ../codecs/x25519/x25519.c
 ]
 
 modules: [
@@ -295,6 +303,9 @@ os-linux: [
 
     ; Linux supports siginfo_t-style signals
     linux/dev-signal.c
+
+    ; Child processes as ports (the code is POSIX, only enabled for Linux)
+    posix/dev-process.c
 ]
 
 ; cloned from os-linux TODO: check'n'fix !!
@@ -902,33 +902,175 @@ for-each type datatypes [
     append/only boot-typespecs spec
 ]
 
-;-- Create main code section (compressed):
+;-- Create main code section (pre-scanned, compressed):
+;
+; Rather than embedding the boot block as source text to be scanned on every
+; startup, it is stored in a binary form that Init_Core() turns directly into
+; arrays.  Each distinct spelling is written once, in a symbol table ahead of
+; the values, and words refer to it by index.  Counts and sizes are unsigned
+; LEB128 (7 bits per byte, low bits first, high bit set if more follow).
+;
+; Only the most common types have an encoding of their own.  Anything else
+; is written as MOLD/FLAT text and scanned singly, which gives the same value
+; the whole-block scan used to.  Words go that route too unless their
+; spelling is plain, since R3-Alpha (which may be running this) scans some
+; spellings differently from Ren-C.
 
 boot-types: new-types
 boot-root: load %root.r
 boot-task: load %task.r
 
+boot-bin-tags: [
+    word set-word get-word lit-word refinement
+    block group path set-path get-path lit-path
+    integer string blank bar scan
+]
+
+boot-bin-tag: function [name [word!]] [
+    (index-of find boot-bin-tags name) - 1
+]
+
+boot-bin-plain-head: charset [#"a" - #"z" #"A" - #"Z" "-?!*+=~"]
+boot-bin-plain-char: union boot-bin-plain-head charset [#"0" - #"9"]
+
+boot-bin-symbols: make block! 4000 ;-- spellings, in order of first use
+boot-bin-buckets: make map! 4000 ;-- spelling => [spelling index ...]
+
+emit-bin-count: function [bin [binary!] n [integer!]] [
+    while [n >= 128] [
+        append bin 128 + remainder n 128
+        n: (n - remainder n 128) / 128
+    ]
+    append bin n
+]
+
+emit-bin-bytes: function [bin [binary!] bytes [binary!]] [
+    emit-bin-count bin length bytes
+    append bin bytes
+]
+
+boot-bin-symbol: function [spelling [string!]] [
+    ;
+    ; Map keys may be case-insensitive, so the map leads to a short list of
+    ; the spellings that differ only in case.
+    ;
+    unless bucket: any [select boot-bin-buckets spelling] [
+        bucket: copy []
+        append boot-bin-buckets reduce [spelling bucket]
+    ]
+    either pos: find/case/skip bucket spelling 2 [
+        second pos
+    ][
+        append boot-bin-symbols spelling
+        append bucket reduce [spelling (length boot-bin-symbols) - 1]
+        last bucket
+    ]
+]
+
+emit-bin-value: function [bin [binary!] value] [
+    type: to word! type-of :value
+    if type = 'word! [
+        switch form :value [
+            "_" [type: 'blank!]
+            "|" [type: 'bar!]
+        ]
+    ]
+    if type = 'paren! [type: 'group!] ;-- R3-Alpha name for GROUP!
+
+    ; The tags for words and arrays are named after their type (sans "!")
+    ;
+    tag: to word! head remove back tail form type
+
+    switch/default type [
+        word! set-word! get-word! lit-word! refinement! [
+            spelling: form to word! :value
+            either parse/case spelling [
+                boot-bin-plain-head any boot-bin-plain-char
+            ][
+                append bin boot-bin-tag tag
+                emit-bin-count bin boot-bin-symbol spelling
+            ][
+                emit-bin-scan bin :value
+            ]
+        ]
+        block! group! path! set-path! get-path! lit-path! [
+            append bin boot-bin-tag tag
+            emit-bin-count bin length value
+            for-each item value [emit-bin-value bin :item]
+        ]
+        integer! [
+            append bin boot-bin-tag 'integer
+            emit-bin-bytes bin to binary! form value
+        ]
+        string! [
+            append bin boot-bin-tag 'string
+            emit-bin-bytes bin to binary! value
+        ]
+        blank! none! [
+            ;
+            ; A NONE! value molds as the word `none`, so that's what the
+            ; scanner would have made of it; only a real blank is a blank.
+            ;
+            either type = 'blank! [
+                append bin boot-bin-tag 'blank
+            ][
+                emit-bin-scan bin :value
+            ]
+        ]
+        bar! [
+            append bin boot-bin-tag 'bar
+        ]
+    ][
+        emit-bin-scan bin :value
+    ]
+]
+
+emit-bin-scan: function [bin [binary!] value] [
+    append bin boot-bin-tag 'scan
+    text: to binary! mold/flat :value
+    append text 0 ;-- scanner requires zero termination
+    emit-bin-bytes bin text
+]
+
 write boot/boot-code.r mold reduce sections
-data: mold/flat reduce sections
-insert data reduce ["; Copyright (C) REBOL Technologies " now newline]
-insert tail data make char! 0 ; scanner requires zero termination
 
-comp-data: compress data: to-binary data
+values: make binary! 500000
+emit-bin-count values 1 ;-- top level holds just the boot block, as if scanned
+emit-bin-value values reduce sections
+
+data: make binary! 50000 + length values
+emit-bin-count data length boot-bin-symbols
+for-each spelling boot-bin-symbols [
+    emit-bin-bytes data to binary! spelling
+]
+append data values
+
+comp-data: compress data
 
 emit {
 // Native_Specs contains data which is the DEFLATE-algorithm-compressed
-// representation of the textual function specs for Rebol's native
-// routines.  Though DEFLATE includes the compressed size in the payload,
-// NAT_UNCOMPRESSED_SIZE is also defined to be used as a sanity check
-// on the decompression process.
+// representation of the boot block (function specs for Rebol's native
+// routines, mezzanine code, etc.), pre-scanned by %make-boot.r.  Though
+// DEFLATE includes the compressed size in the payload, NAT_UNCOMPRESSED_SIZE
+// is also defined to be used as a sanity check on the decompression process.
+//
+// With REB_BOOT_UNCOMPRESSED the data is embedded as-is instead, so boot
+// can load it straight out of the executable's read-only data (which the
+// OS maps in on demand) with no inflate step or copy.
 }
 emit newline
 
+emit-line "#if defined(REB_BOOT_UNCOMPRESSED)"
+emit-line ["const REBYTE Native_Specs[NAT_UNCOMPRESSED_SIZE] = {"]
+emit binary-to-c data
+emit-line "};"
+emit-line "#else"
 emit-line ["const REBYTE Native_Specs[NAT_COMPRESSED_SIZE] = {"]
 
 ;-- Convert UTF-8 binary to C-encoded string:
 emit binary-to-c comp-data
 emit-line "};" ;-- EMIT-END would erase the last comma, but there's no extra
+emit-line "#endif"
 
 write-emitted src/b-boot.c
 
@@ -957,9 +1099,14 @@ emit-line ["#define CHECK_TITLE" space (checksum to binary! title)]
 
 emit {
 // Compressed data of the native specifications.  This is uncompressed during
-// boot and executed.
+// boot and executed.  (Stored uncompressed if REB_BOOT_UNCOMPRESSED.)  See
+// Load_Boot_Block() for the format, and the Boot_Bin_Tags that it uses.
 //
-extern const REBYTE Native_Specs[NAT_COMPRESSED_SIZE];
+#if defined(REB_BOOT_UNCOMPRESSED)
+    extern const REBYTE Native_Specs[NAT_UNCOMPRESSED_SIZE];
+#else
+    extern const REBYTE Native_Specs[NAT_COMPRESSED_SIZE];
+#endif
 
 // Raw C function pointers for natives.
 //
@@ -970,6 +1117,13 @@ extern const REBNAT Native_C_Funcs[NUM_NATIVES];
 extern REBVAL Natives[NUM_NATIVES];
 }
 
+emit newline
+emit-line "enum Boot_Bin_Tags {"
+for-each tag boot-bin-tags [
+    emit-item/upper ["BOOT_BIN_" tag]
+]
+emit-end
+
 emit newline
 emit-line "enum Native_Indices {"
 
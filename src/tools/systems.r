@@ -53,43 +53,43 @@ systems: [
             [LLP64 LEN LL? +O2 UNI W32 CON S4M EXE DIR -LM]
     ;-------------------------------------------------------------------------
     0.4.02      linux-x86       linux
-            [M32 LEN LLC +O2 LDL ST1 -LM LC23 UFS NSP NSER]
+            [M32 LEN LLC +O2 LDL LPT ST1 -LM LC23 UFS NSP NSER]
 
     0.4.03      linux-x86       linux
-            [M32 LEN LLC +O2 LDL ST1 -LM LC25 UFS HID]
+            [M32 LEN LLC +O2 LDL LPT ST1 -LM LC25 UFS HID]
 
     0.4.04      linux-x86       linux
-            [M32 LEN LLC +O2 LDL ST1 -LM LC211 HID PIP2]
+            [M32 LEN LLC +O2 LDL LPT ST1 -LM LC211 HID PIP2]
 
     0.4.10      linux-ppc       linux
-            [BEN LLC +O1 HID LDL ST1 -LM PIP2]
+            [BEN LLC +O1 HID LDL LPT ST1 -LM PIP2]
 
     0.4.11      linux-ppc64     linux
-            [LP64 BEN LLC +O1 HID LDL ST1 -LM PIP2]
+            [LP64 BEN LLC +O1 HID LDL LPT ST1 -LM PIP2]
 
     0.4.20      linux-arm       linux
-            [LEN LLC +O2 HID LDL ST1 -LM PIP2]
+            [LEN LLC +O2 HID LDL LPT ST1 -LM PIP2]
 
     0.4.21      linux-arm       linux
             [LEN LLC +O2 HID LDL ST1 -LM PIE LCB PIP2]
 
     0.4.22      linux-aarch64       linux
-            [LP64 LEN LLC +O2 HID LDL ST1 -LM PIP2]
+            [LP64 LEN LLC +O2 HID LDL LPT ST1 -LM PIP2]
 
     0.4.30      linux-mips      linux
-            [LEN LLC +O2 HID LDL ST1 -LM PIP2]
+            [LEN LLC +O2 HID LDL LPT ST1 -LM PIP2]
 
     0.4.31      linux-mips32be  linux
-            [BEN LLC +O2 HID LDL ST1 -LM PIP2]
+            [BEN LLC +O2 HID LDL LPT ST1 -LM PIP2]
 
     0.4.40      linux-x64       linux
-            [LP64 LEN LLC +O2 HID LDL ST1 -LM PIP2]
+            [LP64 LEN LLC +O2 HID LDL LPT ST1 -LM PIP2]
 
     0.4.60      linux-axp       linux
-            [LP64 LEN LLC +O2 HID LDL ST1 -LM PIP2]
+            [LP64 LEN LLC +O2 HID LDL LPT ST1 -LM PIP2]
 
     0.4.61      linux-ia64      linux
-            [LP64 LEN LLC +O2 HID LDL ST1 -LM PIP2]
+            [LP64 LEN LLC +O2 HID LDL LPT ST1 -LM PIP2]
     ;-------------------------------------------------------------------------
     0.5.75      haiku           posix
             [LEN LLC +O2 ST1 NWK]
@@ -116,7 +116,7 @@ systems: [
             [LEN LLC +O2 HID LDL ST1 -LM LC25]
 
     0.14.02     syllable-svr    linux
-            [M32 LEN LLC +O2 HID LDL ST1 -LM LC211]
+            [M32 LEN LLC +O2 HID LDL LPT ST1 -LM LC211]
 ]
 
 compiler-flags: context [
@@ -180,6 +180,7 @@ linker-flags: context [
 
     NSO: ""                         ; no shared libs
     LDL: "-ldl"                     ; link with dynamic lib lib
+    LPT: "-lpthread"                ; POSIX threads (COMPRESS/PARALLEL)
     LLOG: "-llog"                   ; on Android, link with liblog.so
 
     W32: "-lwsock32 -lcomdlg32"
@@ -137,6 +137,9 @@
 %functions/adapt.test.reb
 %functions/apply.test.reb
 %functions/chain.test.reb
+%functions/frame.test.reb
+%functions/jit.test.reb
+%functions/profile.test.reb
 %functions/hijack.test.reb
 %functions/specialize.test.reb
 %math/absolute.test.reb
@@ -209,8 +212,13 @@
 %string/decode.test.reb
 %string/encode.test.reb
 %string/decompress.test.reb
+%string/dechunk.test.reb
 %string/dehex.test.reb
+%string/tls-record.test.reb
+%string/aes.test.reb
+%string/rsa.test.reb
 %system/system.test.reb
 %system/file.test.reb
 %system/gc.test.reb
+%system/process.test.reb
 %source/analysis.test.reb
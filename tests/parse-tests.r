@@ -140,3 +140,11 @@
 ; self-modifying rule, not legal in Ren-C if it's during the parse
 
 [error? try [not parse? "abcd" rule: ["ab" (remove back tail rule) "cd"]]]
+
+; TO and THRU multi-character rules (pattern lengths are REBLEN)
+
+[parse? "xxabcyy" [thru "abc" "yy"]]
+[parse? "xxabcyy" [to ["abc" | "zz"] "abcyy"]]
+[parse? #{0001020304} [thru [#{0203} | #{ff}] #{04}]]
+[parse? "a<b>c" [thru <b> "c"]]
+[not parse? "ab" [thru "abc"]]